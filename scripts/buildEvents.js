@@ -25,25 +25,30 @@ function getFixedArgToValue(arg) {
   return value;
 }
 
+// Hooks with a return value keep it in a typed local filled by event::returnInto (see src/node/returns.hpp)
+function getReturnDeclaration(type) {
+  return `\n    ${type} returnValue{};`;
+}
+
+function getDefaultValue(type) {
+  if (type.includes('*')) return 'nullptr';
+  if (type === 'float') return '0.0f';
+  if (type === 'double') return '0.0';
+  return '0';
+}
+
 function getReturnStatement(type) {
-  const getOverrideCheck = (returnCast) => {
-    return `
+  return `
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return ${returnCast}gpMetaGlobals->override_ret;
-    }`;
-  };
+      return returnValue;
+    }
+    return ${getDefaultValue(type)};`;
+}
 
-  if (type.includes('*')) {
-    return `${getOverrideCheck('('+type+')')}\n    return nullptr;`;
-  } else if (type === 'int' || type === 'qboolean' || type === 'unsigned int') {
-    return `${getOverrideCheck('('+type+')(intptr_t)')}\n    return 0;`;
-  } else if (type === 'float') {
-    return `${getOverrideCheck('(float)(intptr_t)')}\n    return 0.0f;`;
-  } else if (type === 'double') {
-    return `${getOverrideCheck('(double)(intptr_t)')}\n    return 0.0;`;
-  } else {
-    return `${getOverrideCheck('('+type+')(intptr_t)')}\n    return 0;`;
-  }
+// Hooks stay in metamod's tables; an inactive one returns before any work
+function getActiveCheck(eventName, type) {
+  const needsReturn = type !== 'NULL' && type !== 'void';
+  return `\n    if (!hooks::active(EventId::${eventName})) return${needsReturn ? ` ${getDefaultValue(type)}` : ''};`;
 }
 
 function getEventName(func, prefix) {
@@ -63,6 +68,23 @@ function getArrayConversion(arrayType, arrayName, lengthName) {
   }
 }
 
+// Argument types batch::record() can store without a JS round trip (see src/node/batch.hpp)
+const batchIntTypes = ['int', 'unsignedint', 'char', 'unsignedchar', 'unsignedshort', 'byte', 'qboolean', 'ALERT_TYPE', 'FORCE_TYPE', 'PRINT_TYPE', 'edict_t*', 'constedict_t*', 'constchar*', 'char*'];
+const batchFloatTypes = ['float', 'double', 'constfloat*'];
+
+function isBatchable(func, type) {
+  if (func.type !== 'void' || !func.args || func.args.length === 0) return false;
+  if (func.name === 'pfnStartFrame') return false;
+  // Custom bodies build their own listener arguments, they name what a record holds
+  const customEvent = customs[type]?.[func.name]?.event;
+  if (customEvent?.body) return !!customEvent.batchArgs;
+
+  return func.args.every(arg => {
+    const argType = arg.type.replace(/\s+/g, '');
+    return batchIntTypes.includes(argType) || batchFloatTypes.includes(argType);
+  });
+}
+
 function getFunction(func, prefix, type) {
   const customBody = customs[type]?.[func.name]?.event?.body;
   customBody && console.log(func.name, 'YES')
@@ -101,17 +123,25 @@ function getFunction(func, prefix, type) {
   
   const description = `// nodemod.on('${eventName}', (${regularArgs.map(v => v.name).join(', ')}) => console.log('${eventName} fired!'));`;
   
+  // Raw arguments for listener filters, in listener argument order
+  const customNativeArgs = customs[type]?.[func.name]?.event?.nativeArgs;
+  const nativeArgs = customBody
+    ? (customNativeArgs ? `, event::native(${customNativeArgs})` : '')
+    : `, event::native(${regularArgs.map(v => v.name).join(', ')})`;
+
   if (customBody) {
     func._eventName = `${prefix}_${func.name}`;
     const needsReturn = func.type !== 'NULL' && func.type !== 'void';
     const returnStatement = needsReturn ? getReturnStatement(func.type) : '';
+    const returnDeclaration = needsReturn ? getReturnDeclaration(func.type) : '';
+    const returnInto = needsReturn ? ', event::returnInto(returnValue)' : '';
+    const customBatchCode = isBatchable(func, type) ? `\n    batch::record(EventId::${eventName}, ${customs[type][func.name].event.batchArgs});` : '';
     return `${description}
   ${func.type === 'NULL' ? 'void' : func.type} ${prefix}_${func.name} (${customs[type]?.[func.name]?.event?.argsString || func.args.map(v => `${v.type} ${v.name}`).join(', ')}) {
-    SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("${eventName}", [=](v8::Isolate* isolate) {
+    SET_META_RESULT(MRES_IGNORED);${getActiveCheck(eventName, func.type)}${returnDeclaration}${customBatchCode}
+    event::findAndCall<${customs[type][func.name].event.argCount}>(EventId::${eventName}, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       ${customBody}
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });${returnStatement}
+    }${nativeArgs}${returnInto});${returnStatement}
   }`;
   }
 
@@ -120,61 +150,70 @@ function getFunction(func, prefix, type) {
   }
 
   func._eventName = `${prefix}_${func.name}`;
-  if (func.name === 'pfnStartFrame' && prefix !== 'post') {
+  // Frame work runs once, in the pre hook; postDllStartFrame is a plain event
+  if (func.name === 'pfnStartFrame' && prefix === 'dll') {
     return `// ${func.name} - Run Node.js UV loop tick and fire event
   ${func.type} ${prefix}_${func.name} () {
     SET_META_RESULT(MRES_IGNORED);
+    trace::Scope frameScope(trace::StartFrame, trace::Category::Frame);
+    watchdog::frame();
+    hooks::frame();
+    arena::resetFrame();
+    snapshot::capture();
+    spatial::sweep();
+    batch::flush();
+    cvars::frame();
     nodeImpl.Tick();
-    event::findAndCall("${eventName}", nullptr, 0);
+    event::findAndCall(EventId::${eventName}, nullptr, 0);
   }`;
   }
 
+  // Check for custom beforeBody/afterBody code
+  // preEvent applies to pre hooks, postEvent to post hooks
+  const isPostHook = prefix.startsWith('post');
+  const eventKey = isPostHook ? 'postEvent' : 'preEvent';
+  const beforeBody = customs[type]?.[func.name]?.[eventKey]?.beforeBody || '';
+  const afterBody = customs[type]?.[func.name]?.[eventKey]?.afterBody || '';
+  const beforeBodyCode = beforeBody ? `\n    ${beforeBody}\n` : '';
+  const afterBodyCode = afterBody ? `\n    ${afterBody}` : '';
+
   if (func.args.length === 0) {
     const needsReturn = func.type !== 'void';
     const returnStatement = needsReturn ? getReturnStatement(func.type) : '';
+    const returnDeclaration = needsReturn ? getReturnDeclaration(func.type) : '';
+    const returnInto = needsReturn ? ', event::returnInto(returnValue)' : '';
     return `${description}
   ${func.type} ${prefix}_${func.name} () {
-    SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("${eventName}", nullptr, 0);${returnStatement}
+    SET_META_RESULT(MRES_IGNORED);${getActiveCheck(eventName, func.type)}${returnDeclaration}${beforeBodyCode}
+    event::findAndCall(EventId::${eventName}, nullptr, 0${returnInto});${afterBodyCode}${returnStatement}
   }`;
   }
 
 
   const needsReturn = func.type !== 'void';
   const returnStatement = needsReturn ? getReturnStatement(func.type) : '';
+  const returnDeclaration = needsReturn ? getReturnDeclaration(func.type) : '';
+  const returnInto = needsReturn ? ', event::returnInto(returnValue)' : '';
   
   // For variadic functions, only include regular arguments in the event
   if (hasVariadic) {
     return `${description}
   ${func.type} ${prefix}_${func.name} (${regularArgs.map(v => `${v.type} ${v.name}`).join(', ')}, ...) {
-    SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("${eventName}", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = ${regularArgs.length};
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[${regularArgs.length}];
+    SET_META_RESULT(MRES_IGNORED);${getActiveCheck(eventName, func.type)}${returnDeclaration}
+    event::findAndCall<${regularArgs.length}>(EventId::${eventName}, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       ${regularArgs.map((v, i) => `v8_args[${i}] = ${getFixedArgToValue(v)}; // ${v.name} (${v.type})`).join('\n      ')}
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });${returnStatement}
+    }${nativeArgs}${returnInto});${returnStatement}
   }`;
   }
   
-  // Check for custom beforeBody/afterBody code
-  // Use preEvent.beforeBody for pre hooks, postEvent.afterBody for post hooks
-  const isPostHook = prefix.startsWith('post');
-  const eventKey = isPostHook ? 'postEvent' : 'preEvent';
-  const beforeBody = !isPostHook ? (customs[type]?.[func.name]?.preEvent?.beforeBody || '') : '';
-  const afterBody = customs[type]?.[func.name]?.[eventKey]?.afterBody || '';
-  const beforeBodyCode = beforeBody ? `\n    ${beforeBody}\n` : '';
-  const afterBodyCode = afterBody ? `\n    ${afterBody}` : '';
+  const batchCode = isBatchable(func, type) ? `\n    batch::record(EventId::${eventName}, ${func.args.map(v => v.name).join(', ')});` : '';
 
   return `${description}
   ${func.type} ${prefix}_${func.name} (${func.args.map(v => `${v.type} ${v.name}`).join(', ')}) {
-    SET_META_RESULT(MRES_IGNORED);${beforeBodyCode}
-    event::findAndCall("${eventName}", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = ${regularArgs.length};
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[${regularArgs.length}];
+    SET_META_RESULT(MRES_IGNORED);${getActiveCheck(eventName, func.type)}${returnDeclaration}${beforeBodyCode}${batchCode}
+    event::findAndCall<${regularArgs.length}>(EventId::${eventName}, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       ${regularArgs.map((v, i) => `v8_args[${i}] = ${getFixedArgToValue(v)}; // ${v.name} (${v.type})`).join('\n      ')}
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });${afterBodyCode}${returnStatement}
+    }${nativeArgs}${returnInto});${afterBodyCode}${returnStatement}
   }`;
 }
 
@@ -453,8 +492,22 @@ function parseFunction(line) {
     ...engineFunctions.map(v => getEventName(v, 'postEng'))
   ];
 
+  // Native events get ids after the table events and are registered with the engine events
+  const nativeEventNames = Object.keys(customs.native);
+
+  const eventBatchable = [
+    ...dllFunctions.map(v => isBatchable(v, 'dll')),
+    ...dllFunctions.map(v => isBatchable(v, 'dll')),
+    ...engineFunctions.map(v => isBatchable(v, 'eng')),
+    ...engineFunctions.map(v => isBatchable(v, 'eng'))
+  ];
+
   // Generate event interfaces  
   const eventInterfaces = [
+    ...nativeEventNames.map(name => {
+      const { parameters, returns } = customs.native[name].typescript;
+      return { name, parameters, returns, signature: `(${parameters.map(p => `${p.name}: ${p.type}`).join(', ')}) => ${returns}` };
+    }),
     ...dllFunctions.map(v => computeEventInterface(v, 'dll')),
     ...dllFunctions.map(v => computeEventInterface(v, 'postDll')),
     ...engineFunctions.filter(v => !v.name.includes('CRC32')).map(v => computeEventInterface(v, 'eng')),
@@ -469,7 +522,7 @@ function parseFunction(line) {
   const constEnums = await parseConstEnums();
 
   // Generate split type files
-  const typeFiles = fileMaker.typings.makeIndex(computed, structureInterfaces, eventNames, eventInterfaces, hamData, constGroups, constEnums);
+  const typeFiles = fileMaker.typings.makeIndex(computed, structureInterfaces, [...eventNames, ...nativeEventNames], eventInterfaces, hamData, constGroups, constEnums);
 
   // Write each type file to packages/core/types
   for (const [filename, content] of Object.entries(typeFiles)) {
@@ -484,6 +537,16 @@ function parseFunction(line) {
   #include <string>
   #include "node/nodeimpl.hpp"
   #include "node/events.hpp"
+  #include "node/batch.hpp"
+  #include "node/trace.hpp"
+  #include "node/watchdog.hpp"
+  #include "node/arena.hpp"
+  #include "node/snapshot.hpp"
+  #include "node/spatial.hpp"
+  #include "node/cvars.hpp"
+  #include "node/stringtable.hpp"
+  #include "node/messages.hpp"
+  #include "lib/hooks.hpp"
   #include "meta_api.h"
   #include "node/utils.hpp"
   #include "structures/structures.hpp"
@@ -505,9 +568,9 @@ function parseFunction(line) {
     void registerDllEvents()
     {
       // base
-      ${dllFunctions.map(v => `event::register_event("${getEventName(v, 'dll')}", "");`).join('\n')}
+      ${dllFunctions.map(v => `event::register_event(EventId::${getEventName(v, 'dll')}, "");`).join('\n')}
       // post
-      ${dllFunctions.map(v => `event::register_event("${getEventName(v, 'postDll')}", "");`).join('\n')}
+      ${dllFunctions.map(v => `event::register_event(EventId::${getEventName(v, 'postDll')}, "");`).join('\n')}
     }
   `;
 
@@ -519,6 +582,16 @@ function parseFunction(line) {
   #include <extdll.h>
   #include "node/nodeimpl.hpp"
   #include "node/events.hpp"
+  #include "node/batch.hpp"
+  #include "node/trace.hpp"
+  #include "node/watchdog.hpp"
+  #include "node/arena.hpp"
+  #include "node/snapshot.hpp"
+  #include "node/spatial.hpp"
+  #include "node/cvars.hpp"
+  #include "node/stringtable.hpp"
+  #include "node/messages.hpp"
+  #include "lib/hooks.hpp"
   #include "meta_api.h"
   #include "node/utils.hpp"
   #include "structures/structures.hpp"
@@ -540,14 +613,43 @@ function parseFunction(line) {
     void registerEngineEvents()
     {
       // base
-      ${engineFunctions.map(v => `event::register_event("${getEventName(v, 'eng')}", "");`).join('\n')}
+      ${engineFunctions.map(v => `event::register_event(EventId::${getEventName(v, 'eng')}, "");`).join('\n')}
       // post
-      ${engineFunctions.map(v => `event::register_event("${getEventName(v, 'postEng')}", "");`).join('\n')}
+      ${engineFunctions.map(v => `event::register_event(EventId::${getEventName(v, 'postEng')}, "");`).join('\n')}
+      // native
+      ${nativeEventNames.map(v => `event::register_event(EventId::${v}, "");`).join('\n')}
     }
   `;
 
   await fs.writeFile('./src/auto/engine_events.cpp', engineFile);
 
+  // Event ids: native hooks dispatch through event::slots[id] instead of
+  // hashing the event name on every call. Order must match the registration
+  // order above (dll, postDll, eng, postEng).
+  const eventIdsFile = `// This file builded by: node scripts/buildEvents.js
+#pragma once
+
+enum class EventId : unsigned int
+{
+  ${[...eventNames, ...nativeEventNames].join(',\n  ')},
+  Count
+};
+
+// Ids below this are engine/DLL table slots, the rest are fired by nodemod itself
+inline constexpr unsigned int eventTableCount = ${eventNames.length};
+
+inline constexpr const char* eventIdNames[] = {
+  ${[...eventNames, ...nativeEventNames].map(v => `"${v}"`).join(',\n  ')}
+};
+
+// Events whose hooks feed nodemod.onBatched
+inline constexpr bool eventBatchable[] = {
+  ${[...eventBatchable, ...nativeEventNames.map(() => false)].join(',\n  ')}
+};
+`;
+
+  await fs.writeFile('./src/auto/event_ids.hpp', eventIdsFile);
+
   // Generate test file that registers all hooks
   const testFile = generateTestFile(dllFunctions, engineFunctions, eventInterfaces);
   await fs.writeFile('./packages/examples/src/examples/test-all-hooks.generated.ts', testFile);
@@ -664,9 +766,10 @@ function cTypeToTsType(cType) {
     return 'number';
   }
   
-  // Vector type - match generator.js vec3_t mapping
+  // Vector type - match generator.js vec3_t mapping; entity vector fields are
+  // Float32Array views and can be passed straight back
   if (normalizedType === 'vec3_t') {
-    return 'number[]';
+    return 'number[] | Float32Array';
   }
   
   // Entity types - match generator.js struct mappings
@@ -780,6 +883,12 @@ function cTypeToTsType(cType) {
 function computeFunctionApi(func, source) {
   const jsName = camelize(func.name.replace(/^pfn/, ''));
   const returnType = cTypeToTsType(func.type);
+  const engineObject = source === 'eng' ? 'g_engfuncs' : 'gpGamedllFuncs->dllapi_table';
+
+  // Engine calls get a v8::CFunction fast path where the signature allows it
+  const fast = source === 'eng' ? generator.generateFastFunction(func, engineObject, `sf_${source}`) : null;
+  const definition = `{ "${jsName}", sf_${source}_${func.name}${fast ? `, &${fast.name}` : ''} }`;
+  const body = `${generator.generateCppFunction(func, engineObject, `sf_${source}`)}${fast ? `\n\n${fast.body}` : ''}`;
   
   // Check for custom TypeScript definitions in customs.js (for API functions)
   const sourceType = source === 'eng' ? 'eng' : 'dll';
@@ -793,8 +902,8 @@ function computeFunctionApi(func, source) {
     
     return {
       original: func.original,
-      definition: `{ "${jsName}", sf_${source}_${func.name} }`,
-      body: `// nodemod.${source}.${jsName}();\n${generator.generateCppFunction(func, source === 'eng' ? 'g_engfuncs' : 'gpGamedllFuncs->dllapi_table', `sf_${source}`)}`,
+      definition,
+      body: `// nodemod.${source}.${jsName}();\n${body}`,
       typing: `${jsName}(${paramTypes.join(', ')}): ${customReturnType}`
     };
   }
@@ -843,8 +952,8 @@ function computeFunctionApi(func, source) {
   
   return {
     original: func.original,
-    definition: `{ "${camelize(func.name.replace(/^pfn/, ''))}", sf_${source}_${func.name} }`,
-    body: `// nodemod.${source}.${jsName}(${paramTypes.join(', ')});\n${generator.generateCppFunction(func, source === 'eng' ? 'g_engfuncs' : 'gpGamedllFuncs->dllapi_table', `sf_${source}`)}`,
+    definition,
+    body: `// nodemod.${source}.${jsName}(${paramTypes.join(', ')});\n${body}`,
     typing: `${jsName}(${paramTypes.join(', ')}): ${returnType}`
   };
 }
@@ -864,6 +973,14 @@ function tc(original, f) {
 
 function computeEventInterface(func, prefix) {
   const eventName = getEventName(func, prefix);
+  const remarks = [
+    (prefix === 'eng' || prefix === 'postEng') && generator.hasFastOverload(func)
+      ? `Not fired for calls that V8 routes through the fast API overload of ${func.name}, which only optimized callers use: listeners may or may not run depending on the JIT tier, and their return values are not applied. Do not rely on this event for nodemod.eng calls.`
+      : '',
+    /^(const\s+)?char\s*\*$/.test((func.type || '').trim())
+      ? 'A string returned by a listener is copied into per-frame storage and is only valid until the next StartFrame.'
+      : ''
+  ].filter(Boolean).join(' ') || undefined;
   
   // Check for custom TypeScript definitions in customs.js
   const sourceType = prefix.startsWith('post') ? prefix.replace('post', '').toLowerCase() : prefix;
@@ -878,7 +995,8 @@ function computeEventInterface(func, prefix) {
       name: eventName,
       parameters,
       signature,
-      hasVariadic: false
+      hasVariadic: false,
+      remarks
     };
   }
   
@@ -913,7 +1031,8 @@ function computeEventInterface(func, prefix) {
     return {
       name: eventName,
       parameters: [],
-      signature: '() => void'
+      signature: '() => void',
+      remarks
     };
   }
 
@@ -938,7 +1057,8 @@ function computeEventInterface(func, prefix) {
     name: eventName,
     parameters,
     signature,
-    hasVariadic
+    hasVariadic,
+    remarks
   };
 }
 
@@ -1025,6 +1145,9 @@ function parseStructureProperties(content, structureName) {
   // Parse new accessor pattern - ACCESSOR_T, ACCESSORL_T macros
   const accessorRegex = /ACCESSOR(?:L)?_T\([^,]+,\s*[^,]+,\s*[^,]+,\s*"([^"]+)",\s*([^,]+),\s*([^,]+),\s*([^)]+)\);/g;
   
+  // Parse VECTOR_ACCESSOR_T macro calls - live views over the engine's vec3_t
+  const vectorAccessorRegex = /VECTOR_ACCESSOR_T\([^,]+,\s*[^,]+,\s*[^,]+,\s*(\w+)\);/g;
+
   // Parse manual SetNativeDataProperty calls
   const manualAccessorRegex = /templ->SetNativeDataProperty\(v8::String::NewFromUtf8\(isolate,\s*"([^"]+)"\)\.ToLocalChecked\(\)/g;
   
@@ -1251,6 +1374,15 @@ function parseStructureProperties(content, structureName) {
     propertyMap.set(propName, { type: tsType, sourceLine });
   }
   
+  while ((match = vectorAccessorRegex.exec(content)) !== null) {
+    const propName = match[1];
+    propertyMap.set(propName, {
+      type: 'Float32Array',
+      setterType: 'number[] | Float32Array',
+      sourceLine: 'Live view of the vec3_t: writes go to the entity and reads see engine updates. Copy it (Array.from, slice) to keep a value'
+    });
+  }
+
   // Look for variable assignments that are arrays (for multi-line array creation)
   const arrayVarRegex = /v8::Local<v8::Array>\s+(\w+Array)\s*=/g;
   const arraySetRegex = new RegExp(`obj->Set\\(context,\\s*v8::String::NewFromUtf8\\(isolate,\\s*"([^"]+)"\\)[^,]*,\\s*(\\w+Array)\\)`, 'g');
@@ -1279,6 +1411,7 @@ function parseStructureProperties(content, structureName) {
     properties.push({
       name: propName,
       type: info.type,
+      setterType: info.setterType,
       comment: info.sourceLine
     });
   }
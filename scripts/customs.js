@@ -3,9 +3,8 @@ export default {
     pfnClientCommand: {
       event: {
         argsString: 'edict_t* ed, const char *szFmt, ...',
-        body: `unsigned int v8_argCount = 2;
-  v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
-  v8_args[0] = structures::wrapEntity(isolate, ed);
+        argCount: 2,
+        body: `v8_args[0] = structures::wrapEntity(isolate, ed);
   v8_args[1] = v8::String::NewFromUtf8(isolate, CMD_ARGS()).ToLocalChecked();`
       },
       typescript: {
@@ -15,12 +14,22 @@ export default {
         ]
       },
       api: {
-        body: `(*g_engfuncs.pfnClientCommand)(structures::unwrapEntity(isolate, info[0]), utils::js2string(isolate, info[1]));`
+        body: `(*g_engfuncs.pfnClientCommand)(structures::unwrapEntity(isolate, info[0]), arena::frameString(isolate, info[1]));`
+      }
+    },
+    pfnSetOrigin: {
+      postEvent: {
+        afterBody: 'spatial::touch(e);'
+      }
+    },
+    pfnSetSize: {
+      postEvent: {
+        afterBody: 'spatial::touch(e);'
       }
     },
     pfnAlertMessage: {
       api: {
-        body: `(*g_engfuncs.pfnAlertMessage)((ALERT_TYPE)info[0]->Int32Value(context).ToChecked(), "%s", utils::js2string(isolate, info[1]));`
+        body: `(*g_engfuncs.pfnAlertMessage)((ALERT_TYPE)info[0]->Int32Value(context).ToChecked(), "%s", arena::frameString(isolate, info[1]));`
       }
     },
     pfnIndexOfEdict: {
@@ -30,7 +39,9 @@ export default {
     info.GetReturnValue().Set(v8::Number::New(isolate, -1));
     return;
   }
-  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnIndexOfEdict)(ent)));`
+  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnIndexOfEdict)(ent)));`,
+        fast: `edict_t* ent = structures::unwrapEntity(isolate, pEdict);
+  return ent == NULL ? -1 : (*g_engfuncs.pfnIndexOfEdict)(ent);`
       }
     },
     pfnCVarRegister: {
@@ -85,16 +96,25 @@ export default {
     },
     pfnCvar_DirectSet: {
       api: {
-        body: `(*g_engfuncs.pfnCvar_DirectSet)((cvar_t*)structures::unwrapCvar(isolate, info[0]), utils::js2string(isolate, info[1]));`
+        body: `(*g_engfuncs.pfnCvar_DirectSet)((cvar_t*)structures::unwrapCvar(isolate, info[0]), arena::frameString(isolate, info[1]));`
       }
     },
     pfnEngineFprintf: {
       api: {
-        body: `fprintf((FILE*)utils::jsToPointer(isolate, info[0]), "%s", utils::js2string(isolate, info[1]));`
+        body: `fprintf((FILE*)utils::jsToPointer(isolate, info[0]), "%s", arena::frameString(isolate, info[1]));`
       }
     },
     pfnMessageBegin: {
       api: true,
+      preEvent: {
+        beforeBody: `if (messages::replaying) return;
+    if (messages::begin(msg_dest, msg_type, pOrigin, ed)) SET_META_RESULT(MRES_SUPERCEDE);`
+      },
+      // The assembled message is replayed through these hooks; pre and post listeners
+      // already saw it while it was recorded, the same goes for Write* and MessageEnd
+      postEvent: {
+        beforeBody: 'if (messages::replaying) return;'
+      },
       typescript: {
         parameters: [
           { name: 'msg_dest', type: 'number', originalType: 'int' },
@@ -104,6 +124,87 @@ export default {
         ]
       }
     },
+    pfnMessageEnd: {
+      preEvent: {
+        beforeBody: 'if (messages::replaying) return;',
+        afterBody: 'if (messages::end()) SET_META_RESULT(MRES_SUPERCEDE);'
+      },
+      postEvent: {
+        beforeBody: 'if (messages::replaying) return;'
+      }
+    },
+    pfnWriteByte: {
+      preEvent: {
+        beforeBody: `if (messages::replaying) return;
+    if (messages::writeInt(messages::Field::Byte, iValue)) SET_META_RESULT(MRES_SUPERCEDE);`
+      },
+      postEvent: {
+        beforeBody: 'if (messages::replaying) return;'
+      }
+    },
+    pfnWriteChar: {
+      preEvent: {
+        beforeBody: `if (messages::replaying) return;
+    if (messages::writeInt(messages::Field::Char, iValue)) SET_META_RESULT(MRES_SUPERCEDE);`
+      },
+      postEvent: {
+        beforeBody: 'if (messages::replaying) return;'
+      }
+    },
+    pfnWriteShort: {
+      preEvent: {
+        beforeBody: `if (messages::replaying) return;
+    if (messages::writeInt(messages::Field::Short, iValue)) SET_META_RESULT(MRES_SUPERCEDE);`
+      },
+      postEvent: {
+        beforeBody: 'if (messages::replaying) return;'
+      }
+    },
+    pfnWriteLong: {
+      preEvent: {
+        beforeBody: `if (messages::replaying) return;
+    if (messages::writeInt(messages::Field::Long, iValue)) SET_META_RESULT(MRES_SUPERCEDE);`
+      },
+      postEvent: {
+        beforeBody: 'if (messages::replaying) return;'
+      }
+    },
+    pfnWriteAngle: {
+      preEvent: {
+        beforeBody: `if (messages::replaying) return;
+    if (messages::writeFloat(messages::Field::Angle, flValue)) SET_META_RESULT(MRES_SUPERCEDE);`
+      },
+      postEvent: {
+        beforeBody: 'if (messages::replaying) return;'
+      }
+    },
+    pfnWriteCoord: {
+      preEvent: {
+        beforeBody: `if (messages::replaying) return;
+    if (messages::writeFloat(messages::Field::Coord, flValue)) SET_META_RESULT(MRES_SUPERCEDE);`
+      },
+      postEvent: {
+        beforeBody: 'if (messages::replaying) return;'
+      }
+    },
+    pfnWriteString: {
+      preEvent: {
+        beforeBody: `if (messages::replaying) return;
+    if (messages::writeString(sz)) SET_META_RESULT(MRES_SUPERCEDE);`
+      },
+      postEvent: {
+        beforeBody: 'if (messages::replaying) return;'
+      }
+    },
+    pfnWriteEntity: {
+      preEvent: {
+        beforeBody: `if (messages::replaying) return;
+    if (messages::writeInt(messages::Field::Entity, iValue)) SET_META_RESULT(MRES_SUPERCEDE);`
+      },
+      postEvent: {
+        beforeBody: 'if (messages::replaying) return;'
+      }
+    },
     pfnTraceLine: {
       api: {
         body: `// Allocate TraceResult on stack
@@ -256,7 +357,7 @@ structures::unwrapEntity(isolate, info[4]),
     pfnLoadFileForMe: {
       api: {
         body: `int fileLength = 0;
-  byte* result = (*g_engfuncs.pfnLoadFileForMe)(utils::js2string(isolate, info[0]), &fileLength);
+  byte* result = (*g_engfuncs.pfnLoadFileForMe)(arena::frameString(isolate, info[0]), &fileLength);
   if (result && fileLength > 0) {
     auto jsArray = utils::byteArrayToJS(isolate, result, fileLength);
     (*g_engfuncs.pfnFreeFile)(result);
@@ -374,7 +475,8 @@ structures::unwrapEntity(isolate, info[4]),
   };
   
   //printf("[DEBUG] Calling pfnAddServerCommand for '%s'\\n", cmdName.c_str());
-  (*g_engfuncs.pfnAddServerCommand)(cmdName.c_str(), wrapperFunction);
+  // The engine keeps the name pointer for as long as the command exists
+  (*g_engfuncs.pfnAddServerCommand)(arena::persistentString(isolate, info[0]), wrapperFunction);
   //printf("[DEBUG] pfnAddServerCommand completed for '%s'\\n", cmdName.c_str());`
       },
       typescript: {
@@ -391,8 +493,8 @@ structures::unwrapEntity(isolate, info[4]),
   char* infobuffer = (*g_engfuncs.pfnGetInfoKeyBuffer)(entity);
   (*g_engfuncs.pfnSetClientKeyValue)(clientIndex,
     infobuffer,
-    utils::js2string(isolate, info[2]),
-    utils::js2string(isolate, info[3]));`
+    arena::frameString(isolate, info[2]),
+    arena::frameString(isolate, info[3]));`
       },
       typescript: {
         parameters: [
@@ -505,7 +607,43 @@ structures::unwrapEntity(isolate, info[4]),
       }
     }
   },
+  // Events fired by nodemod itself rather than by an engine/DLL table hook
+  native: {
+    engMessage: {
+      typescript: {
+        parameters: [
+          { name: 'msg_dest', type: 'number', originalType: 'int' },
+          { name: 'msg_type', type: 'number', originalType: 'int' },
+          { name: 'origin', type: 'number[] | null', originalType: 'const float *' },
+          { name: 'entity', type: 'Entity | null', originalType: 'edict_t *' },
+          { name: 'buffer', type: 'ArrayBuffer', originalType: 'messages::Field stream' },
+          { name: 'fieldCount', type: 'number', originalType: 'unsigned int' }
+        ],
+        returns: 'void | boolean | ArrayBuffer | ArrayBufferView'
+      }
+    },
+    cvarChanged: {
+      typescript: {
+        parameters: [
+          { name: 'name', type: 'string', originalType: 'const char *' },
+          { name: 'value', type: 'string', originalType: 'const char *' },
+          { name: 'previous', type: 'string', originalType: 'const char *' }
+        ],
+        returns: 'void'
+      }
+    }
+  },
   dll: {
+    pfnServerActivate: {
+      preEvent: {
+        beforeBody: 'nodeImpl.ServerActivate(pEdictList, edictCount, clientMax);'
+      }
+    },
+    pfnServerDeactivate: {
+      preEvent: {
+        beforeBody: 'stringtable::clear();\n    nodeImpl.ServerDeactivate();'
+      }
+    },
     pfnPlayerCustomization: {
       postEvent: {
         afterBody: 'storePlayerCustomization(pEntity, pCustom);'
@@ -519,9 +657,12 @@ structures::unwrapEntity(isolate, info[4]),
     pfnClientCommand: {
       event: {
         argsString: 'edict_t* ed',
-        body: `unsigned int v8_argCount = 2;
-  v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
-  v8_args[0] = structures::wrapEntity(isolate, ed);
+        argCount: 2,
+        // Filters on argument 1 see the command name only
+        nativeArgs: 'ed, CMD_ARGV(0)',
+        // Batched records hold the same pair
+        batchArgs: 'ed, CMD_ARGV(0)',
+        body: `v8_args[0] = structures::wrapEntity(isolate, ed);
 
   // refactor it str hell
   if (CMD_ARGC() > 1) {
@@ -391,7 +391,9 @@ const fileMaker = {
           const hasParams = event.parameters.length > 0;
           const paramSignature = event.parameters.map(p => `${p.name}: ${p.type}`).join(', ');
           
-          return `    /**\n     * Event handler for ${event.name}\n${hasParams ? paramDocs + '\n' : ''}     */\n    "${event.name}": (${paramSignature}${event.hasVariadic ? ', ...args: any[]' : ''}) => void;`;
+          const remarks = event.remarks ? `     * @remarks ${event.remarks}\n` : '';
+
+          return `    /**\n     * Event handler for ${event.name}\n${hasParams ? paramDocs + '\n' : ''}${remarks}     */\n    "${event.name}": (${paramSignature}${event.hasVariadic ? ', ...args: any[]' : ''}) => ${event.returns || 'void'};`;
         }),
         '  }',
         '}'
@@ -407,6 +409,9 @@ const fileMaker = {
             return `    ${prop};`;
           } else {
             const propComment = prop.comment ? `    /** ${prop.comment} */\n` : '';
+            if (prop.setterType) {
+              return `${propComment}    get ${prop.name}(): ${prop.type};\n    set ${prop.name}(value: ${prop.setterType});`;
+            }
             return `${propComment}    ${prop.name}: ${prop.type};`;
           }
         }).join('\n\n');
@@ -430,8 +435,59 @@ const fileMaker = {
         '/// <reference path="./enums.d.ts" />',
         '',
         'declare namespace nodemod {',
+        '  /** Results of traceLines / traceHulls, one entry (or 3 floats) per trace */',
+        '  interface TraceBatch {',
+        '    fraction: Float32Array;',
+        '    endpos: Float32Array;',
+        '    normal: Float32Array;',
+        '    /** Entity index, -1 for none */',
+        '    hit: Int32Array;',
+        '  }',
+        '',
+        '  /** nodemod.eng.batch opcodes, each followed by its operand words */',
+        '  const enum BATCH {',
+        '    /** dest, type, entity */',
+        '    MESSAGE_BEGIN = 0,',
+        '    /** dest, type, x, y, z, entity */',
+        '    MESSAGE_BEGIN_ORIGIN = 1,',
+        '    MESSAGE_END = 2,',
+        '    WRITE_BYTE = 3,',
+        '    WRITE_CHAR = 4,',
+        '    WRITE_SHORT = 5,',
+        '    WRITE_LONG = 6,',
+        '    WRITE_ENTITY = 7,',
+        '    /** float */',
+        '    WRITE_ANGLE = 8,',
+        '    /** float */',
+        '    WRITE_COORD = 9,',
+        '    /** string */',
+        '    WRITE_STRING = 10,',
+        '    /** entity, x, y, z */',
+        '    SET_ORIGIN = 11,',
+        '    /** entity, mins x, y, z, maxs x, y, z */',
+        '    SET_SIZE = 12,',
+        '    /** entity, model string */',
+        '    SET_MODEL = 13,',
+        '    /** entity, channel, sample string, volume, attenuation, flags, pitch */',
+        '    EMIT_SOUND = 14,',
+        '    /** entity, x, y, z, sample string, volume, attenuation, flags, pitch */',
+        '    EMIT_AMBIENT_SOUND = 15',
+        '  }',
+        '',
         `  interface Engine {`,
         computed.eng.map(v => `    /** ${v.api.original} */\n    ${v.api.typing};`).join('\n'),
+        '    /**',
+        '     * Runs a buffer of engine calls in one native call. Words are int32, floats are',
+        '     * float32 bits, entities are indices (-1 for null), strings index into `strings`.',
+        '     * Returns the number of commands run',
+        '     */',
+        '    batch(commands: ArrayBuffer | ArrayBufferView, strings?: string[]): number;',
+        '    /**',
+        '     * N traces in one native call. starts and ends hold 3N floats; ignore is an entity',
+        '     * index for all traces or one per trace (-1 for none). Pass a previous result as out to reuse it',
+        '     */',
+        '    traceLines(starts: Float32Array, ends: Float32Array, flags: number, ignore?: number | Int32Array | null, out?: TraceBatch): TraceBatch;',
+        '    traceHulls(starts: Float32Array, ends: Float32Array, flags: number, hull: number, ignore?: number | Int32Array | null, out?: TraceBatch): TraceBatch;',
         `  }`,
         `  const eng: Engine;`,
         '}'
@@ -535,15 +591,123 @@ const fileMaker = {
         '  const time: number;',
         '  const frametime: number;',
         '',
+        '  // Player columns refreshed on every StartFrame. Row i is player slot i (entity index i + 1),',
+        '  // vector columns hold 3 floats per row. The arrays are the same objects for the whole session',
+        '  interface PlayerSnapshot {',
+        '    slots: number;',
+        '    /** 1 for a connected player, the other columns are stale otherwise */',
+        '    connected: Int32Array;',
+        '    team: Int32Array;',
+        '    flags: Int32Array;',
+        '    button: Int32Array;',
+        '    health: Float32Array;',
+        '    armor: Float32Array;',
+        '    origin: Float32Array;',
+        '    velocity: Float32Array;',
+        '    angles: Float32Array;',
+        '  }',
+        '  const snapshot: PlayerSnapshot;',
+        '',
         '  // Event system functions',
         '  function on<T extends keyof EventCallbacks>(eventName: T, callback: EventCallbacks[T]): void;',
         '  function addEventListener<T extends keyof EventCallbacks>(eventName: T, callback: EventCallbacks[T]): void;',
         '  function addListener<T extends keyof EventCallbacks>(eventName: T, callback: EventCallbacks[T]): void;',
+        '',
+        '  // Native listener filters, checked before JS is entered. `arg` is the callback argument index',
+        '  interface EventFilter {',
+        '    arg: number;',
+        '    /** Number, string or entity index equality */',
+        '    equals?: number | string;',
+        '    /** String argument starts with */',
+        '    prefix?: string;',
+        '    /** (value & mask) != 0 */',
+        '    mask?: number;',
+        '    /** Entity argument classname equals */',
+        '    classname?: string;',
+        '  }',
+        '  function on<T extends keyof EventCallbacks>(eventName: T, filter: EventFilter | EventFilter[], callback: EventCallbacks[T]): void;',
+        '  function addEventListener<T extends keyof EventCallbacks>(eventName: T, filter: EventFilter | EventFilter[], callback: EventCallbacks[T]): void;',
+        '  function addListener<T extends keyof EventCallbacks>(eventName: T, filter: EventFilter | EventFilter[], callback: EventCallbacks[T]): void;',
+        '',
         '  function removeListener<T extends keyof EventCallbacks>(eventName: T, callback: EventCallbacks[T]): void;',
         '  function removeEventListener<T extends keyof EventCallbacks>(eventName: T, callback: EventCallbacks[T]): void;',
         '  function clearListeners(eventName?: keyof EventCallbacks): void;',
         '  function fire<T extends keyof EventCallbacks>(eventName: T, ...args: Parameters<EventCallbacks[T]>): void;',
         '',
+        '  // Frame-batched delivery: every call of the frame in one typed-array batch, on StartFrame',
+        '  interface EventBatch {',
+        '    event: string;',
+        '    count: number;',
+        '    /** Integers, entity indices (-1 for null) and indices into strings, intStride per call */',
+        '    ints: Int32Array;',
+        '    /** Floats and vectors (3 floats each), floatStride per call */',
+        '    floats: Float32Array;',
+        '    strings: string[];',
+        '    intStride: number;',
+        '    floatStride: number;',
+        '  }',
+        '  function onBatched(eventName: keyof EventCallbacks, callback: (batch: EventBatch) => void): boolean;',
+        '  function offBatched(eventName: keyof EventCallbacks, callback?: (batch: EventBatch) => void): void;',
+        '',
+        '  // Dispatch profiling, sorted by total time. Histogram bucket 0 is under 1us, bucket n under 2^n us',
+        '  interface StatsCounter {',
+        '    calls: number;',
+        '    totalNs: number;',
+        '    maxNs: number;',
+        '    histogram: number[];',
+        '  }',
+        '  interface ListenerStats extends StatsCounter {',
+        '    name: string;',
+        '    script: string;',
+        '    line: number;',
+        '  }',
+        '  interface EventStats extends StatsCounter {',
+        '    name: string;',
+        '    listeners: ListenerStats[];',
+        '  }',
+        '  interface HamStats extends EventStats {',
+        '    entity: string;',
+        '    post: boolean;',
+        '  }',
+        '  /** Pass true to reset the counters after reading them */',
+        '  function stats(reset?: boolean): { events: EventStats[]; ham: HamStats[] };',
+        '',
+        '  // Native entity search, one pass over the edict table. Every given criterion must hold',
+        '  interface EntityQuery {',
+        '    classname?: string;',
+        '    /** (flags & flagsMask) != 0 */',
+        '    flagsMask?: number;',
+        '    movetype?: number;',
+        '    solid?: number;',
+        '    owner?: Entity | number | null;',
+        '    /** Overlap with the entity absmin/absmax */',
+        '    bbox?: { mins: number[] | Float32Array; maxs: number[] | Float32Array };',
+        '    /** Return the number of matches instead of the indices */',
+        '    count?: boolean;',
+        '  }',
+        '  function query(criteria: EntityQuery & { count: true }): number;',
+        '  function query(criteria: EntityQuery): Int32Array;',
+        '',
+        '  // Grid index over entity bounds, kept up to date per frame and on SetOrigin/SetSize.',
+        '  // Distances are to the closest point of the bounds; results are entity indices',
+        '  interface Spatial {',
+        '    inSphere(origin: number[] | Float32Array, radius: number): Int32Array;',
+        '    inBox(mins: number[] | Float32Array, maxs: number[] | Float32Array): Int32Array;',
+        '    /** Up to k entities, closest first, optionally within radius */',
+        '    nearest(origin: number[] | Float32Array, k?: number, radius?: number): Int32Array;',
+        '  }',
+        '  const spatial: Spatial;',
+        '',
+        '  // Direct view of an engine cvar. Changes to cvars with a handle fire cvarChanged',
+        '  interface CvarHandle {',
+        '    readonly name: string;',
+        '    float: number;',
+        '    string: string;',
+        '    readonly flags: number;',
+        '  }',
+        '  /** null when the engine has no such cvar; repeated lookups return the same handle */',
+        '  function cvar(name: string): CvarHandle | null;',
+        '',
         '  // Utility functions',
         '  function getUserMsgId(msgName: string): number;',
         '  function getUserMsgName(msgId: number): string;',
@@ -574,16 +738,25 @@ const fileMaker = {
       [
         '#include <string>',
         '#include "v8.h"',
+        ...(source === 'eng' ? ['#include "v8-fast-api-calls.h"'] : []),
         '#include "extdll.h"',
         source === 'eng' ? '#include "enginecallback.h"' : '#include "meta_api.h"',
         '#include "node/nodeimpl.hpp"',
         '#include "node/utils.hpp"',
+        '#include "node/arena.hpp"',
+        ...(source === 'eng' ? ['#include "node/events.hpp"'] : []),
         '',
         '#define V8_STUFF() v8::Isolate* isolate = info.GetIsolate(); \\',
-        '  v8::Locker locker(isolate); \\',
+        '  V8_ASSERT_LOCKED(isolate); \\',
         '  v8::HandleScope scope(isolate); \\',
         '  v8::Local<v8::Context> context = isolate->GetCurrentContext()',
         '',
+        ...(source === 'eng' ? [
+          '#define V8_FAST_STUFF() v8::Isolate* isolate = options.isolate; \\',
+          '  V8_ASSERT_LOCKED(isolate); \\',
+          '  v8::HandleScope scope(isolate)',
+          ''
+        ] : []),
         '#include "structures/structures.hpp"'
       ].join('\n'),
       '',
@@ -592,7 +765,7 @@ const fileMaker = {
       computed.filter(v => v.status === 'success').map(v => v.body).join('\n\n'),
       '',
       fileMaker.makeBlock(
-        `static std::pair<std::string, v8::FunctionCallback> ${source === 'eng' ? 'engine' : 'gamedll'}SpecificFunctions[] =`,
+        `static utils::NativeFunction ${source === 'eng' ? 'engine' : 'gamedll'}SpecificFunctions[] =`,
         computed.filter(v => v.status === 'success').map(v => v.definition).join(',\n')
       ),
       fileMaker.makeBlock(
@@ -601,7 +774,7 @@ const fileMaker = {
           'v8::Local <v8::ObjectTemplate> object = v8::ObjectTemplate::New(isolate);',
           fileMaker.makeBlock(
             `for (auto &routine : ${source === 'eng' ? 'engine' : 'gamedll'}SpecificFunctions)`,
-            'object-> Set(v8::String::NewFromUtf8(isolate, routine.first.c_str(), v8::NewStringType::kNormal).ToLocalChecked(), v8::FunctionTemplate::New(isolate, routine.second));'
+            'object-> Set(v8::String::NewFromUtf8(isolate, routine.name.c_str(), v8::NewStringType::kNormal).ToLocalChecked(), v8::FunctionTemplate::New(isolate, routine.callback, v8::Local<v8::Value>(), v8::Local<v8::Signature>(), 0, v8::ConstructorBehavior::kAllow, v8::SideEffectType::kHasSideEffect, routine.fast));'
           ),
           '',
           'return object;'
@@ -5,19 +5,19 @@ const TYPE_MAPPINGS = {
   // Basic types - js2cpp and cpp2js mappings
   basicTypes: {
     'const char *': { 
-      js2cpp: (value) => `utils::js2string(isolate, ${value})`,
+      js2cpp: (value, paramName, persistent) => persistent ? `arena::persistentString(isolate, ${value})` : `arena::frameString(isolate, ${value})`,
       cpp2js: (value) => `v8::String::NewFromUtf8(isolate, ${value} ? ${value} : "").ToLocalChecked()`
     },
     'const char*': { 
-      js2cpp: (value) => `utils::js2string(isolate, ${value})`,
+      js2cpp: (value, paramName, persistent) => persistent ? `arena::persistentString(isolate, ${value})` : `arena::frameString(isolate, ${value})`,
       cpp2js: (value) => `v8::String::NewFromUtf8(isolate, ${value} ? ${value} : "").ToLocalChecked()`
     },
     'char *': { 
-      js2cpp: (value) => `utils::js2string(isolate, ${value})`,
+      js2cpp: (value, paramName, persistent) => persistent ? `const_cast<char*>(arena::persistentString(isolate, ${value}))` : `arena::frameBuffer(isolate, ${value})`,
       cpp2js: (value) => `v8::String::NewFromUtf8(isolate, ${value} ? ${value} : "").ToLocalChecked()`
     },
     'char*': { 
-      js2cpp: (value) => `utils::js2string(isolate, ${value})`,
+      js2cpp: (value, paramName, persistent) => persistent ? `const_cast<char*>(arena::persistentString(isolate, ${value}))` : `arena::frameBuffer(isolate, ${value})`,
       cpp2js: (value) => `v8::String::NewFromUtf8(isolate, ${value} ? ${value} : "").ToLocalChecked()`
     },
     'char': { 
@@ -152,6 +152,24 @@ const TYPE_MAPPINGS = {
     'TraceResult': { unwrap: 'structures::unwrapTraceResult', wrap: 'structures::wrapTraceResult' }
   },
 
+  // Fast API (v8::CFunction) types. Numbers and booleans only: fast calls get
+  // unboxed arguments and must return a primitive
+  fastTypes: {
+    'char': { ctype: 'int32_t' },
+    'int': { ctype: 'int32_t' },
+    'unsigned int': { ctype: 'uint32_t' },
+    'float': { ctype: 'double' },
+    'double': { ctype: 'double' },
+    'unsigned char': { ctype: 'int32_t' },
+    'unsigned short': { ctype: 'int32_t' },
+    'byte': { ctype: 'int32_t' },
+    'qboolean': { ctype: 'bool', js2cpp: (value) => `(qboolean)${value}` },
+    'ALERT_TYPE': { ctype: 'int32_t', js2cpp: (value) => `(ALERT_TYPE)${value}` },
+    'FORCE_TYPE': { ctype: 'int32_t', js2cpp: (value) => `(FORCE_TYPE)${value}` },
+    'PRINT_TYPE': { ctype: 'int32_t', js2cpp: (value) => `(PRINT_TYPE)${value}` },
+    'CRC32_t': { ctype: 'uint32_t' }
+  },
+
   // Pointer type mappings
   pointerMappings: {
     'float': { 
@@ -163,7 +181,7 @@ const TYPE_MAPPINGS = {
       cpp2js: (value) => `v8::Number::New(isolate, *${value})` // Most int* in HLSDK are single output values
     },
     'char *': { 
-      js2cpp: (value) => `utils::js2string(isolate, ${value})`,
+      js2cpp: (value) => `arena::frameString(isolate, ${value})`,
       cpp2js: (value) => `v8::String::NewFromUtf8(isolate, ${value} ? ${value} : "").ToLocalChecked()`
     },
     'void': { 
@@ -189,6 +207,49 @@ const TYPE_MAPPINGS = {
   }
 };
 
+// Engine functions that keep the string pointer past the call (precache
+// tables, models, light styles, message names): their strings are interned
+const PERSISTENT_STRING_FUNCTIONS = new Set([
+  'pfnPrecacheModel',
+  'pfnPrecacheSound',
+  'pfnPrecacheGeneric',
+  'pfnPrecacheEvent',
+  'pfnSetModel',
+  'pfnLightStyle',
+  'pfnRegUserMsg'
+]);
+
+// Engine functions with V8 fast API overloads. Only calls that stay inside the
+// engine qualify: V8 forbids entering JS from a fast call, and anything that
+// reaches the game DLL (entity removal, movement, touch) or runs commands or
+// messages can end up in a Ham or JS callback. Events raised by nodemod's own
+// hooks on these calls skip their listeners and defer batch delivery, see
+// event::FastCallScope. V8 only takes the fast path from optimized code, so
+// whether eng/postEng listeners of these functions run depends on the JIT tier;
+// the generated event typings say so.
+const FAST_API_FUNCTIONS = new Set([
+  'pfnModelFrames',
+  'pfnChangeYaw',
+  'pfnChangePitch',
+  'pfnGetEntityIllum',
+  'pfnEntIsOnFloor',
+  'pfnEntOffsetOfPEntity',
+  'pfnIndexOfEdict',
+  'pfnCmd_Argc',
+  'pfnRandomLong',
+  'pfnRandomFloat',
+  'pfnTime',
+  'pfnNumberOfEntities',
+  'pfnGetPlayerUserId',
+  'pfnIsDedicatedServer',
+  'pfnGetPlayerWONId',
+  'pfnGetCurrentPlayer',
+  'pfnCanSkipPlayer',
+  'pfnVoice_GetClientListening',
+  'pfnIsCareerMatch',
+  'pfnGetTimesTutorMessageShown'
+]);
+
 // Helper function to normalize type strings
 function normalizeType(type) {
   return type.trim();
@@ -205,6 +266,11 @@ function isPointerType(type) {
   return type.includes('*');
 }
 
+// Helper function to check if a type is an entity pointer
+function isEntityType(type) {
+  return /^(?:const\s+)?(?:struct\s+)?edict_[st]\s*\*$/.test(type);
+}
+
 // Helper function to get struct mapping
 function getStructMapping(type, isJs2Cpp, value) {
   const structName = extractStructName(type);
@@ -237,13 +303,13 @@ function getPointerMapping(type, isJs2Cpp, value) {
 
 // Генератор транслейтов
 const generator = {
-  js2cpp(type, value, paramName = 'param') {
+  js2cpp(type, value, paramName = 'param', persistent = false) {
     const normalizedType = normalizeType(type);
 
     // Check basic types first
     const basicMapping = TYPE_MAPPINGS.basicTypes[normalizedType];
     if (basicMapping) {
-      return basicMapping.js2cpp(value, paramName);
+      return basicMapping.js2cpp(value, paramName, persistent);
     }
 
     // Try struct mapping
@@ -442,7 +508,7 @@ const generator = {
         // Regular parameter - use js2cpp conversion
         const argIndex = regularArgs.findIndex(pArg => pArg.name === arg.name);
         if (argIndex >= 0) {
-          return this.js2cpp(arg.type, `info[${argIndex}]`, arg.name);
+          return this.js2cpp(arg.type, `info[${argIndex}]`, arg.name, PERSISTENT_STRING_FUNCTIONS.has(func.name));
         } else {
           // This shouldn't happen, but provide a fallback
           return `nullptr /* missing parameter: ${arg.name} */`;
@@ -459,6 +525,67 @@ const generator = {
 ${effectiveNullCheckSection}
   ${customBody || this.packReturn(func, `(*${source}${source.includes('->') ? '->' : '.'}${func.name})(${callParams})`)};${customBody ? '' : cleanupCode}
 }`;
+  },
+
+  // Fast API overload of an sf_* callback that TurboFan-optimized code calls
+  // without building a FunctionCallbackInfo. Only for numeric, boolean and entity
+  // signatures; returns null for everything else. Functions with a custom api
+  // body need a custom api.fast body too.
+  hasFastOverload(func) {
+    return FAST_API_FUNCTIONS.has(func.name);
+  },
+
+  generateFastFunction(func, source, prefix) {
+    if (!this.hasFastOverload(func)) {
+      return null;
+    }
+
+    const customApi = customs[prefix.split('_')[1]]?.[func.name]?.api;
+    if (customApi?.body && !customApi.fast) {
+      return null;
+    }
+
+    const returnType = func.type === 'void' ? { ctype: 'void' } : TYPE_MAPPINGS.fastTypes[normalizeType(func.type)];
+    if (!returnType) {
+      return null;
+    }
+
+    const params = [];
+    for (const arg of func.args || []) {
+      const type = normalizeType(arg.type);
+      if (isEntityType(type)) {
+        params.push({ decl: `v8::Local<v8::Value> ${arg.name}`, value: `structures::unwrapEntity(isolate, ${arg.name})`, entity: true });
+        continue;
+      }
+
+      const mapping = TYPE_MAPPINGS.fastTypes[type];
+      if (!mapping) {
+        return null;
+      }
+      params.push({ decl: `${mapping.ctype} ${arg.name}`, value: mapping.js2cpp ? mapping.js2cpp(arg.name) : arg.name });
+    }
+
+    // Unwrapping entities needs the isolate and a handle scope
+    const needsIsolate = params.some(p => p.entity);
+    const decls = ['v8::Local<v8::Object> receiver', ...params.map(p => p.decl)];
+    if (needsIsolate) {
+      decls.push('v8::FastApiCallbackOptions& options');
+    }
+
+    const call = `(*${source}.${func.name})(${params.map(p => p.value).join(', ')})`;
+    const body = customApi?.fast || (returnType.ctype === 'void' ? `${call};` : `return ${call};`);
+    const name = `${prefix.replace(/^sf_/, 'ff_')}_${func.name}`;
+    const cfunction = `${prefix.replace(/^sf_/, 'cf_')}_${func.name}`;
+
+    return {
+      name: cfunction,
+      body: `${returnType.ctype} ${name}(${decls.join(', ')})
+{
+  event::FastCallScope fastCall;${needsIsolate ? '\n  V8_FAST_STUFF();' : ''}
+  ${body}
+}
+static const v8::CFunction ${cfunction} = v8::CFunction::Make(${name});`
+    };
   }
 }
 
@@ -3,6 +3,16 @@
   #include <string>
   #include "node/nodeimpl.hpp"
   #include "node/events.hpp"
+  #include "node/batch.hpp"
+  #include "node/trace.hpp"
+  #include "node/watchdog.hpp"
+  #include "node/arena.hpp"
+  #include "node/snapshot.hpp"
+  #include "node/spatial.hpp"
+  #include "node/cvars.hpp"
+  #include "node/stringtable.hpp"
+  #include "node/messages.hpp"
+  #include "lib/hooks.hpp"
   #include "meta_api.h"
   #include "node/utils.hpp"
   #include "structures/structures.hpp"
@@ -11,20 +21,20 @@
     // nodemod.on('dllGameInit', () => console.log('dllGameInit fired!'));
   void dll_pfnGameInit () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllGameInit", nullptr, 0);
+    if (!hooks::active(EventId::dllGameInit)) return;
+    event::findAndCall(EventId::dllGameInit, nullptr, 0);
   }
 
 // nodemod.on('dllSpawn', (pent) => console.log('dllSpawn fired!'));
   int dll_pfnSpawn (edict_t * pent) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllSpawn", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::dllSpawn)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::dllSpawn, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pent); // pent (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pent), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -32,87 +42,78 @@
 // nodemod.on('dllThink', (pent) => console.log('dllThink fired!'));
   void dll_pfnThink (edict_t * pent) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllThink", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::dllThink)) return;
+    batch::record(EventId::dllThink, pent);
+    event::findAndCall<1>(EventId::dllThink, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pent); // pent (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pent));
   }
 
 // nodemod.on('dllUse', (pentUsed, pentOther) => console.log('dllUse fired!'));
   void dll_pfnUse (edict_t * pentUsed, edict_t * pentOther) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllUse", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::dllUse)) return;
+    batch::record(EventId::dllUse, pentUsed, pentOther);
+    event::findAndCall<2>(EventId::dllUse, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pentUsed); // pentUsed (edict_t *)
       v8_args[1] = structures::wrapEntity(isolate, pentOther); // pentOther (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pentUsed, pentOther));
   }
 
 // nodemod.on('dllTouch', (pentTouched, pentOther) => console.log('dllTouch fired!'));
   void dll_pfnTouch (edict_t * pentTouched, edict_t * pentOther) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllTouch", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::dllTouch)) return;
+    batch::record(EventId::dllTouch, pentTouched, pentOther);
+    event::findAndCall<2>(EventId::dllTouch, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pentTouched); // pentTouched (edict_t *)
       v8_args[1] = structures::wrapEntity(isolate, pentOther); // pentOther (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pentTouched, pentOther));
   }
 
 // nodemod.on('dllBlocked', (pentBlocked, pentOther) => console.log('dllBlocked fired!'));
   void dll_pfnBlocked (edict_t * pentBlocked, edict_t * pentOther) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllBlocked", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::dllBlocked)) return;
+    batch::record(EventId::dllBlocked, pentBlocked, pentOther);
+    event::findAndCall<2>(EventId::dllBlocked, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pentBlocked); // pentBlocked (edict_t *)
       v8_args[1] = structures::wrapEntity(isolate, pentOther); // pentOther (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pentBlocked, pentOther));
   }
 
 // nodemod.on('dllKeyValue', (pentKeyvalue, pkvd) => console.log('dllKeyValue fired!'));
   void dll_pfnKeyValue (edict_t * pentKeyvalue, KeyValueData * pkvd) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllKeyValue", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::dllKeyValue)) return;
+    event::findAndCall<2>(EventId::dllKeyValue, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pentKeyvalue); // pentKeyvalue (edict_t *)
       v8_args[1] = structures::wrapKeyValueData(isolate, pkvd); // pkvd (KeyValueData *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pentKeyvalue, pkvd));
   }
 
 // nodemod.on('dllSave', (pent, pSaveData) => console.log('dllSave fired!'));
   void dll_pfnSave (edict_t * pent, SAVERESTOREDATA * pSaveData) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllSave", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::dllSave)) return;
+    event::findAndCall<2>(EventId::dllSave, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pent); // pent (edict_t *)
       v8_args[1] = structures::wrapSaveRestoreData(isolate, pSaveData); // pSaveData (SAVERESTOREDATA *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pent, pSaveData));
   }
 
 // nodemod.on('dllRestore', (pent, pSaveData, globalEntity) => console.log('dllRestore fired!'));
   int dll_pfnRestore (edict_t * pent, SAVERESTOREDATA * pSaveData, int globalEntity) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllRestore", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::dllRestore)) return 0;
+    int returnValue{};
+    event::findAndCall<3>(EventId::dllRestore, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pent); // pent (edict_t *)
       v8_args[1] = structures::wrapSaveRestoreData(isolate, pSaveData); // pSaveData (SAVERESTOREDATA *)
       v8_args[2] = v8::Number::New(isolate, globalEntity); // globalEntity (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pent, pSaveData, globalEntity), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -120,86 +121,77 @@
 // nodemod.on('dllSetAbsBox', (pent) => console.log('dllSetAbsBox fired!'));
   void dll_pfnSetAbsBox (edict_t * pent) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllSetAbsBox", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::dllSetAbsBox)) return;
+    batch::record(EventId::dllSetAbsBox, pent);
+    event::findAndCall<1>(EventId::dllSetAbsBox, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pent); // pent (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pent));
   }
 
 // nodemod.on('dllSaveWriteFields', (value0, value1, value2, value3, value4) => console.log('dllSaveWriteFields fired!'));
   void dll_pfnSaveWriteFields (SAVERESTOREDATA* value0, const char* value1, void* value2, TYPEDESCRIPTION* value3, int value4) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllSaveWriteFields", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 5;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[5];
+    if (!hooks::active(EventId::dllSaveWriteFields)) return;
+    event::findAndCall<5>(EventId::dllSaveWriteFields, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapSaveRestoreData(isolate, value0); // value0 (SAVERESTOREDATA*)
       v8_args[1] = v8::String::NewFromUtf8(isolate, value1 ? value1 : "").ToLocalChecked(); // value1 (const char*)
       v8_args[2] = v8::External::New(isolate, value2); // value2 (void*)
       v8_args[3] = structures::wrapTypeDescription(isolate, value3); // value3 (TYPEDESCRIPTION*)
       v8_args[4] = v8::Number::New(isolate, value4); // value4 (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(value0, value1, value2, value3, value4));
   }
 
 // nodemod.on('dllSaveReadFields', (value0, value1, value2, value3, value4) => console.log('dllSaveReadFields fired!'));
   void dll_pfnSaveReadFields (SAVERESTOREDATA* value0, const char* value1, void* value2, TYPEDESCRIPTION* value3, int value4) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllSaveReadFields", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 5;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[5];
+    if (!hooks::active(EventId::dllSaveReadFields)) return;
+    event::findAndCall<5>(EventId::dllSaveReadFields, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapSaveRestoreData(isolate, value0); // value0 (SAVERESTOREDATA*)
       v8_args[1] = v8::String::NewFromUtf8(isolate, value1 ? value1 : "").ToLocalChecked(); // value1 (const char*)
       v8_args[2] = v8::External::New(isolate, value2); // value2 (void*)
       v8_args[3] = structures::wrapTypeDescription(isolate, value3); // value3 (TYPEDESCRIPTION*)
       v8_args[4] = v8::Number::New(isolate, value4); // value4 (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(value0, value1, value2, value3, value4));
   }
 
 // nodemod.on('dllSaveGlobalState', (value0) => console.log('dllSaveGlobalState fired!'));
   void dll_pfnSaveGlobalState (SAVERESTOREDATA * value0) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllSaveGlobalState", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::dllSaveGlobalState)) return;
+    event::findAndCall<1>(EventId::dllSaveGlobalState, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapSaveRestoreData(isolate, value0); // value0 (SAVERESTOREDATA *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(value0));
   }
 
 // nodemod.on('dllRestoreGlobalState', (value0) => console.log('dllRestoreGlobalState fired!'));
   void dll_pfnRestoreGlobalState (SAVERESTOREDATA * value0) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllRestoreGlobalState", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::dllRestoreGlobalState)) return;
+    event::findAndCall<1>(EventId::dllRestoreGlobalState, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapSaveRestoreData(isolate, value0); // value0 (SAVERESTOREDATA *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(value0));
   }
 
 // nodemod.on('dllResetGlobalState', () => console.log('dllResetGlobalState fired!'));
   void dll_pfnResetGlobalState () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllResetGlobalState", nullptr, 0);
+    if (!hooks::active(EventId::dllResetGlobalState)) return;
+    event::findAndCall(EventId::dllResetGlobalState, nullptr, 0);
   }
 
 // nodemod.on('dllClientConnect', (pEntity, pszName, pszAddress, szRejectReason) => console.log('dllClientConnect fired!'));
   qboolean dll_pfnClientConnect (edict_t * pEntity, const char * pszName, const char * pszAddress, char* szRejectReason) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllClientConnect", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 4;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[4];
+    if (!hooks::active(EventId::dllClientConnect)) return 0;
+    qboolean returnValue{};
+    event::findAndCall<4>(EventId::dllClientConnect, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEntity); // pEntity (edict_t *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, pszName ? pszName : "").ToLocalChecked(); // pszName (const char *)
       v8_args[2] = v8::String::NewFromUtf8(isolate, pszAddress ? pszAddress : "").ToLocalChecked(); // pszAddress (const char *)
       v8_args[3] = v8::String::NewFromUtf8(isolate, szRejectReason ? szRejectReason : "").ToLocalChecked(); // szRejectReason (char*)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEntity, pszName, pszAddress, szRejectReason), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (qboolean)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -207,43 +199,40 @@
 // nodemod.on('dllClientDisconnect', (pEntity) => console.log('dllClientDisconnect fired!'));
   void dll_pfnClientDisconnect (edict_t * pEntity) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllClientDisconnect", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::dllClientDisconnect)) return;
+    batch::record(EventId::dllClientDisconnect, pEntity);
+    event::findAndCall<1>(EventId::dllClientDisconnect, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEntity); // pEntity (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEntity));
   }
 
 // nodemod.on('dllClientKill', (pEntity) => console.log('dllClientKill fired!'));
   void dll_pfnClientKill (edict_t * pEntity) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllClientKill", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::dllClientKill)) return;
+    batch::record(EventId::dllClientKill, pEntity);
+    event::findAndCall<1>(EventId::dllClientKill, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEntity); // pEntity (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEntity));
   }
 
 // nodemod.on('dllClientPutInServer', (pEntity) => console.log('dllClientPutInServer fired!'));
   void dll_pfnClientPutInServer (edict_t * pEntity) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllClientPutInServer", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::dllClientPutInServer)) return;
+    batch::record(EventId::dllClientPutInServer, pEntity);
+    event::findAndCall<1>(EventId::dllClientPutInServer, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEntity); // pEntity (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEntity));
   }
 
 // nodemod.on('dllClientCommand', (pEntity) => console.log('dllClientCommand fired!'));
   void dll_pfnClientCommand (edict_t* ed) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllClientCommand", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-  v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
-  v8_args[0] = structures::wrapEntity(isolate, ed);
+    if (!hooks::active(EventId::dllClientCommand)) return;
+    batch::record(EventId::dllClientCommand, ed, CMD_ARGV(0));
+    event::findAndCall<2>(EventId::dllClientCommand, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
+      v8_args[0] = structures::wrapEntity(isolate, ed);
 
   // refactor it str hell
   if (CMD_ARGC() > 1) {
@@ -253,88 +242,101 @@
   } else {
     v8_args[1] = v8::String::NewFromUtf8(isolate, CMD_ARGV(0)).ToLocalChecked();
   }
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(ed, CMD_ARGV(0)));
   }
 
 // nodemod.on('dllClientUserInfoChanged', (pEntity, infobuffer) => console.log('dllClientUserInfoChanged fired!'));
   void dll_pfnClientUserInfoChanged (edict_t * pEntity, char * infobuffer) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllClientUserInfoChanged", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::dllClientUserInfoChanged)) return;
+    batch::record(EventId::dllClientUserInfoChanged, pEntity, infobuffer);
+    event::findAndCall<2>(EventId::dllClientUserInfoChanged, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEntity); // pEntity (edict_t *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, infobuffer ? infobuffer : "").ToLocalChecked(); // infobuffer (char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEntity, infobuffer));
   }
 
 // nodemod.on('dllServerActivate', (pEdictList, edictCount, clientMax) => console.log('dllServerActivate fired!'));
   void dll_pfnServerActivate (edict_t * pEdictList, int edictCount, int clientMax) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllServerActivate", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::dllServerActivate)) return;
+    nodeImpl.ServerActivate(pEdictList, edictCount, clientMax);
+
+    batch::record(EventId::dllServerActivate, pEdictList, edictCount, clientMax);
+    event::findAndCall<3>(EventId::dllServerActivate, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdictList); // pEdictList (edict_t *)
       v8_args[1] = v8::Number::New(isolate, edictCount); // edictCount (int)
       v8_args[2] = v8::Number::New(isolate, clientMax); // clientMax (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdictList, edictCount, clientMax));
   }
 
 // nodemod.on('dllServerDeactivate', () => console.log('dllServerDeactivate fired!'));
   void dll_pfnServerDeactivate () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllServerDeactivate", nullptr, 0);
+    if (!hooks::active(EventId::dllServerDeactivate)) return;
+    stringtable::clear();
+    nodeImpl.ServerDeactivate();
+
+    event::findAndCall(EventId::dllServerDeactivate, nullptr, 0);
   }
 
 // nodemod.on('dllPlayerPreThink', (pEntity) => console.log('dllPlayerPreThink fired!'));
   void dll_pfnPlayerPreThink (edict_t * pEntity) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllPlayerPreThink", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::dllPlayerPreThink)) return;
+    batch::record(EventId::dllPlayerPreThink, pEntity);
+    event::findAndCall<1>(EventId::dllPlayerPreThink, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEntity); // pEntity (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEntity));
   }
 
 // nodemod.on('dllPlayerPostThink', (pEntity) => console.log('dllPlayerPostThink fired!'));
   void dll_pfnPlayerPostThink (edict_t * pEntity) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllPlayerPostThink", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::dllPlayerPostThink)) return;
+    batch::record(EventId::dllPlayerPostThink, pEntity);
+    event::findAndCall<1>(EventId::dllPlayerPostThink, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEntity); // pEntity (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEntity));
   }
 
 // pfnStartFrame - Run Node.js UV loop tick and fire event
   void dll_pfnStartFrame () {
     SET_META_RESULT(MRES_IGNORED);
+    trace::Scope frameScope(trace::StartFrame, trace::Category::Frame);
+    watchdog::frame();
+    hooks::frame();
+    arena::resetFrame();
+    snapshot::capture();
+    spatial::sweep();
+    batch::flush();
+    cvars::frame();
     nodeImpl.Tick();
-    event::findAndCall("dllStartFrame", nullptr, 0);
+    event::findAndCall(EventId::dllStartFrame, nullptr, 0);
   }
 
 // nodemod.on('dllParmsNewLevel', () => console.log('dllParmsNewLevel fired!'));
   void dll_pfnParmsNewLevel () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllParmsNewLevel", nullptr, 0);
+    if (!hooks::active(EventId::dllParmsNewLevel)) return;
+    event::findAndCall(EventId::dllParmsNewLevel, nullptr, 0);
   }
 
 // nodemod.on('dllParmsChangeLevel', () => console.log('dllParmsChangeLevel fired!'));
   void dll_pfnParmsChangeLevel () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllParmsChangeLevel", nullptr, 0);
+    if (!hooks::active(EventId::dllParmsChangeLevel)) return;
+    event::findAndCall(EventId::dllParmsChangeLevel, nullptr, 0);
   }
 
 // nodemod.on('dllGetGameDescription', () => console.log('dllGetGameDescription fired!'));
   const char * dll_pfnGetGameDescription () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllGetGameDescription", nullptr, 0);
+    if (!hooks::active(EventId::dllGetGameDescription)) return nullptr;
+    const char * returnValue{};
+    event::findAndCall(EventId::dllGetGameDescription, nullptr, 0, event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (const char *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -342,93 +344,82 @@
 // nodemod.on('dllPlayerCustomization', (pEntity, pCustom) => console.log('dllPlayerCustomization fired!'));
   void dll_pfnPlayerCustomization (edict_t * pEntity, customization_t * pCustom) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllPlayerCustomization", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::dllPlayerCustomization)) return;
+    event::findAndCall<2>(EventId::dllPlayerCustomization, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEntity); // pEntity (edict_t *)
       v8_args[1] = structures::wrapCustomization(isolate, pCustom); // pCustom (customization_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEntity, pCustom));
   }
 
 // nodemod.on('dllSpectatorConnect', (pEntity) => console.log('dllSpectatorConnect fired!'));
   void dll_pfnSpectatorConnect (edict_t * pEntity) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllSpectatorConnect", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::dllSpectatorConnect)) return;
+    batch::record(EventId::dllSpectatorConnect, pEntity);
+    event::findAndCall<1>(EventId::dllSpectatorConnect, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEntity); // pEntity (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEntity));
   }
 
 // nodemod.on('dllSpectatorDisconnect', (pEntity) => console.log('dllSpectatorDisconnect fired!'));
   void dll_pfnSpectatorDisconnect (edict_t * pEntity) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllSpectatorDisconnect", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::dllSpectatorDisconnect)) return;
+    batch::record(EventId::dllSpectatorDisconnect, pEntity);
+    event::findAndCall<1>(EventId::dllSpectatorDisconnect, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEntity); // pEntity (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEntity));
   }
 
 // nodemod.on('dllSpectatorThink', (pEntity) => console.log('dllSpectatorThink fired!'));
   void dll_pfnSpectatorThink (edict_t * pEntity) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllSpectatorThink", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::dllSpectatorThink)) return;
+    batch::record(EventId::dllSpectatorThink, pEntity);
+    event::findAndCall<1>(EventId::dllSpectatorThink, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEntity); // pEntity (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEntity));
   }
 
 // nodemod.on('dllSysError', (error_string) => console.log('dllSysError fired!'));
   void dll_pfnSys_Error (const char * error_string) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllSysError", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::dllSysError)) return;
+    batch::record(EventId::dllSysError, error_string);
+    event::findAndCall<1>(EventId::dllSysError, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, error_string ? error_string : "").ToLocalChecked(); // error_string (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(error_string));
   }
 
 // nodemod.on('dllPMMove', (ppmove, server) => console.log('dllPMMove fired!'));
   void dll_pfnPM_Move (struct playermove_s * ppmove, qboolean server) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllPMMove", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::dllPMMove)) return;
+    event::findAndCall<2>(EventId::dllPMMove, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapPlayerMove(isolate, ppmove); // ppmove (struct playermove_s *)
       v8_args[1] = v8::Boolean::New(isolate, server); // server (qboolean)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(ppmove, server));
   }
 
 // nodemod.on('dllPMInit', (ppmove) => console.log('dllPMInit fired!'));
   void dll_pfnPM_Init (struct playermove_s * ppmove) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllPMInit", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::dllPMInit)) return;
+    event::findAndCall<1>(EventId::dllPMInit, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapPlayerMove(isolate, ppmove); // ppmove (struct playermove_s *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(ppmove));
   }
 
 // nodemod.on('dllPMFindTextureType', (name) => console.log('dllPMFindTextureType fired!'));
   char dll_pfnPM_FindTextureType (const char * name) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllPMFindTextureType", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::dllPMFindTextureType)) return 0;
+    char returnValue{};
+    event::findAndCall<1>(EventId::dllPMFindTextureType, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, name ? name : "").ToLocalChecked(); // name (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(name), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (char)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -436,36 +427,32 @@
 // nodemod.on('dllSetupVisibility', (pViewEntity, pClient, pvs, pas) => console.log('dllSetupVisibility fired!'));
   void dll_pfnSetupVisibility (struct edict_s * pViewEntity, struct edict_s * pClient, unsigned char ** pvs, unsigned char ** pas) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllSetupVisibility", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 4;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[4];
+    if (!hooks::active(EventId::dllSetupVisibility)) return;
+    event::findAndCall<4>(EventId::dllSetupVisibility, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pViewEntity); // pViewEntity (struct edict_s *)
       v8_args[1] = structures::wrapEntity(isolate, pClient); // pClient (struct edict_s *)
       v8_args[2] = v8::External::New(isolate, pvs); // pvs (unsigned char **)
       v8_args[3] = v8::External::New(isolate, pas); // pas (unsigned char **)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pViewEntity, pClient, pvs, pas));
   }
 
 // nodemod.on('dllUpdateClientData', (ent, sendweapons, cd) => console.log('dllUpdateClientData fired!'));
   void dll_pfnUpdateClientData (const struct edict_s * ent, int sendweapons, struct clientdata_s * cd) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllUpdateClientData", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::dllUpdateClientData)) return;
+    event::findAndCall<3>(EventId::dllUpdateClientData, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, ent); // ent (const struct edict_s *)
       v8_args[1] = v8::Number::New(isolate, sendweapons); // sendweapons (int)
       v8_args[2] = structures::wrapClientData(isolate, cd); // cd (struct clientdata_s *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(ent, sendweapons, cd));
   }
 
 // nodemod.on('dllAddToFullPack', (state, e, ent, host, hostflags, player, pSet) => console.log('dllAddToFullPack fired!'));
   int dll_pfnAddToFullPack (struct entity_state_s * state, int e, edict_t * ent, edict_t * host, int hostflags, int player, unsigned char * pSet) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllAddToFullPack", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 7;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[7];
+    if (!hooks::active(EventId::dllAddToFullPack)) return 0;
+    int returnValue{};
+    event::findAndCall<7>(EventId::dllAddToFullPack, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntityState(isolate, state); // state (struct entity_state_s *)
       v8_args[1] = v8::Number::New(isolate, e); // e (int)
       v8_args[2] = structures::wrapEntity(isolate, ent); // ent (edict_t *)
@@ -473,10 +460,9 @@
       v8_args[4] = v8::Number::New(isolate, hostflags); // hostflags (int)
       v8_args[5] = v8::Number::New(isolate, player); // player (int)
       v8_args[6] = utils::byteArrayToJS(isolate, pSet, 1); // pSet (unsigned char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(state, e, ent, host, hostflags, player, pSet), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -484,9 +470,8 @@
 // nodemod.on('dllCreateBaseline', (player, eindex, baseline, entity, playermodelindex, player_mins, player_maxs) => console.log('dllCreateBaseline fired!'));
   void dll_pfnCreateBaseline (int player, int eindex, struct entity_state_s * baseline, struct edict_s * entity, int playermodelindex, vec3_t player_mins, vec3_t player_maxs) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllCreateBaseline", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 7;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[7];
+    if (!hooks::active(EventId::dllCreateBaseline)) return;
+    event::findAndCall<7>(EventId::dllCreateBaseline, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, player); // player (int)
       v8_args[1] = v8::Number::New(isolate, eindex); // eindex (int)
       v8_args[2] = structures::wrapEntityState(isolate, baseline); // baseline (struct entity_state_s *)
@@ -494,28 +479,27 @@
       v8_args[4] = v8::Number::New(isolate, playermodelindex); // playermodelindex (int)
       v8_args[5] = utils::vect2js(isolate, player_mins); // player_mins (vec3_t)
       v8_args[6] = utils::vect2js(isolate, player_maxs); // player_maxs (vec3_t)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(player, eindex, baseline, entity, playermodelindex, player_mins, player_maxs));
   }
 
 // nodemod.on('dllRegisterEncoders', () => console.log('dllRegisterEncoders fired!'));
   void dll_pfnRegisterEncoders () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllRegisterEncoders", nullptr, 0);
+    if (!hooks::active(EventId::dllRegisterEncoders)) return;
+    event::findAndCall(EventId::dllRegisterEncoders, nullptr, 0);
   }
 
 // nodemod.on('dllGetWeaponData', (player, info) => console.log('dllGetWeaponData fired!'));
   int dll_pfnGetWeaponData (struct edict_s * player, struct weapon_data_s * info) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllGetWeaponData", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::dllGetWeaponData)) return 0;
+    int returnValue{};
+    event::findAndCall<2>(EventId::dllGetWeaponData, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, player); // player (struct edict_s *)
       v8_args[1] = structures::wrapWeaponData(isolate, info); // info (struct weapon_data_s *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(player, info), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -523,41 +507,37 @@
 // nodemod.on('dllCmdStart', (player, cmd, random_seed) => console.log('dllCmdStart fired!'));
   void dll_pfnCmdStart (const edict_t * player, const struct usercmd_s * cmd, unsigned int random_seed) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllCmdStart", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::dllCmdStart)) return;
+    event::findAndCall<3>(EventId::dllCmdStart, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, player); // player (const edict_t *)
       v8_args[1] = structures::wrapUserCmd(isolate, (void*)cmd); // cmd (const struct usercmd_s *)
       v8_args[2] = v8::Number::New(isolate, random_seed); // random_seed (unsigned int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(player, cmd, random_seed));
   }
 
 // nodemod.on('dllCmdEnd', (player) => console.log('dllCmdEnd fired!'));
   void dll_pfnCmdEnd (const edict_t * player) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllCmdEnd", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::dllCmdEnd)) return;
+    batch::record(EventId::dllCmdEnd, player);
+    event::findAndCall<1>(EventId::dllCmdEnd, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, player); // player (const edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(player));
   }
 
 // nodemod.on('dllConnectionlessPacket', (net_from, args, response_buffer, response_buffer_size) => console.log('dllConnectionlessPacket fired!'));
   int dll_pfnConnectionlessPacket (const struct netadr_s * net_from, const char * args, char * response_buffer, int * response_buffer_size) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllConnectionlessPacket", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 4;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[4];
+    if (!hooks::active(EventId::dllConnectionlessPacket)) return 0;
+    int returnValue{};
+    event::findAndCall<4>(EventId::dllConnectionlessPacket, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapNetAdr(isolate, (void*)net_from); // net_from (const struct netadr_s *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, args ? args : "").ToLocalChecked(); // args (const char *)
       v8_args[2] = v8::String::NewFromUtf8(isolate, response_buffer ? response_buffer : "").ToLocalChecked(); // response_buffer (char *)
       v8_args[3] = utils::intArrayToJS(isolate, response_buffer_size, 1); // response_buffer_size (int *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(net_from, args, response_buffer, response_buffer_size), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -565,16 +545,15 @@
 // nodemod.on('dllGetHullBounds', (hullnumber, mins, maxs) => console.log('dllGetHullBounds fired!'));
   int dll_pfnGetHullBounds (int hullnumber, float * mins, float * maxs) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllGetHullBounds", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::dllGetHullBounds)) return 0;
+    int returnValue{};
+    event::findAndCall<3>(EventId::dllGetHullBounds, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, hullnumber); // hullnumber (int)
       v8_args[1] = utils::floatArrayToJS(isolate, mins, 3); // mins (float *)
       v8_args[2] = utils::floatArrayToJS(isolate, maxs, 3); // maxs (float *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(hullnumber, mins, maxs), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -582,22 +561,22 @@
 // nodemod.on('dllCreateInstancedBaselines', () => console.log('dllCreateInstancedBaselines fired!'));
   void dll_pfnCreateInstancedBaselines () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllCreateInstancedBaselines", nullptr, 0);
+    if (!hooks::active(EventId::dllCreateInstancedBaselines)) return;
+    event::findAndCall(EventId::dllCreateInstancedBaselines, nullptr, 0);
   }
 
 // nodemod.on('dllInconsistentFile', (player, filename, disconnect_message) => console.log('dllInconsistentFile fired!'));
   int dll_pfnInconsistentFile (const struct edict_s * player, const char * filename, char * disconnect_message) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllInconsistentFile", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::dllInconsistentFile)) return 0;
+    int returnValue{};
+    event::findAndCall<3>(EventId::dllInconsistentFile, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, player); // player (const struct edict_s *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, filename ? filename : "").ToLocalChecked(); // filename (const char *)
       v8_args[2] = v8::String::NewFromUtf8(isolate, disconnect_message ? disconnect_message : "").ToLocalChecked(); // disconnect_message (char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(player, filename, disconnect_message), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -605,9 +584,11 @@
 // nodemod.on('dllAllowLagCompensation', () => console.log('dllAllowLagCompensation fired!'));
   int dll_pfnAllowLagCompensation () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("dllAllowLagCompensation", nullptr, 0);
+    if (!hooks::active(EventId::dllAllowLagCompensation)) return 0;
+    int returnValue{};
+    event::findAndCall(EventId::dllAllowLagCompensation, nullptr, 0, event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -669,20 +650,20 @@
     // nodemod.on('postDllGameInit', () => console.log('postDllGameInit fired!'));
   void postDll_pfnGameInit () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllGameInit", nullptr, 0);
+    if (!hooks::active(EventId::postDllGameInit)) return;
+    event::findAndCall(EventId::postDllGameInit, nullptr, 0);
   }
 
 // nodemod.on('postDllSpawn', (pent) => console.log('postDllSpawn fired!'));
   int postDll_pfnSpawn (edict_t * pent) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllSpawn", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postDllSpawn)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::postDllSpawn, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pent); // pent (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pent), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -690,87 +671,78 @@
 // nodemod.on('postDllThink', (pent) => console.log('postDllThink fired!'));
   void postDll_pfnThink (edict_t * pent) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllThink", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postDllThink)) return;
+    batch::record(EventId::postDllThink, pent);
+    event::findAndCall<1>(EventId::postDllThink, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pent); // pent (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pent));
   }
 
 // nodemod.on('postDllUse', (pentUsed, pentOther) => console.log('postDllUse fired!'));
   void postDll_pfnUse (edict_t * pentUsed, edict_t * pentOther) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllUse", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postDllUse)) return;
+    batch::record(EventId::postDllUse, pentUsed, pentOther);
+    event::findAndCall<2>(EventId::postDllUse, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pentUsed); // pentUsed (edict_t *)
       v8_args[1] = structures::wrapEntity(isolate, pentOther); // pentOther (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pentUsed, pentOther));
   }
 
 // nodemod.on('postDllTouch', (pentTouched, pentOther) => console.log('postDllTouch fired!'));
   void postDll_pfnTouch (edict_t * pentTouched, edict_t * pentOther) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllTouch", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postDllTouch)) return;
+    batch::record(EventId::postDllTouch, pentTouched, pentOther);
+    event::findAndCall<2>(EventId::postDllTouch, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pentTouched); // pentTouched (edict_t *)
       v8_args[1] = structures::wrapEntity(isolate, pentOther); // pentOther (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pentTouched, pentOther));
   }
 
 // nodemod.on('postDllBlocked', (pentBlocked, pentOther) => console.log('postDllBlocked fired!'));
   void postDll_pfnBlocked (edict_t * pentBlocked, edict_t * pentOther) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllBlocked", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postDllBlocked)) return;
+    batch::record(EventId::postDllBlocked, pentBlocked, pentOther);
+    event::findAndCall<2>(EventId::postDllBlocked, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pentBlocked); // pentBlocked (edict_t *)
       v8_args[1] = structures::wrapEntity(isolate, pentOther); // pentOther (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pentBlocked, pentOther));
   }
 
 // nodemod.on('postDllKeyValue', (pentKeyvalue, pkvd) => console.log('postDllKeyValue fired!'));
   void postDll_pfnKeyValue (edict_t * pentKeyvalue, KeyValueData * pkvd) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllKeyValue", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postDllKeyValue)) return;
+    event::findAndCall<2>(EventId::postDllKeyValue, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pentKeyvalue); // pentKeyvalue (edict_t *)
       v8_args[1] = structures::wrapKeyValueData(isolate, pkvd); // pkvd (KeyValueData *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pentKeyvalue, pkvd));
   }
 
 // nodemod.on('postDllSave', (pent, pSaveData) => console.log('postDllSave fired!'));
   void postDll_pfnSave (edict_t * pent, SAVERESTOREDATA * pSaveData) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllSave", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postDllSave)) return;
+    event::findAndCall<2>(EventId::postDllSave, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pent); // pent (edict_t *)
       v8_args[1] = structures::wrapSaveRestoreData(isolate, pSaveData); // pSaveData (SAVERESTOREDATA *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pent, pSaveData));
   }
 
 // nodemod.on('postDllRestore', (pent, pSaveData, globalEntity) => console.log('postDllRestore fired!'));
   int postDll_pfnRestore (edict_t * pent, SAVERESTOREDATA * pSaveData, int globalEntity) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllRestore", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::postDllRestore)) return 0;
+    int returnValue{};
+    event::findAndCall<3>(EventId::postDllRestore, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pent); // pent (edict_t *)
       v8_args[1] = structures::wrapSaveRestoreData(isolate, pSaveData); // pSaveData (SAVERESTOREDATA *)
       v8_args[2] = v8::Number::New(isolate, globalEntity); // globalEntity (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pent, pSaveData, globalEntity), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -778,86 +750,77 @@
 // nodemod.on('postDllSetAbsBox', (pent) => console.log('postDllSetAbsBox fired!'));
   void postDll_pfnSetAbsBox (edict_t * pent) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllSetAbsBox", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postDllSetAbsBox)) return;
+    batch::record(EventId::postDllSetAbsBox, pent);
+    event::findAndCall<1>(EventId::postDllSetAbsBox, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pent); // pent (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pent));
   }
 
 // nodemod.on('postDllSaveWriteFields', (value0, value1, value2, value3, value4) => console.log('postDllSaveWriteFields fired!'));
   void postDll_pfnSaveWriteFields (SAVERESTOREDATA* value0, const char* value1, void* value2, TYPEDESCRIPTION* value3, int value4) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllSaveWriteFields", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 5;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[5];
+    if (!hooks::active(EventId::postDllSaveWriteFields)) return;
+    event::findAndCall<5>(EventId::postDllSaveWriteFields, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapSaveRestoreData(isolate, value0); // value0 (SAVERESTOREDATA*)
       v8_args[1] = v8::String::NewFromUtf8(isolate, value1 ? value1 : "").ToLocalChecked(); // value1 (const char*)
       v8_args[2] = v8::External::New(isolate, value2); // value2 (void*)
       v8_args[3] = structures::wrapTypeDescription(isolate, value3); // value3 (TYPEDESCRIPTION*)
       v8_args[4] = v8::Number::New(isolate, value4); // value4 (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(value0, value1, value2, value3, value4));
   }
 
 // nodemod.on('postDllSaveReadFields', (value0, value1, value2, value3, value4) => console.log('postDllSaveReadFields fired!'));
   void postDll_pfnSaveReadFields (SAVERESTOREDATA* value0, const char* value1, void* value2, TYPEDESCRIPTION* value3, int value4) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllSaveReadFields", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 5;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[5];
+    if (!hooks::active(EventId::postDllSaveReadFields)) return;
+    event::findAndCall<5>(EventId::postDllSaveReadFields, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapSaveRestoreData(isolate, value0); // value0 (SAVERESTOREDATA*)
       v8_args[1] = v8::String::NewFromUtf8(isolate, value1 ? value1 : "").ToLocalChecked(); // value1 (const char*)
       v8_args[2] = v8::External::New(isolate, value2); // value2 (void*)
       v8_args[3] = structures::wrapTypeDescription(isolate, value3); // value3 (TYPEDESCRIPTION*)
       v8_args[4] = v8::Number::New(isolate, value4); // value4 (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(value0, value1, value2, value3, value4));
   }
 
 // nodemod.on('postDllSaveGlobalState', (value0) => console.log('postDllSaveGlobalState fired!'));
   void postDll_pfnSaveGlobalState (SAVERESTOREDATA * value0) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllSaveGlobalState", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postDllSaveGlobalState)) return;
+    event::findAndCall<1>(EventId::postDllSaveGlobalState, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapSaveRestoreData(isolate, value0); // value0 (SAVERESTOREDATA *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(value0));
   }
 
 // nodemod.on('postDllRestoreGlobalState', (value0) => console.log('postDllRestoreGlobalState fired!'));
   void postDll_pfnRestoreGlobalState (SAVERESTOREDATA * value0) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllRestoreGlobalState", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postDllRestoreGlobalState)) return;
+    event::findAndCall<1>(EventId::postDllRestoreGlobalState, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapSaveRestoreData(isolate, value0); // value0 (SAVERESTOREDATA *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(value0));
   }
 
 // nodemod.on('postDllResetGlobalState', () => console.log('postDllResetGlobalState fired!'));
   void postDll_pfnResetGlobalState () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllResetGlobalState", nullptr, 0);
+    if (!hooks::active(EventId::postDllResetGlobalState)) return;
+    event::findAndCall(EventId::postDllResetGlobalState, nullptr, 0);
   }
 
 // nodemod.on('postDllClientConnect', (pEntity, pszName, pszAddress, szRejectReason) => console.log('postDllClientConnect fired!'));
   qboolean postDll_pfnClientConnect (edict_t * pEntity, const char * pszName, const char * pszAddress, char* szRejectReason) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllClientConnect", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 4;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[4];
+    if (!hooks::active(EventId::postDllClientConnect)) return 0;
+    qboolean returnValue{};
+    event::findAndCall<4>(EventId::postDllClientConnect, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEntity); // pEntity (edict_t *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, pszName ? pszName : "").ToLocalChecked(); // pszName (const char *)
       v8_args[2] = v8::String::NewFromUtf8(isolate, pszAddress ? pszAddress : "").ToLocalChecked(); // pszAddress (const char *)
       v8_args[3] = v8::String::NewFromUtf8(isolate, szRejectReason ? szRejectReason : "").ToLocalChecked(); // szRejectReason (char*)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEntity, pszName, pszAddress, szRejectReason), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (qboolean)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -865,44 +828,41 @@
 // nodemod.on('postDllClientDisconnect', (pEntity) => console.log('postDllClientDisconnect fired!'));
   void postDll_pfnClientDisconnect (edict_t * pEntity) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllClientDisconnect", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postDllClientDisconnect)) return;
+    batch::record(EventId::postDllClientDisconnect, pEntity);
+    event::findAndCall<1>(EventId::postDllClientDisconnect, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEntity); // pEntity (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEntity));
     clearPlayerCustomizations(pEntity);
   }
 
 // nodemod.on('postDllClientKill', (pEntity) => console.log('postDllClientKill fired!'));
   void postDll_pfnClientKill (edict_t * pEntity) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllClientKill", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postDllClientKill)) return;
+    batch::record(EventId::postDllClientKill, pEntity);
+    event::findAndCall<1>(EventId::postDllClientKill, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEntity); // pEntity (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEntity));
   }
 
 // nodemod.on('postDllClientPutInServer', (pEntity) => console.log('postDllClientPutInServer fired!'));
   void postDll_pfnClientPutInServer (edict_t * pEntity) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllClientPutInServer", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postDllClientPutInServer)) return;
+    batch::record(EventId::postDllClientPutInServer, pEntity);
+    event::findAndCall<1>(EventId::postDllClientPutInServer, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEntity); // pEntity (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEntity));
   }
 
 // nodemod.on('postDllClientCommand', (pEntity) => console.log('postDllClientCommand fired!'));
   void postDll_pfnClientCommand (edict_t* ed) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllClientCommand", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-  v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
-  v8_args[0] = structures::wrapEntity(isolate, ed);
+    if (!hooks::active(EventId::postDllClientCommand)) return;
+    batch::record(EventId::postDllClientCommand, ed, CMD_ARGV(0));
+    event::findAndCall<2>(EventId::postDllClientCommand, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
+      v8_args[0] = structures::wrapEntity(isolate, ed);
 
   // refactor it str hell
   if (CMD_ARGC() > 1) {
@@ -912,88 +872,88 @@
   } else {
     v8_args[1] = v8::String::NewFromUtf8(isolate, CMD_ARGV(0)).ToLocalChecked();
   }
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(ed, CMD_ARGV(0)));
   }
 
 // nodemod.on('postDllClientUserInfoChanged', (pEntity, infobuffer) => console.log('postDllClientUserInfoChanged fired!'));
   void postDll_pfnClientUserInfoChanged (edict_t * pEntity, char * infobuffer) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllClientUserInfoChanged", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postDllClientUserInfoChanged)) return;
+    batch::record(EventId::postDllClientUserInfoChanged, pEntity, infobuffer);
+    event::findAndCall<2>(EventId::postDllClientUserInfoChanged, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEntity); // pEntity (edict_t *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, infobuffer ? infobuffer : "").ToLocalChecked(); // infobuffer (char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEntity, infobuffer));
   }
 
 // nodemod.on('postDllServerActivate', (pEdictList, edictCount, clientMax) => console.log('postDllServerActivate fired!'));
   void postDll_pfnServerActivate (edict_t * pEdictList, int edictCount, int clientMax) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllServerActivate", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::postDllServerActivate)) return;
+    batch::record(EventId::postDllServerActivate, pEdictList, edictCount, clientMax);
+    event::findAndCall<3>(EventId::postDllServerActivate, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdictList); // pEdictList (edict_t *)
       v8_args[1] = v8::Number::New(isolate, edictCount); // edictCount (int)
       v8_args[2] = v8::Number::New(isolate, clientMax); // clientMax (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdictList, edictCount, clientMax));
   }
 
 // nodemod.on('postDllServerDeactivate', () => console.log('postDllServerDeactivate fired!'));
   void postDll_pfnServerDeactivate () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllServerDeactivate", nullptr, 0);
+    if (!hooks::active(EventId::postDllServerDeactivate)) return;
+    event::findAndCall(EventId::postDllServerDeactivate, nullptr, 0);
   }
 
 // nodemod.on('postDllPlayerPreThink', (pEntity) => console.log('postDllPlayerPreThink fired!'));
   void postDll_pfnPlayerPreThink (edict_t * pEntity) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllPlayerPreThink", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postDllPlayerPreThink)) return;
+    batch::record(EventId::postDllPlayerPreThink, pEntity);
+    event::findAndCall<1>(EventId::postDllPlayerPreThink, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEntity); // pEntity (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEntity));
   }
 
 // nodemod.on('postDllPlayerPostThink', (pEntity) => console.log('postDllPlayerPostThink fired!'));
   void postDll_pfnPlayerPostThink (edict_t * pEntity) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllPlayerPostThink", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postDllPlayerPostThink)) return;
+    batch::record(EventId::postDllPlayerPostThink, pEntity);
+    event::findAndCall<1>(EventId::postDllPlayerPostThink, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEntity); // pEntity (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEntity));
   }
 
-// pfnStartFrame - Run Node.js UV loop tick and fire event
+// nodemod.on('postDllStartFrame', () => console.log('postDllStartFrame fired!'));
   void postDll_pfnStartFrame () {
     SET_META_RESULT(MRES_IGNORED);
-    nodeImpl.Tick();
-    event::findAndCall("postDllStartFrame", nullptr, 0);
+    if (!hooks::active(EventId::postDllStartFrame)) return;
+    event::findAndCall(EventId::postDllStartFrame, nullptr, 0);
   }
 
 // nodemod.on('postDllParmsNewLevel', () => console.log('postDllParmsNewLevel fired!'));
   void postDll_pfnParmsNewLevel () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllParmsNewLevel", nullptr, 0);
+    if (!hooks::active(EventId::postDllParmsNewLevel)) return;
+    event::findAndCall(EventId::postDllParmsNewLevel, nullptr, 0);
   }
 
 // nodemod.on('postDllParmsChangeLevel', () => console.log('postDllParmsChangeLevel fired!'));
   void postDll_pfnParmsChangeLevel () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllParmsChangeLevel", nullptr, 0);
+    if (!hooks::active(EventId::postDllParmsChangeLevel)) return;
+    event::findAndCall(EventId::postDllParmsChangeLevel, nullptr, 0);
   }
 
 // nodemod.on('postDllGetGameDescription', () => console.log('postDllGetGameDescription fired!'));
   const char * postDll_pfnGetGameDescription () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllGetGameDescription", nullptr, 0);
+    if (!hooks::active(EventId::postDllGetGameDescription)) return nullptr;
+    const char * returnValue{};
+    event::findAndCall(EventId::postDllGetGameDescription, nullptr, 0, event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (const char *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -1001,94 +961,83 @@
 // nodemod.on('postDllPlayerCustomization', (pEntity, pCustom) => console.log('postDllPlayerCustomization fired!'));
   void postDll_pfnPlayerCustomization (edict_t * pEntity, customization_t * pCustom) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllPlayerCustomization", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postDllPlayerCustomization)) return;
+    event::findAndCall<2>(EventId::postDllPlayerCustomization, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEntity); // pEntity (edict_t *)
       v8_args[1] = structures::wrapCustomization(isolate, pCustom); // pCustom (customization_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEntity, pCustom));
     storePlayerCustomization(pEntity, pCustom);
   }
 
 // nodemod.on('postDllSpectatorConnect', (pEntity) => console.log('postDllSpectatorConnect fired!'));
   void postDll_pfnSpectatorConnect (edict_t * pEntity) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllSpectatorConnect", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postDllSpectatorConnect)) return;
+    batch::record(EventId::postDllSpectatorConnect, pEntity);
+    event::findAndCall<1>(EventId::postDllSpectatorConnect, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEntity); // pEntity (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEntity));
   }
 
 // nodemod.on('postDllSpectatorDisconnect', (pEntity) => console.log('postDllSpectatorDisconnect fired!'));
   void postDll_pfnSpectatorDisconnect (edict_t * pEntity) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllSpectatorDisconnect", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postDllSpectatorDisconnect)) return;
+    batch::record(EventId::postDllSpectatorDisconnect, pEntity);
+    event::findAndCall<1>(EventId::postDllSpectatorDisconnect, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEntity); // pEntity (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEntity));
   }
 
 // nodemod.on('postDllSpectatorThink', (pEntity) => console.log('postDllSpectatorThink fired!'));
   void postDll_pfnSpectatorThink (edict_t * pEntity) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllSpectatorThink", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postDllSpectatorThink)) return;
+    batch::record(EventId::postDllSpectatorThink, pEntity);
+    event::findAndCall<1>(EventId::postDllSpectatorThink, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEntity); // pEntity (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEntity));
   }
 
 // nodemod.on('postDllSysError', (error_string) => console.log('postDllSysError fired!'));
   void postDll_pfnSys_Error (const char * error_string) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllSysError", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postDllSysError)) return;
+    batch::record(EventId::postDllSysError, error_string);
+    event::findAndCall<1>(EventId::postDllSysError, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, error_string ? error_string : "").ToLocalChecked(); // error_string (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(error_string));
   }
 
 // nodemod.on('postDllPMMove', (ppmove, server) => console.log('postDllPMMove fired!'));
   void postDll_pfnPM_Move (struct playermove_s * ppmove, qboolean server) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllPMMove", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postDllPMMove)) return;
+    event::findAndCall<2>(EventId::postDllPMMove, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapPlayerMove(isolate, ppmove); // ppmove (struct playermove_s *)
       v8_args[1] = v8::Boolean::New(isolate, server); // server (qboolean)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(ppmove, server));
   }
 
 // nodemod.on('postDllPMInit', (ppmove) => console.log('postDllPMInit fired!'));
   void postDll_pfnPM_Init (struct playermove_s * ppmove) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllPMInit", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postDllPMInit)) return;
+    event::findAndCall<1>(EventId::postDllPMInit, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapPlayerMove(isolate, ppmove); // ppmove (struct playermove_s *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(ppmove));
   }
 
 // nodemod.on('postDllPMFindTextureType', (name) => console.log('postDllPMFindTextureType fired!'));
   char postDll_pfnPM_FindTextureType (const char * name) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllPMFindTextureType", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postDllPMFindTextureType)) return 0;
+    char returnValue{};
+    event::findAndCall<1>(EventId::postDllPMFindTextureType, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, name ? name : "").ToLocalChecked(); // name (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(name), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (char)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -1096,36 +1045,32 @@
 // nodemod.on('postDllSetupVisibility', (pViewEntity, pClient, pvs, pas) => console.log('postDllSetupVisibility fired!'));
   void postDll_pfnSetupVisibility (struct edict_s * pViewEntity, struct edict_s * pClient, unsigned char ** pvs, unsigned char ** pas) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllSetupVisibility", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 4;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[4];
+    if (!hooks::active(EventId::postDllSetupVisibility)) return;
+    event::findAndCall<4>(EventId::postDllSetupVisibility, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pViewEntity); // pViewEntity (struct edict_s *)
       v8_args[1] = structures::wrapEntity(isolate, pClient); // pClient (struct edict_s *)
       v8_args[2] = v8::External::New(isolate, pvs); // pvs (unsigned char **)
       v8_args[3] = v8::External::New(isolate, pas); // pas (unsigned char **)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pViewEntity, pClient, pvs, pas));
   }
 
 // nodemod.on('postDllUpdateClientData', (ent, sendweapons, cd) => console.log('postDllUpdateClientData fired!'));
   void postDll_pfnUpdateClientData (const struct edict_s * ent, int sendweapons, struct clientdata_s * cd) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllUpdateClientData", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::postDllUpdateClientData)) return;
+    event::findAndCall<3>(EventId::postDllUpdateClientData, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, ent); // ent (const struct edict_s *)
       v8_args[1] = v8::Number::New(isolate, sendweapons); // sendweapons (int)
       v8_args[2] = structures::wrapClientData(isolate, cd); // cd (struct clientdata_s *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(ent, sendweapons, cd));
   }
 
 // nodemod.on('postDllAddToFullPack', (state, e, ent, host, hostflags, player, pSet) => console.log('postDllAddToFullPack fired!'));
   int postDll_pfnAddToFullPack (struct entity_state_s * state, int e, edict_t * ent, edict_t * host, int hostflags, int player, unsigned char * pSet) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllAddToFullPack", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 7;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[7];
+    if (!hooks::active(EventId::postDllAddToFullPack)) return 0;
+    int returnValue{};
+    event::findAndCall<7>(EventId::postDllAddToFullPack, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntityState(isolate, state); // state (struct entity_state_s *)
       v8_args[1] = v8::Number::New(isolate, e); // e (int)
       v8_args[2] = structures::wrapEntity(isolate, ent); // ent (edict_t *)
@@ -1133,10 +1078,9 @@
       v8_args[4] = v8::Number::New(isolate, hostflags); // hostflags (int)
       v8_args[5] = v8::Number::New(isolate, player); // player (int)
       v8_args[6] = utils::byteArrayToJS(isolate, pSet, 1); // pSet (unsigned char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(state, e, ent, host, hostflags, player, pSet), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -1144,9 +1088,8 @@
 // nodemod.on('postDllCreateBaseline', (player, eindex, baseline, entity, playermodelindex, player_mins, player_maxs) => console.log('postDllCreateBaseline fired!'));
   void postDll_pfnCreateBaseline (int player, int eindex, struct entity_state_s * baseline, struct edict_s * entity, int playermodelindex, vec3_t player_mins, vec3_t player_maxs) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllCreateBaseline", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 7;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[7];
+    if (!hooks::active(EventId::postDllCreateBaseline)) return;
+    event::findAndCall<7>(EventId::postDllCreateBaseline, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, player); // player (int)
       v8_args[1] = v8::Number::New(isolate, eindex); // eindex (int)
       v8_args[2] = structures::wrapEntityState(isolate, baseline); // baseline (struct entity_state_s *)
@@ -1154,28 +1097,27 @@
       v8_args[4] = v8::Number::New(isolate, playermodelindex); // playermodelindex (int)
       v8_args[5] = utils::vect2js(isolate, player_mins); // player_mins (vec3_t)
       v8_args[6] = utils::vect2js(isolate, player_maxs); // player_maxs (vec3_t)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(player, eindex, baseline, entity, playermodelindex, player_mins, player_maxs));
   }
 
 // nodemod.on('postDllRegisterEncoders', () => console.log('postDllRegisterEncoders fired!'));
   void postDll_pfnRegisterEncoders () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllRegisterEncoders", nullptr, 0);
+    if (!hooks::active(EventId::postDllRegisterEncoders)) return;
+    event::findAndCall(EventId::postDllRegisterEncoders, nullptr, 0);
   }
 
 // nodemod.on('postDllGetWeaponData', (player, info) => console.log('postDllGetWeaponData fired!'));
   int postDll_pfnGetWeaponData (struct edict_s * player, struct weapon_data_s * info) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllGetWeaponData", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postDllGetWeaponData)) return 0;
+    int returnValue{};
+    event::findAndCall<2>(EventId::postDllGetWeaponData, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, player); // player (struct edict_s *)
       v8_args[1] = structures::wrapWeaponData(isolate, info); // info (struct weapon_data_s *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(player, info), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -1183,41 +1125,37 @@
 // nodemod.on('postDllCmdStart', (player, cmd, random_seed) => console.log('postDllCmdStart fired!'));
   void postDll_pfnCmdStart (const edict_t * player, const struct usercmd_s * cmd, unsigned int random_seed) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllCmdStart", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::postDllCmdStart)) return;
+    event::findAndCall<3>(EventId::postDllCmdStart, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, player); // player (const edict_t *)
       v8_args[1] = structures::wrapUserCmd(isolate, (void*)cmd); // cmd (const struct usercmd_s *)
       v8_args[2] = v8::Number::New(isolate, random_seed); // random_seed (unsigned int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(player, cmd, random_seed));
   }
 
 // nodemod.on('postDllCmdEnd', (player) => console.log('postDllCmdEnd fired!'));
   void postDll_pfnCmdEnd (const edict_t * player) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllCmdEnd", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postDllCmdEnd)) return;
+    batch::record(EventId::postDllCmdEnd, player);
+    event::findAndCall<1>(EventId::postDllCmdEnd, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, player); // player (const edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(player));
   }
 
 // nodemod.on('postDllConnectionlessPacket', (net_from, args, response_buffer, response_buffer_size) => console.log('postDllConnectionlessPacket fired!'));
   int postDll_pfnConnectionlessPacket (const struct netadr_s * net_from, const char * args, char * response_buffer, int * response_buffer_size) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllConnectionlessPacket", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 4;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[4];
+    if (!hooks::active(EventId::postDllConnectionlessPacket)) return 0;
+    int returnValue{};
+    event::findAndCall<4>(EventId::postDllConnectionlessPacket, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapNetAdr(isolate, (void*)net_from); // net_from (const struct netadr_s *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, args ? args : "").ToLocalChecked(); // args (const char *)
       v8_args[2] = v8::String::NewFromUtf8(isolate, response_buffer ? response_buffer : "").ToLocalChecked(); // response_buffer (char *)
       v8_args[3] = utils::intArrayToJS(isolate, response_buffer_size, 1); // response_buffer_size (int *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(net_from, args, response_buffer, response_buffer_size), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -1225,16 +1163,15 @@
 // nodemod.on('postDllGetHullBounds', (hullnumber, mins, maxs) => console.log('postDllGetHullBounds fired!'));
   int postDll_pfnGetHullBounds (int hullnumber, float * mins, float * maxs) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllGetHullBounds", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::postDllGetHullBounds)) return 0;
+    int returnValue{};
+    event::findAndCall<3>(EventId::postDllGetHullBounds, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, hullnumber); // hullnumber (int)
       v8_args[1] = utils::floatArrayToJS(isolate, mins, 3); // mins (float *)
       v8_args[2] = utils::floatArrayToJS(isolate, maxs, 3); // maxs (float *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(hullnumber, mins, maxs), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -1242,22 +1179,22 @@
 // nodemod.on('postDllCreateInstancedBaselines', () => console.log('postDllCreateInstancedBaselines fired!'));
   void postDll_pfnCreateInstancedBaselines () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllCreateInstancedBaselines", nullptr, 0);
+    if (!hooks::active(EventId::postDllCreateInstancedBaselines)) return;
+    event::findAndCall(EventId::postDllCreateInstancedBaselines, nullptr, 0);
   }
 
 // nodemod.on('postDllInconsistentFile', (player, filename, disconnect_message) => console.log('postDllInconsistentFile fired!'));
   int postDll_pfnInconsistentFile (const struct edict_s * player, const char * filename, char * disconnect_message) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllInconsistentFile", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::postDllInconsistentFile)) return 0;
+    int returnValue{};
+    event::findAndCall<3>(EventId::postDllInconsistentFile, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, player); // player (const struct edict_s *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, filename ? filename : "").ToLocalChecked(); // filename (const char *)
       v8_args[2] = v8::String::NewFromUtf8(isolate, disconnect_message ? disconnect_message : "").ToLocalChecked(); // disconnect_message (char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(player, filename, disconnect_message), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -1265,9 +1202,11 @@
 // nodemod.on('postDllAllowLagCompensation', () => console.log('postDllAllowLagCompensation fired!'));
   int postDll_pfnAllowLagCompensation () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postDllAllowLagCompensation", nullptr, 0);
+    if (!hooks::active(EventId::postDllAllowLagCompensation)) return 0;
+    int returnValue{};
+    event::findAndCall(EventId::postDllAllowLagCompensation, nullptr, 0, event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -1328,106 +1267,106 @@
     void registerDllEvents()
     {
       // base
-      event::register_event("dllGameInit", "");
-event::register_event("dllSpawn", "");
-event::register_event("dllThink", "");
-event::register_event("dllUse", "");
-event::register_event("dllTouch", "");
-event::register_event("dllBlocked", "");
-event::register_event("dllKeyValue", "");
-event::register_event("dllSave", "");
-event::register_event("dllRestore", "");
-event::register_event("dllSetAbsBox", "");
-event::register_event("dllSaveWriteFields", "");
-event::register_event("dllSaveReadFields", "");
-event::register_event("dllSaveGlobalState", "");
-event::register_event("dllRestoreGlobalState", "");
-event::register_event("dllResetGlobalState", "");
-event::register_event("dllClientConnect", "");
-event::register_event("dllClientDisconnect", "");
-event::register_event("dllClientKill", "");
-event::register_event("dllClientPutInServer", "");
-event::register_event("dllClientCommand", "");
-event::register_event("dllClientUserInfoChanged", "");
-event::register_event("dllServerActivate", "");
-event::register_event("dllServerDeactivate", "");
-event::register_event("dllPlayerPreThink", "");
-event::register_event("dllPlayerPostThink", "");
-event::register_event("dllStartFrame", "");
-event::register_event("dllParmsNewLevel", "");
-event::register_event("dllParmsChangeLevel", "");
-event::register_event("dllGetGameDescription", "");
-event::register_event("dllPlayerCustomization", "");
-event::register_event("dllSpectatorConnect", "");
-event::register_event("dllSpectatorDisconnect", "");
-event::register_event("dllSpectatorThink", "");
-event::register_event("dllSysError", "");
-event::register_event("dllPMMove", "");
-event::register_event("dllPMInit", "");
-event::register_event("dllPMFindTextureType", "");
-event::register_event("dllSetupVisibility", "");
-event::register_event("dllUpdateClientData", "");
-event::register_event("dllAddToFullPack", "");
-event::register_event("dllCreateBaseline", "");
-event::register_event("dllRegisterEncoders", "");
-event::register_event("dllGetWeaponData", "");
-event::register_event("dllCmdStart", "");
-event::register_event("dllCmdEnd", "");
-event::register_event("dllConnectionlessPacket", "");
-event::register_event("dllGetHullBounds", "");
-event::register_event("dllCreateInstancedBaselines", "");
-event::register_event("dllInconsistentFile", "");
-event::register_event("dllAllowLagCompensation", "");
+      event::register_event(EventId::dllGameInit, "");
+event::register_event(EventId::dllSpawn, "");
+event::register_event(EventId::dllThink, "");
+event::register_event(EventId::dllUse, "");
+event::register_event(EventId::dllTouch, "");
+event::register_event(EventId::dllBlocked, "");
+event::register_event(EventId::dllKeyValue, "");
+event::register_event(EventId::dllSave, "");
+event::register_event(EventId::dllRestore, "");
+event::register_event(EventId::dllSetAbsBox, "");
+event::register_event(EventId::dllSaveWriteFields, "");
+event::register_event(EventId::dllSaveReadFields, "");
+event::register_event(EventId::dllSaveGlobalState, "");
+event::register_event(EventId::dllRestoreGlobalState, "");
+event::register_event(EventId::dllResetGlobalState, "");
+event::register_event(EventId::dllClientConnect, "");
+event::register_event(EventId::dllClientDisconnect, "");
+event::register_event(EventId::dllClientKill, "");
+event::register_event(EventId::dllClientPutInServer, "");
+event::register_event(EventId::dllClientCommand, "");
+event::register_event(EventId::dllClientUserInfoChanged, "");
+event::register_event(EventId::dllServerActivate, "");
+event::register_event(EventId::dllServerDeactivate, "");
+event::register_event(EventId::dllPlayerPreThink, "");
+event::register_event(EventId::dllPlayerPostThink, "");
+event::register_event(EventId::dllStartFrame, "");
+event::register_event(EventId::dllParmsNewLevel, "");
+event::register_event(EventId::dllParmsChangeLevel, "");
+event::register_event(EventId::dllGetGameDescription, "");
+event::register_event(EventId::dllPlayerCustomization, "");
+event::register_event(EventId::dllSpectatorConnect, "");
+event::register_event(EventId::dllSpectatorDisconnect, "");
+event::register_event(EventId::dllSpectatorThink, "");
+event::register_event(EventId::dllSysError, "");
+event::register_event(EventId::dllPMMove, "");
+event::register_event(EventId::dllPMInit, "");
+event::register_event(EventId::dllPMFindTextureType, "");
+event::register_event(EventId::dllSetupVisibility, "");
+event::register_event(EventId::dllUpdateClientData, "");
+event::register_event(EventId::dllAddToFullPack, "");
+event::register_event(EventId::dllCreateBaseline, "");
+event::register_event(EventId::dllRegisterEncoders, "");
+event::register_event(EventId::dllGetWeaponData, "");
+event::register_event(EventId::dllCmdStart, "");
+event::register_event(EventId::dllCmdEnd, "");
+event::register_event(EventId::dllConnectionlessPacket, "");
+event::register_event(EventId::dllGetHullBounds, "");
+event::register_event(EventId::dllCreateInstancedBaselines, "");
+event::register_event(EventId::dllInconsistentFile, "");
+event::register_event(EventId::dllAllowLagCompensation, "");
       // post
-      event::register_event("postDllGameInit", "");
-event::register_event("postDllSpawn", "");
-event::register_event("postDllThink", "");
-event::register_event("postDllUse", "");
-event::register_event("postDllTouch", "");
-event::register_event("postDllBlocked", "");
-event::register_event("postDllKeyValue", "");
-event::register_event("postDllSave", "");
-event::register_event("postDllRestore", "");
-event::register_event("postDllSetAbsBox", "");
-event::register_event("postDllSaveWriteFields", "");
-event::register_event("postDllSaveReadFields", "");
-event::register_event("postDllSaveGlobalState", "");
-event::register_event("postDllRestoreGlobalState", "");
-event::register_event("postDllResetGlobalState", "");
-event::register_event("postDllClientConnect", "");
-event::register_event("postDllClientDisconnect", "");
-event::register_event("postDllClientKill", "");
-event::register_event("postDllClientPutInServer", "");
-event::register_event("postDllClientCommand", "");
-event::register_event("postDllClientUserInfoChanged", "");
-event::register_event("postDllServerActivate", "");
-event::register_event("postDllServerDeactivate", "");
-event::register_event("postDllPlayerPreThink", "");
-event::register_event("postDllPlayerPostThink", "");
-event::register_event("postDllStartFrame", "");
-event::register_event("postDllParmsNewLevel", "");
-event::register_event("postDllParmsChangeLevel", "");
-event::register_event("postDllGetGameDescription", "");
-event::register_event("postDllPlayerCustomization", "");
-event::register_event("postDllSpectatorConnect", "");
-event::register_event("postDllSpectatorDisconnect", "");
-event::register_event("postDllSpectatorThink", "");
-event::register_event("postDllSysError", "");
-event::register_event("postDllPMMove", "");
-event::register_event("postDllPMInit", "");
-event::register_event("postDllPMFindTextureType", "");
-event::register_event("postDllSetupVisibility", "");
-event::register_event("postDllUpdateClientData", "");
-event::register_event("postDllAddToFullPack", "");
-event::register_event("postDllCreateBaseline", "");
-event::register_event("postDllRegisterEncoders", "");
-event::register_event("postDllGetWeaponData", "");
-event::register_event("postDllCmdStart", "");
-event::register_event("postDllCmdEnd", "");
-event::register_event("postDllConnectionlessPacket", "");
-event::register_event("postDllGetHullBounds", "");
-event::register_event("postDllCreateInstancedBaselines", "");
-event::register_event("postDllInconsistentFile", "");
-event::register_event("postDllAllowLagCompensation", "");
+      event::register_event(EventId::postDllGameInit, "");
+event::register_event(EventId::postDllSpawn, "");
+event::register_event(EventId::postDllThink, "");
+event::register_event(EventId::postDllUse, "");
+event::register_event(EventId::postDllTouch, "");
+event::register_event(EventId::postDllBlocked, "");
+event::register_event(EventId::postDllKeyValue, "");
+event::register_event(EventId::postDllSave, "");
+event::register_event(EventId::postDllRestore, "");
+event::register_event(EventId::postDllSetAbsBox, "");
+event::register_event(EventId::postDllSaveWriteFields, "");
+event::register_event(EventId::postDllSaveReadFields, "");
+event::register_event(EventId::postDllSaveGlobalState, "");
+event::register_event(EventId::postDllRestoreGlobalState, "");
+event::register_event(EventId::postDllResetGlobalState, "");
+event::register_event(EventId::postDllClientConnect, "");
+event::register_event(EventId::postDllClientDisconnect, "");
+event::register_event(EventId::postDllClientKill, "");
+event::register_event(EventId::postDllClientPutInServer, "");
+event::register_event(EventId::postDllClientCommand, "");
+event::register_event(EventId::postDllClientUserInfoChanged, "");
+event::register_event(EventId::postDllServerActivate, "");
+event::register_event(EventId::postDllServerDeactivate, "");
+event::register_event(EventId::postDllPlayerPreThink, "");
+event::register_event(EventId::postDllPlayerPostThink, "");
+event::register_event(EventId::postDllStartFrame, "");
+event::register_event(EventId::postDllParmsNewLevel, "");
+event::register_event(EventId::postDllParmsChangeLevel, "");
+event::register_event(EventId::postDllGetGameDescription, "");
+event::register_event(EventId::postDllPlayerCustomization, "");
+event::register_event(EventId::postDllSpectatorConnect, "");
+event::register_event(EventId::postDllSpectatorDisconnect, "");
+event::register_event(EventId::postDllSpectatorThink, "");
+event::register_event(EventId::postDllSysError, "");
+event::register_event(EventId::postDllPMMove, "");
+event::register_event(EventId::postDllPMInit, "");
+event::register_event(EventId::postDllPMFindTextureType, "");
+event::register_event(EventId::postDllSetupVisibility, "");
+event::register_event(EventId::postDllUpdateClientData, "");
+event::register_event(EventId::postDllAddToFullPack, "");
+event::register_event(EventId::postDllCreateBaseline, "");
+event::register_event(EventId::postDllRegisterEncoders, "");
+event::register_event(EventId::postDllGetWeaponData, "");
+event::register_event(EventId::postDllCmdStart, "");
+event::register_event(EventId::postDllCmdEnd, "");
+event::register_event(EventId::postDllConnectionlessPacket, "");
+event::register_event(EventId::postDllGetHullBounds, "");
+event::register_event(EventId::postDllCreateInstancedBaselines, "");
+event::register_event(EventId::postDllInconsistentFile, "");
+event::register_event(EventId::postDllAllowLagCompensation, "");
     }
   
\ No newline at end of file
@@ -5,9 +5,10 @@
 #include "meta_api.h"
 #include "node/nodeimpl.hpp"
 #include "node/utils.hpp"
+#include "node/arena.hpp"
 
 #define V8_STUFF() v8::Isolate* isolate = info.GetIsolate(); \
-  v8::Locker locker(isolate); \
+  V8_ASSERT_LOCKED(isolate); \
   v8::HandleScope scope(isolate); \
   v8::Local<v8::Context> context = isolate->GetCurrentContext()
 
@@ -112,7 +113,7 @@ void sf_dll_pfnSaveWriteFields(const v8::FunctionCallbackInfo<v8::Value>& info)
   //}
 
   (*gpGamedllFuncs->dllapi_table->pfnSaveWriteFields)(structures::unwrapSaveRestoreData(isolate, info[0]),
-utils::js2string(isolate, info[1]),
+arena::frameString(isolate, info[1]),
 nullptr /* void* not supported */,
 structures::unwrapTypeDescription(isolate, info[3]),
 info[4]->Int32Value(context).ToChecked());
@@ -128,7 +129,7 @@ void sf_dll_pfnSaveReadFields(const v8::FunctionCallbackInfo<v8::Value>& info)
   //}
 
   (*gpGamedllFuncs->dllapi_table->pfnSaveReadFields)(structures::unwrapSaveRestoreData(isolate, info[0]),
-utils::js2string(isolate, info[1]),
+arena::frameString(isolate, info[1]),
 nullptr /* void* not supported */,
 structures::unwrapTypeDescription(isolate, info[3]),
 info[4]->Int32Value(context).ToChecked());
@@ -164,9 +165,9 @@ void sf_dll_pfnClientConnect(const v8::FunctionCallbackInfo<v8::Value>& info)
   V8_STUFF();
 
   info.GetReturnValue().Set(v8::Boolean::New(isolate, (*gpGamedllFuncs->dllapi_table->pfnClientConnect)(structures::unwrapEntity(isolate, info[0]),
-utils::js2string(isolate, info[1]),
-utils::js2string(isolate, info[2]),
-utils::js2string(isolate, info[3]))));
+arena::frameString(isolate, info[1]),
+arena::frameString(isolate, info[2]),
+arena::frameBuffer(isolate, info[3]))));
 }
 
 // nodemod.dll.clientDisconnect(pEntity: Entity);
@@ -207,7 +208,7 @@ void sf_dll_pfnClientUserInfoChanged(const v8::FunctionCallbackInfo<v8::Value>&
   V8_STUFF();
 
   (*gpGamedllFuncs->dllapi_table->pfnClientUserInfoChanged)(structures::unwrapEntity(isolate, info[0]),
-utils::js2string(isolate, info[1]));
+arena::frameString(isolate, info[1]));
 }
 
 // nodemod.dll.serverActivate(pEdictList: Entity, edictCount: number, clientMax: number);
@@ -315,7 +316,7 @@ void sf_dll_pfnSys_Error(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  (*gpGamedllFuncs->dllapi_table->pfnSys_Error)(utils::js2string(isolate, info[0]));
+  (*gpGamedllFuncs->dllapi_table->pfnSys_Error)(arena::frameString(isolate, info[0]));
 }
 
 // nodemod.dll.pMMove(ppmove: PlayerMove, server: boolean);
@@ -340,7 +341,7 @@ void sf_dll_pfnPM_FindTextureType(const v8::FunctionCallbackInfo<v8::Value>& inf
 {
   V8_STUFF();
 
-  info.GetReturnValue().Set(v8::Number::New(isolate, (*gpGamedllFuncs->dllapi_table->pfnPM_FindTextureType)(utils::js2string(isolate, info[0]))));
+  info.GetReturnValue().Set(v8::Number::New(isolate, (*gpGamedllFuncs->dllapi_table->pfnPM_FindTextureType)(arena::frameString(isolate, info[0]))));
 }
 
 // nodemod.dll.setupVisibility(pViewEntity: Entity, pClient: Entity, pvs: number[], pas: number[]);
@@ -441,8 +442,8 @@ void sf_dll_pfnConnectionlessPacket(const v8::FunctionCallbackInfo<v8::Value>& i
   //}
 
   info.GetReturnValue().Set(v8::Number::New(isolate, (*gpGamedllFuncs->dllapi_table->pfnConnectionlessPacket)(structures::unwrapNetAdr(isolate, info[0]),
-utils::js2string(isolate, info[1]),
-utils::js2string(isolate, info[2]),
+arena::frameString(isolate, info[1]),
+arena::frameString(isolate, info[2]),
 (int*)utils::jsToPointer(isolate, info[3]))));
 }
 
@@ -477,8 +478,8 @@ void sf_dll_pfnInconsistentFile(const v8::FunctionCallbackInfo<v8::Value>& info)
   V8_STUFF();
 
   info.GetReturnValue().Set(v8::Number::New(isolate, (*gpGamedllFuncs->dllapi_table->pfnInconsistentFile)(structures::unwrapEntity(isolate, info[0]),
-utils::js2string(isolate, info[1]),
-utils::js2string(isolate, info[2]))));
+arena::frameString(isolate, info[1]),
+arena::frameString(isolate, info[2]))));
 }
 
 // nodemod.dll.allowLagCompensation();
@@ -489,7 +490,7 @@ void sf_dll_pfnAllowLagCompensation(const v8::FunctionCallbackInfo<v8::Value>& i
   info.GetReturnValue().Set(v8::Number::New(isolate, (*gpGamedllFuncs->dllapi_table->pfnAllowLagCompensation)()));
 }
 
-static std::pair<std::string, v8::FunctionCallback> gamedllSpecificFunctions[] = {
+static utils::NativeFunction gamedllSpecificFunctions[] = {
   { "gameInit", sf_dll_pfnGameInit },
   { "spawn", sf_dll_pfnSpawn },
   { "think", sf_dll_pfnThink },
@@ -544,7 +545,7 @@ static std::pair<std::string, v8::FunctionCallback> gamedllSpecificFunctions[] =
 v8::Local<v8::ObjectTemplate> registerDllFunctions(v8::Isolate* isolate) {
   v8::Local <v8::ObjectTemplate> object = v8::ObjectTemplate::New(isolate);
   for (auto &routine : gamedllSpecificFunctions) {
-    object-> Set(v8::String::NewFromUtf8(isolate, routine.first.c_str(), v8::NewStringType::kNormal).ToLocalChecked(), v8::FunctionTemplate::New(isolate, routine.second));
+    object-> Set(v8::String::NewFromUtf8(isolate, routine.name.c_str(), v8::NewStringType::kNormal).ToLocalChecked(), v8::FunctionTemplate::New(isolate, routine.callback, v8::Local<v8::Value>(), v8::Local<v8::Signature>(), 0, v8::ConstructorBehavior::kAllow, v8::SideEffectType::kHasSideEffect, routine.fast));
   };
   
   return object;
@@ -2,6 +2,16 @@
   #include <extdll.h>
   #include "node/nodeimpl.hpp"
   #include "node/events.hpp"
+  #include "node/batch.hpp"
+  #include "node/trace.hpp"
+  #include "node/watchdog.hpp"
+  #include "node/arena.hpp"
+  #include "node/snapshot.hpp"
+  #include "node/spatial.hpp"
+  #include "node/cvars.hpp"
+  #include "node/stringtable.hpp"
+  #include "node/messages.hpp"
+  #include "lib/hooks.hpp"
   #include "meta_api.h"
   #include "node/utils.hpp"
   #include "structures/structures.hpp"
@@ -10,14 +20,13 @@
     // nodemod.on('engPrecacheModel', (s) => console.log('engPrecacheModel fired!'));
   int eng_pfnPrecacheModel (const char * s) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engPrecacheModel", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engPrecacheModel)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::engPrecacheModel, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, s ? s : "").ToLocalChecked(); // s (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(s), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -25,14 +34,13 @@
 // nodemod.on('engPrecacheSound', (s) => console.log('engPrecacheSound fired!'));
   int eng_pfnPrecacheSound (const char * s) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engPrecacheSound", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engPrecacheSound)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::engPrecacheSound, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, s ? s : "").ToLocalChecked(); // s (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(s), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -40,26 +48,24 @@
 // nodemod.on('engSetModel', (e, m) => console.log('engSetModel fired!'));
   void eng_pfnSetModel (edict_t * e, const char * m) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engSetModel", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engSetModel)) return;
+    batch::record(EventId::engSetModel, e, m);
+    event::findAndCall<2>(EventId::engSetModel, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, e); // e (edict_t *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, m ? m : "").ToLocalChecked(); // m (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(e, m));
   }
 
 // nodemod.on('engModelIndex', (m) => console.log('engModelIndex fired!'));
   int eng_pfnModelIndex (const char * m) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engModelIndex", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engModelIndex)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::engModelIndex, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, m ? m : "").ToLocalChecked(); // m (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(m), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -67,14 +73,13 @@
 // nodemod.on('engModelFrames', (modelIndex) => console.log('engModelFrames fired!'));
   int eng_pfnModelFrames (int modelIndex) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engModelFrames", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engModelFrames)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::engModelFrames, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, modelIndex); // modelIndex (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(modelIndex), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -82,61 +87,56 @@
 // nodemod.on('engSetSize', (e, rgflMin, rgflMax) => console.log('engSetSize fired!'));
   void eng_pfnSetSize (edict_t * e, const float * rgflMin, const float * rgflMax) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engSetSize", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::engSetSize)) return;
+    batch::record(EventId::engSetSize, e, rgflMin, rgflMax);
+    event::findAndCall<3>(EventId::engSetSize, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, e); // e (edict_t *)
       v8_args[1] = utils::floatArrayToJS(isolate, rgflMin, 3); // rgflMin (const float *)
       v8_args[2] = utils::floatArrayToJS(isolate, rgflMax, 3); // rgflMax (const float *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(e, rgflMin, rgflMax));
   }
 
 // nodemod.on('engChangeLevel', (s1, s2) => console.log('engChangeLevel fired!'));
   void eng_pfnChangeLevel (const char * s1, const char * s2) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engChangeLevel", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engChangeLevel)) return;
+    batch::record(EventId::engChangeLevel, s1, s2);
+    event::findAndCall<2>(EventId::engChangeLevel, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, s1 ? s1 : "").ToLocalChecked(); // s1 (const char *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, s2 ? s2 : "").ToLocalChecked(); // s2 (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(s1, s2));
   }
 
 // nodemod.on('engGetSpawnParms', (ent) => console.log('engGetSpawnParms fired!'));
   void eng_pfnGetSpawnParms (edict_t * ent) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engGetSpawnParms", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engGetSpawnParms)) return;
+    batch::record(EventId::engGetSpawnParms, ent);
+    event::findAndCall<1>(EventId::engGetSpawnParms, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, ent); // ent (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(ent));
   }
 
 // nodemod.on('engSaveSpawnParms', (ent) => console.log('engSaveSpawnParms fired!'));
   void eng_pfnSaveSpawnParms (edict_t * ent) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engSaveSpawnParms", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engSaveSpawnParms)) return;
+    batch::record(EventId::engSaveSpawnParms, ent);
+    event::findAndCall<1>(EventId::engSaveSpawnParms, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, ent); // ent (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(ent));
   }
 
 // nodemod.on('engVecToYaw', (rgflVector) => console.log('engVecToYaw fired!'));
   float eng_pfnVecToYaw (const float * rgflVector) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engVecToYaw", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engVecToYaw)) return 0.0f;
+    float returnValue{};
+    event::findAndCall<1>(EventId::engVecToYaw, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::floatArrayToJS(isolate, rgflVector, 3); // rgflVector (const float *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(rgflVector), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (float)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0.0f;
   }
@@ -144,64 +144,58 @@
 // nodemod.on('engVecToAngles', (rgflVectorIn, rgflVectorOut) => console.log('engVecToAngles fired!'));
   void eng_pfnVecToAngles (const float * rgflVectorIn, float * rgflVectorOut) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engVecToAngles", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engVecToAngles)) return;
+    event::findAndCall<2>(EventId::engVecToAngles, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::floatArrayToJS(isolate, rgflVectorIn, 3); // rgflVectorIn (const float *)
       v8_args[1] = utils::floatArrayToJS(isolate, rgflVectorOut, 3); // rgflVectorOut (float *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(rgflVectorIn, rgflVectorOut));
   }
 
 // nodemod.on('engMoveToOrigin', (ent, pflGoal, dist, iMoveType) => console.log('engMoveToOrigin fired!'));
   void eng_pfnMoveToOrigin (edict_t * ent, const float * pflGoal, float dist, int iMoveType) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engMoveToOrigin", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 4;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[4];
+    if (!hooks::active(EventId::engMoveToOrigin)) return;
+    batch::record(EventId::engMoveToOrigin, ent, pflGoal, dist, iMoveType);
+    event::findAndCall<4>(EventId::engMoveToOrigin, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, ent); // ent (edict_t *)
       v8_args[1] = utils::floatArrayToJS(isolate, pflGoal, 3); // pflGoal (const float *)
       v8_args[2] = v8::Number::New(isolate, dist); // dist (float)
       v8_args[3] = v8::Number::New(isolate, iMoveType); // iMoveType (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(ent, pflGoal, dist, iMoveType));
   }
 
 // nodemod.on('engChangeYaw', (ent) => console.log('engChangeYaw fired!'));
   void eng_pfnChangeYaw (edict_t* ent) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engChangeYaw", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engChangeYaw)) return;
+    batch::record(EventId::engChangeYaw, ent);
+    event::findAndCall<1>(EventId::engChangeYaw, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, ent); // ent (edict_t*)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(ent));
   }
 
 // nodemod.on('engChangePitch', (ent) => console.log('engChangePitch fired!'));
   void eng_pfnChangePitch (edict_t* ent) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engChangePitch", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engChangePitch)) return;
+    batch::record(EventId::engChangePitch, ent);
+    event::findAndCall<1>(EventId::engChangePitch, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, ent); // ent (edict_t*)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(ent));
   }
 
 // nodemod.on('engFindEntityByString', (pEdictStartSearchAfter, pszField, pszValue) => console.log('engFindEntityByString fired!'));
   edict_t* eng_pfnFindEntityByString (edict_t * pEdictStartSearchAfter, const char * pszField, const char * pszValue) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engFindEntityByString", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::engFindEntityByString)) return nullptr;
+    edict_t* returnValue{};
+    event::findAndCall<3>(EventId::engFindEntityByString, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdictStartSearchAfter); // pEdictStartSearchAfter (edict_t *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, pszField ? pszField : "").ToLocalChecked(); // pszField (const char *)
       v8_args[2] = v8::String::NewFromUtf8(isolate, pszValue ? pszValue : "").ToLocalChecked(); // pszValue (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdictStartSearchAfter, pszField, pszValue), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (edict_t*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -209,14 +203,13 @@
 // nodemod.on('engGetEntityIllum', (pEnt) => console.log('engGetEntityIllum fired!'));
   int eng_pfnGetEntityIllum (edict_t* pEnt) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engGetEntityIllum", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engGetEntityIllum)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::engGetEntityIllum, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEnt); // pEnt (edict_t*)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEnt), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -224,16 +217,15 @@
 // nodemod.on('engFindEntityInSphere', (pEdictStartSearchAfter, org, rad) => console.log('engFindEntityInSphere fired!'));
   edict_t* eng_pfnFindEntityInSphere (edict_t * pEdictStartSearchAfter, const float * org, float rad) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engFindEntityInSphere", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::engFindEntityInSphere)) return nullptr;
+    edict_t* returnValue{};
+    event::findAndCall<3>(EventId::engFindEntityInSphere, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdictStartSearchAfter); // pEdictStartSearchAfter (edict_t *)
       v8_args[1] = utils::floatArrayToJS(isolate, org, 3); // org (const float *)
       v8_args[2] = v8::Number::New(isolate, rad); // rad (float)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdictStartSearchAfter, org, rad), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (edict_t*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -241,14 +233,13 @@
 // nodemod.on('engFindClientInPVS', (pEdict) => console.log('engFindClientInPVS fired!'));
   edict_t* eng_pfnFindClientInPVS (edict_t * pEdict) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engFindClientInPVS", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engFindClientInPVS)) return nullptr;
+    edict_t* returnValue{};
+    event::findAndCall<1>(EventId::engFindClientInPVS, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (edict_t*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -256,14 +247,13 @@
 // nodemod.on('engEntitiesInPVS', (pplayer) => console.log('engEntitiesInPVS fired!'));
   edict_t* eng_pfnEntitiesInPVS (edict_t * pplayer) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engEntitiesInPVS", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engEntitiesInPVS)) return nullptr;
+    edict_t* returnValue{};
+    event::findAndCall<1>(EventId::engEntitiesInPVS, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pplayer); // pplayer (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pplayer), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (edict_t*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -271,34 +261,33 @@
 // nodemod.on('engMakeVectors', (rgflVector) => console.log('engMakeVectors fired!'));
   void eng_pfnMakeVectors (const float * rgflVector) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engMakeVectors", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engMakeVectors)) return;
+    batch::record(EventId::engMakeVectors, rgflVector);
+    event::findAndCall<1>(EventId::engMakeVectors, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::floatArrayToJS(isolate, rgflVector, 3); // rgflVector (const float *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(rgflVector));
   }
 
 // nodemod.on('engAngleVectors', (rgflVector, forward, right, up) => console.log('engAngleVectors fired!'));
   void eng_pfnAngleVectors (const float * rgflVector, float * forward, float * right, float * up) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engAngleVectors", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 4;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[4];
+    if (!hooks::active(EventId::engAngleVectors)) return;
+    event::findAndCall<4>(EventId::engAngleVectors, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::floatArrayToJS(isolate, rgflVector, 3); // rgflVector (const float *)
       v8_args[1] = utils::floatArrayToJS(isolate, forward, 3); // forward (float *)
       v8_args[2] = utils::floatArrayToJS(isolate, right, 3); // right (float *)
       v8_args[3] = utils::floatArrayToJS(isolate, up, 3); // up (float *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(rgflVector, forward, right, up));
   }
 
 // nodemod.on('engCreateEntity', () => console.log('engCreateEntity fired!'));
   edict_t* eng_pfnCreateEntity () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engCreateEntity", nullptr, 0);
+    if (!hooks::active(EventId::engCreateEntity)) return nullptr;
+    edict_t* returnValue{};
+    event::findAndCall(EventId::engCreateEntity, nullptr, 0, event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (edict_t*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -306,25 +295,23 @@
 // nodemod.on('engRemoveEntity', (e) => console.log('engRemoveEntity fired!'));
   void eng_pfnRemoveEntity (edict_t* e) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engRemoveEntity", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engRemoveEntity)) return;
+    batch::record(EventId::engRemoveEntity, e);
+    event::findAndCall<1>(EventId::engRemoveEntity, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, e); // e (edict_t*)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(e));
   }
 
 // nodemod.on('engCreateNamedEntity', (className) => console.log('engCreateNamedEntity fired!'));
   edict_t* eng_pfnCreateNamedEntity (int className) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engCreateNamedEntity", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engCreateNamedEntity)) return nullptr;
+    edict_t* returnValue{};
+    event::findAndCall<1>(EventId::engCreateNamedEntity, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, className); // className (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(className), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (edict_t*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -332,25 +319,23 @@
 // nodemod.on('engMakeStatic', (ent) => console.log('engMakeStatic fired!'));
   void eng_pfnMakeStatic (edict_t * ent) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engMakeStatic", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engMakeStatic)) return;
+    batch::record(EventId::engMakeStatic, ent);
+    event::findAndCall<1>(EventId::engMakeStatic, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, ent); // ent (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(ent));
   }
 
 // nodemod.on('engEntIsOnFloor', (e) => console.log('engEntIsOnFloor fired!'));
   int eng_pfnEntIsOnFloor (edict_t * e) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engEntIsOnFloor", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engEntIsOnFloor)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::engEntIsOnFloor, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, e); // e (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(e), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -358,14 +343,13 @@
 // nodemod.on('engDropToFloor', (e) => console.log('engDropToFloor fired!'));
   int eng_pfnDropToFloor (edict_t* e) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engDropToFloor", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engDropToFloor)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::engDropToFloor, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, e); // e (edict_t*)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(e), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -373,17 +357,16 @@
 // nodemod.on('engWalkMove', (ent, yaw, dist, iMode) => console.log('engWalkMove fired!'));
   int eng_pfnWalkMove (edict_t * ent, float yaw, float dist, int iMode) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engWalkMove", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 4;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[4];
+    if (!hooks::active(EventId::engWalkMove)) return 0;
+    int returnValue{};
+    event::findAndCall<4>(EventId::engWalkMove, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, ent); // ent (edict_t *)
       v8_args[1] = v8::Number::New(isolate, yaw); // yaw (float)
       v8_args[2] = v8::Number::New(isolate, dist); // dist (float)
       v8_args[3] = v8::Number::New(isolate, iMode); // iMode (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(ent, yaw, dist, iMode), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -391,21 +374,20 @@
 // nodemod.on('engSetOrigin', (e, rgflOrigin) => console.log('engSetOrigin fired!'));
   void eng_pfnSetOrigin (edict_t * e, const float * rgflOrigin) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engSetOrigin", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engSetOrigin)) return;
+    batch::record(EventId::engSetOrigin, e, rgflOrigin);
+    event::findAndCall<2>(EventId::engSetOrigin, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, e); // e (edict_t *)
       v8_args[1] = utils::floatArrayToJS(isolate, rgflOrigin, 3); // rgflOrigin (const float *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(e, rgflOrigin));
   }
 
 // nodemod.on('engEmitSound', (entity, channel, sample, volume, attenuation, fFlags, pitch) => console.log('engEmitSound fired!'));
   void eng_pfnEmitSound (edict_t * entity, int channel, const char * sample, float volume, float attenuation, int fFlags, int pitch) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engEmitSound", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 7;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[7];
+    if (!hooks::active(EventId::engEmitSound)) return;
+    batch::record(EventId::engEmitSound, entity, channel, sample, volume, attenuation, fFlags, pitch);
+    event::findAndCall<7>(EventId::engEmitSound, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, entity); // entity (edict_t *)
       v8_args[1] = v8::Number::New(isolate, channel); // channel (int)
       v8_args[2] = v8::String::NewFromUtf8(isolate, sample ? sample : "").ToLocalChecked(); // sample (const char *)
@@ -413,16 +395,15 @@
       v8_args[4] = v8::Number::New(isolate, attenuation); // attenuation (float)
       v8_args[5] = v8::Number::New(isolate, fFlags); // fFlags (int)
       v8_args[6] = v8::Number::New(isolate, pitch); // pitch (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(entity, channel, sample, volume, attenuation, fFlags, pitch));
   }
 
 // nodemod.on('engEmitAmbientSound', (entity, pos, samp, vol, attenuation, fFlags, pitch) => console.log('engEmitAmbientSound fired!'));
   void eng_pfnEmitAmbientSound (edict_t * entity, const float * pos, const char * samp, float vol, float attenuation, int fFlags, int pitch) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engEmitAmbientSound", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 7;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[7];
+    if (!hooks::active(EventId::engEmitAmbientSound)) return;
+    batch::record(EventId::engEmitAmbientSound, entity, pos, samp, vol, attenuation, fFlags, pitch);
+    event::findAndCall<7>(EventId::engEmitAmbientSound, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, entity); // entity (edict_t *)
       v8_args[1] = utils::floatArrayToJS(isolate, pos, 3); // pos (const float *)
       v8_args[2] = v8::String::NewFromUtf8(isolate, samp ? samp : "").ToLocalChecked(); // samp (const char *)
@@ -430,54 +411,48 @@
       v8_args[4] = v8::Number::New(isolate, attenuation); // attenuation (float)
       v8_args[5] = v8::Number::New(isolate, fFlags); // fFlags (int)
       v8_args[6] = v8::Number::New(isolate, pitch); // pitch (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(entity, pos, samp, vol, attenuation, fFlags, pitch));
   }
 
 // nodemod.on('engTraceLine', (v1, v2, fNoMonsters, pentToSkip, ptr) => console.log('engTraceLine fired!'));
   void eng_pfnTraceLine (const float * v1, const float * v2, int fNoMonsters, edict_t * pentToSkip, TraceResult * ptr) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engTraceLine", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 5;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[5];
+    if (!hooks::active(EventId::engTraceLine)) return;
+    event::findAndCall<5>(EventId::engTraceLine, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::floatArrayToJS(isolate, v1, 3); // v1 (const float *)
       v8_args[1] = utils::floatArrayToJS(isolate, v2, 3); // v2 (const float *)
       v8_args[2] = v8::Number::New(isolate, fNoMonsters); // fNoMonsters (int)
       v8_args[3] = structures::wrapEntity(isolate, pentToSkip); // pentToSkip (edict_t *)
       v8_args[4] = structures::wrapTraceResult(isolate, ptr); // ptr (TraceResult *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(v1, v2, fNoMonsters, pentToSkip, ptr));
   }
 
 // nodemod.on('engTraceToss', (pent, pentToIgnore, ptr) => console.log('engTraceToss fired!'));
   void eng_pfnTraceToss (edict_t* pent, edict_t* pentToIgnore, TraceResult * ptr) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engTraceToss", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::engTraceToss)) return;
+    event::findAndCall<3>(EventId::engTraceToss, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pent); // pent (edict_t*)
       v8_args[1] = structures::wrapEntity(isolate, pentToIgnore); // pentToIgnore (edict_t*)
       v8_args[2] = structures::wrapTraceResult(isolate, ptr); // ptr (TraceResult *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pent, pentToIgnore, ptr));
   }
 
 // nodemod.on('engTraceMonsterHull', (pEdict, v1, v2, fNoMonsters, pentToSkip, ptr) => console.log('engTraceMonsterHull fired!'));
   int eng_pfnTraceMonsterHull (edict_t * pEdict, const float * v1, const float * v2, int fNoMonsters, edict_t * pentToSkip, TraceResult * ptr) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engTraceMonsterHull", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 6;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[6];
+    if (!hooks::active(EventId::engTraceMonsterHull)) return 0;
+    int returnValue{};
+    event::findAndCall<6>(EventId::engTraceMonsterHull, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (edict_t *)
       v8_args[1] = utils::floatArrayToJS(isolate, v1, 3); // v1 (const float *)
       v8_args[2] = utils::floatArrayToJS(isolate, v2, 3); // v2 (const float *)
       v8_args[3] = v8::Number::New(isolate, fNoMonsters); // fNoMonsters (int)
       v8_args[4] = structures::wrapEntity(isolate, pentToSkip); // pentToSkip (edict_t *)
       v8_args[5] = structures::wrapTraceResult(isolate, ptr); // ptr (TraceResult *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict, v1, v2, fNoMonsters, pentToSkip, ptr), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -485,47 +460,42 @@
 // nodemod.on('engTraceHull', (v1, v2, fNoMonsters, hullNumber, pentToSkip, ptr) => console.log('engTraceHull fired!'));
   void eng_pfnTraceHull (const float * v1, const float * v2, int fNoMonsters, int hullNumber, edict_t * pentToSkip, TraceResult * ptr) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engTraceHull", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 6;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[6];
+    if (!hooks::active(EventId::engTraceHull)) return;
+    event::findAndCall<6>(EventId::engTraceHull, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::floatArrayToJS(isolate, v1, 3); // v1 (const float *)
       v8_args[1] = utils::floatArrayToJS(isolate, v2, 3); // v2 (const float *)
       v8_args[2] = v8::Number::New(isolate, fNoMonsters); // fNoMonsters (int)
       v8_args[3] = v8::Number::New(isolate, hullNumber); // hullNumber (int)
       v8_args[4] = structures::wrapEntity(isolate, pentToSkip); // pentToSkip (edict_t *)
       v8_args[5] = structures::wrapTraceResult(isolate, ptr); // ptr (TraceResult *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(v1, v2, fNoMonsters, hullNumber, pentToSkip, ptr));
   }
 
 // nodemod.on('engTraceModel', (v1, v2, hullNumber, pent, ptr) => console.log('engTraceModel fired!'));
   void eng_pfnTraceModel (const float * v1, const float * v2, int hullNumber, edict_t * pent, TraceResult * ptr) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engTraceModel", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 5;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[5];
+    if (!hooks::active(EventId::engTraceModel)) return;
+    event::findAndCall<5>(EventId::engTraceModel, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::floatArrayToJS(isolate, v1, 3); // v1 (const float *)
       v8_args[1] = utils::floatArrayToJS(isolate, v2, 3); // v2 (const float *)
       v8_args[2] = v8::Number::New(isolate, hullNumber); // hullNumber (int)
       v8_args[3] = structures::wrapEntity(isolate, pent); // pent (edict_t *)
       v8_args[4] = structures::wrapTraceResult(isolate, ptr); // ptr (TraceResult *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(v1, v2, hullNumber, pent, ptr));
   }
 
 // nodemod.on('engTraceTexture', (pTextureEntity, v1, v2) => console.log('engTraceTexture fired!'));
   const char * eng_pfnTraceTexture (edict_t * pTextureEntity, const float * v1, const float * v2) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engTraceTexture", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::engTraceTexture)) return nullptr;
+    const char * returnValue{};
+    event::findAndCall<3>(EventId::engTraceTexture, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pTextureEntity); // pTextureEntity (edict_t *)
       v8_args[1] = utils::floatArrayToJS(isolate, v1, 3); // v1 (const float *)
       v8_args[2] = utils::floatArrayToJS(isolate, v2, 3); // v2 (const float *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pTextureEntity, v1, v2), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (const char *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -533,98 +503,89 @@
 // nodemod.on('engTraceSphere', (v1, v2, fNoMonsters, radius, pentToSkip, ptr) => console.log('engTraceSphere fired!'));
   void eng_pfnTraceSphere (const float * v1, const float * v2, int fNoMonsters, float radius, edict_t * pentToSkip, TraceResult * ptr) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engTraceSphere", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 6;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[6];
+    if (!hooks::active(EventId::engTraceSphere)) return;
+    event::findAndCall<6>(EventId::engTraceSphere, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::floatArrayToJS(isolate, v1, 3); // v1 (const float *)
       v8_args[1] = utils::floatArrayToJS(isolate, v2, 3); // v2 (const float *)
       v8_args[2] = v8::Number::New(isolate, fNoMonsters); // fNoMonsters (int)
       v8_args[3] = v8::Number::New(isolate, radius); // radius (float)
       v8_args[4] = structures::wrapEntity(isolate, pentToSkip); // pentToSkip (edict_t *)
       v8_args[5] = structures::wrapTraceResult(isolate, ptr); // ptr (TraceResult *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(v1, v2, fNoMonsters, radius, pentToSkip, ptr));
   }
 
 // nodemod.on('engGetAimVector', (ent, speed, rgflReturn) => console.log('engGetAimVector fired!'));
   void eng_pfnGetAimVector (edict_t * ent, float speed, float * rgflReturn) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engGetAimVector", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::engGetAimVector)) return;
+    event::findAndCall<3>(EventId::engGetAimVector, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, ent); // ent (edict_t *)
       v8_args[1] = v8::Number::New(isolate, speed); // speed (float)
       v8_args[2] = utils::floatArrayToJS(isolate, rgflReturn, 3); // rgflReturn (float *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(ent, speed, rgflReturn));
   }
 
 // nodemod.on('engServerCommand', (str) => console.log('engServerCommand fired!'));
   void eng_pfnServerCommand (const char * str) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engServerCommand", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engServerCommand)) return;
+    batch::record(EventId::engServerCommand, str);
+    event::findAndCall<1>(EventId::engServerCommand, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, str ? str : "").ToLocalChecked(); // str (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(str));
   }
 
 // nodemod.on('engServerExecute', () => console.log('engServerExecute fired!'));
   void eng_pfnServerExecute () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engServerExecute", nullptr, 0);
+    if (!hooks::active(EventId::engServerExecute)) return;
+    event::findAndCall(EventId::engServerExecute, nullptr, 0);
   }
 
 // nodemod.on('engClientCommand', (pEdict, szFmt) => console.log('engClientCommand fired!'));
   void eng_pfnClientCommand (edict_t* ed, const char *szFmt, ...) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engClientCommand", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-  v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
-  v8_args[0] = structures::wrapEntity(isolate, ed);
+    if (!hooks::active(EventId::engClientCommand)) return;
+    event::findAndCall<2>(EventId::engClientCommand, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
+      v8_args[0] = structures::wrapEntity(isolate, ed);
   v8_args[1] = v8::String::NewFromUtf8(isolate, CMD_ARGS()).ToLocalChecked();
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
     });
   }
 
 // nodemod.on('engParticleEffect', (org, dir, color, count) => console.log('engParticleEffect fired!'));
   void eng_pfnParticleEffect (const float * org, const float * dir, float color, float count) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engParticleEffect", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 4;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[4];
+    if (!hooks::active(EventId::engParticleEffect)) return;
+    batch::record(EventId::engParticleEffect, org, dir, color, count);
+    event::findAndCall<4>(EventId::engParticleEffect, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::floatArrayToJS(isolate, org, 3); // org (const float *)
       v8_args[1] = utils::floatArrayToJS(isolate, dir, 3); // dir (const float *)
       v8_args[2] = v8::Number::New(isolate, color); // color (float)
       v8_args[3] = v8::Number::New(isolate, count); // count (float)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(org, dir, color, count));
   }
 
 // nodemod.on('engLightStyle', (style, val) => console.log('engLightStyle fired!'));
   void eng_pfnLightStyle (int style, const char * val) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engLightStyle", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engLightStyle)) return;
+    batch::record(EventId::engLightStyle, style, val);
+    event::findAndCall<2>(EventId::engLightStyle, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, style); // style (int)
       v8_args[1] = v8::String::NewFromUtf8(isolate, val ? val : "").ToLocalChecked(); // val (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(style, val));
   }
 
 // nodemod.on('engDecalIndex', (name) => console.log('engDecalIndex fired!'));
   int eng_pfnDecalIndex (const char * name) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engDecalIndex", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engDecalIndex)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::engDecalIndex, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, name ? name : "").ToLocalChecked(); // name (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(name), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -632,14 +593,13 @@
 // nodemod.on('engPointContents', (rgflVector) => console.log('engPointContents fired!'));
   int eng_pfnPointContents (const float * rgflVector) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engPointContents", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engPointContents)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::engPointContents, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::floatArrayToJS(isolate, rgflVector, 3); // rgflVector (const float *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(rgflVector), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -647,133 +607,152 @@
 // nodemod.on('engMessageBegin', (msg_dest, msg_type, pOrigin, ed) => console.log('engMessageBegin fired!'));
   void eng_pfnMessageBegin (int msg_dest, int msg_type, const float * pOrigin, edict_t * ed) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engMessageBegin", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 4;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[4];
+    if (!hooks::active(EventId::engMessageBegin)) return;
+    if (messages::replaying) return;
+    if (messages::begin(msg_dest, msg_type, pOrigin, ed)) SET_META_RESULT(MRES_SUPERCEDE);
+
+    batch::record(EventId::engMessageBegin, msg_dest, msg_type, pOrigin, ed);
+    event::findAndCall<4>(EventId::engMessageBegin, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, msg_dest); // msg_dest (int)
       v8_args[1] = v8::Number::New(isolate, msg_type); // msg_type (int)
       v8_args[2] = utils::floatArrayToJS(isolate, pOrigin, 3); // pOrigin (const float *)
       v8_args[3] = structures::wrapEntity(isolate, ed); // ed (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(msg_dest, msg_type, pOrigin, ed));
   }
 
 // nodemod.on('engMessageEnd', () => console.log('engMessageEnd fired!'));
   void eng_pfnMessageEnd () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engMessageEnd", nullptr, 0);
+    if (!hooks::active(EventId::engMessageEnd)) return;
+    if (messages::replaying) return;
+
+    event::findAndCall(EventId::engMessageEnd, nullptr, 0);
+    if (messages::end()) SET_META_RESULT(MRES_SUPERCEDE);
   }
 
 // nodemod.on('engWriteByte', (iValue) => console.log('engWriteByte fired!'));
   void eng_pfnWriteByte (int iValue) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engWriteByte", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engWriteByte)) return;
+    if (messages::replaying) return;
+    if (messages::writeInt(messages::Field::Byte, iValue)) SET_META_RESULT(MRES_SUPERCEDE);
+
+    batch::record(EventId::engWriteByte, iValue);
+    event::findAndCall<1>(EventId::engWriteByte, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, iValue); // iValue (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(iValue));
   }
 
 // nodemod.on('engWriteChar', (iValue) => console.log('engWriteChar fired!'));
   void eng_pfnWriteChar (int iValue) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engWriteChar", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engWriteChar)) return;
+    if (messages::replaying) return;
+    if (messages::writeInt(messages::Field::Char, iValue)) SET_META_RESULT(MRES_SUPERCEDE);
+
+    batch::record(EventId::engWriteChar, iValue);
+    event::findAndCall<1>(EventId::engWriteChar, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, iValue); // iValue (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(iValue));
   }
 
 // nodemod.on('engWriteShort', (iValue) => console.log('engWriteShort fired!'));
   void eng_pfnWriteShort (int iValue) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engWriteShort", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engWriteShort)) return;
+    if (messages::replaying) return;
+    if (messages::writeInt(messages::Field::Short, iValue)) SET_META_RESULT(MRES_SUPERCEDE);
+
+    batch::record(EventId::engWriteShort, iValue);
+    event::findAndCall<1>(EventId::engWriteShort, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, iValue); // iValue (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(iValue));
   }
 
 // nodemod.on('engWriteLong', (iValue) => console.log('engWriteLong fired!'));
   void eng_pfnWriteLong (int iValue) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engWriteLong", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engWriteLong)) return;
+    if (messages::replaying) return;
+    if (messages::writeInt(messages::Field::Long, iValue)) SET_META_RESULT(MRES_SUPERCEDE);
+
+    batch::record(EventId::engWriteLong, iValue);
+    event::findAndCall<1>(EventId::engWriteLong, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, iValue); // iValue (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(iValue));
   }
 
 // nodemod.on('engWriteAngle', (flValue) => console.log('engWriteAngle fired!'));
   void eng_pfnWriteAngle (float flValue) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engWriteAngle", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engWriteAngle)) return;
+    if (messages::replaying) return;
+    if (messages::writeFloat(messages::Field::Angle, flValue)) SET_META_RESULT(MRES_SUPERCEDE);
+
+    batch::record(EventId::engWriteAngle, flValue);
+    event::findAndCall<1>(EventId::engWriteAngle, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, flValue); // flValue (float)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(flValue));
   }
 
 // nodemod.on('engWriteCoord', (flValue) => console.log('engWriteCoord fired!'));
   void eng_pfnWriteCoord (float flValue) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engWriteCoord", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engWriteCoord)) return;
+    if (messages::replaying) return;
+    if (messages::writeFloat(messages::Field::Coord, flValue)) SET_META_RESULT(MRES_SUPERCEDE);
+
+    batch::record(EventId::engWriteCoord, flValue);
+    event::findAndCall<1>(EventId::engWriteCoord, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, flValue); // flValue (float)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(flValue));
   }
 
 // nodemod.on('engWriteString', (sz) => console.log('engWriteString fired!'));
   void eng_pfnWriteString (const char * sz) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engWriteString", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engWriteString)) return;
+    if (messages::replaying) return;
+    if (messages::writeString(sz)) SET_META_RESULT(MRES_SUPERCEDE);
+
+    batch::record(EventId::engWriteString, sz);
+    event::findAndCall<1>(EventId::engWriteString, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, sz ? sz : "").ToLocalChecked(); // sz (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(sz));
   }
 
 // nodemod.on('engWriteEntity', (iValue) => console.log('engWriteEntity fired!'));
   void eng_pfnWriteEntity (int iValue) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engWriteEntity", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engWriteEntity)) return;
+    if (messages::replaying) return;
+    if (messages::writeInt(messages::Field::Entity, iValue)) SET_META_RESULT(MRES_SUPERCEDE);
+
+    batch::record(EventId::engWriteEntity, iValue);
+    event::findAndCall<1>(EventId::engWriteEntity, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, iValue); // iValue (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(iValue));
   }
 
 // nodemod.on('engCVarRegister', (pCvar) => console.log('engCVarRegister fired!'));
   void eng_pfnCVarRegister (cvar_t * pCvar) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engCVarRegister", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engCVarRegister)) return;
+    event::findAndCall<1>(EventId::engCVarRegister, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapCvar(isolate, pCvar); // pCvar (cvar_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pCvar));
   }
 
 // nodemod.on('engCVarGetFloat', (szVarName) => console.log('engCVarGetFloat fired!'));
   float eng_pfnCVarGetFloat (const char * szVarName) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engCVarGetFloat", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engCVarGetFloat)) return 0.0f;
+    float returnValue{};
+    event::findAndCall<1>(EventId::engCVarGetFloat, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, szVarName ? szVarName : "").ToLocalChecked(); // szVarName (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(szVarName), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (float)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0.0f;
   }
@@ -781,14 +760,13 @@
 // nodemod.on('engCVarGetString', (szVarName) => console.log('engCVarGetString fired!'));
   const char* eng_pfnCVarGetString (const char * szVarName) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engCVarGetString", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engCVarGetString)) return nullptr;
+    const char* returnValue{};
+    event::findAndCall<1>(EventId::engCVarGetString, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, szVarName ? szVarName : "").ToLocalChecked(); // szVarName (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(szVarName), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (const char*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -796,63 +774,56 @@
 // nodemod.on('engCVarSetFloat', (szVarName, flValue) => console.log('engCVarSetFloat fired!'));
   void eng_pfnCVarSetFloat (const char * szVarName, float flValue) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engCVarSetFloat", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engCVarSetFloat)) return;
+    batch::record(EventId::engCVarSetFloat, szVarName, flValue);
+    event::findAndCall<2>(EventId::engCVarSetFloat, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, szVarName ? szVarName : "").ToLocalChecked(); // szVarName (const char *)
       v8_args[1] = v8::Number::New(isolate, flValue); // flValue (float)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(szVarName, flValue));
   }
 
 // nodemod.on('engCVarSetString', (szVarName, szValue) => console.log('engCVarSetString fired!'));
   void eng_pfnCVarSetString (const char * szVarName, const char * szValue) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engCVarSetString", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engCVarSetString)) return;
+    batch::record(EventId::engCVarSetString, szVarName, szValue);
+    event::findAndCall<2>(EventId::engCVarSetString, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, szVarName ? szVarName : "").ToLocalChecked(); // szVarName (const char *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, szValue ? szValue : "").ToLocalChecked(); // szValue (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(szVarName, szValue));
   }
 
 // nodemod.on('engAlertMessage', (atype, szFmt) => console.log('engAlertMessage fired!'));
   void eng_pfnAlertMessage (ALERT_TYPE atype, const char * szFmt, ...) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engAlertMessage", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engAlertMessage)) return;
+    event::findAndCall<2>(EventId::engAlertMessage, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, atype); // atype (ALERT_TYPE)
       v8_args[1] = v8::String::NewFromUtf8(isolate, szFmt ? szFmt : "").ToLocalChecked(); // szFmt (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(atype, szFmt));
   }
 
 // nodemod.on('engEngineFprintf', (pfile, szFmt) => console.log('engEngineFprintf fired!'));
   void eng_pfnEngineFprintf (FILE * pfile, const char * szFmt, ...) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engEngineFprintf", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engEngineFprintf)) return;
+    event::findAndCall<2>(EventId::engEngineFprintf, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::External::New(isolate, pfile); // pfile (FILE *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, szFmt ? szFmt : "").ToLocalChecked(); // szFmt (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pfile, szFmt));
   }
 
 // nodemod.on('engPvAllocEntPrivateData', (pEdict, cb) => console.log('engPvAllocEntPrivateData fired!'));
   void* eng_pfnPvAllocEntPrivateData (edict_t * pEdict, int cb) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engPvAllocEntPrivateData", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engPvAllocEntPrivateData)) return nullptr;
+    void* returnValue{};
+    event::findAndCall<2>(EventId::engPvAllocEntPrivateData, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (edict_t *)
       v8_args[1] = v8::Number::New(isolate, cb); // cb (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict, cb), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (void*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -860,14 +831,13 @@
 // nodemod.on('engPvEntPrivateData', (pEdict) => console.log('engPvEntPrivateData fired!'));
   void* eng_pfnPvEntPrivateData (edict_t * pEdict) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engPvEntPrivateData", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engPvEntPrivateData)) return nullptr;
+    void* returnValue{};
+    event::findAndCall<1>(EventId::engPvEntPrivateData, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (void*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -875,25 +845,23 @@
 // nodemod.on('engFreeEntPrivateData', (pEdict) => console.log('engFreeEntPrivateData fired!'));
   void eng_pfnFreeEntPrivateData (edict_t * pEdict) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engFreeEntPrivateData", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engFreeEntPrivateData)) return;
+    batch::record(EventId::engFreeEntPrivateData, pEdict);
+    event::findAndCall<1>(EventId::engFreeEntPrivateData, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict));
   }
 
 // nodemod.on('engSzFromIndex', (iString) => console.log('engSzFromIndex fired!'));
   const char * eng_pfnSzFromIndex (int iString) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engSzFromIndex", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engSzFromIndex)) return nullptr;
+    const char * returnValue{};
+    event::findAndCall<1>(EventId::engSzFromIndex, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, iString); // iString (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(iString), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (const char *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -901,14 +869,13 @@
 // nodemod.on('engAllocString', (szValue) => console.log('engAllocString fired!'));
   int eng_pfnAllocString (const char * szValue) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engAllocString", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engAllocString)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::engAllocString, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, szValue ? szValue : "").ToLocalChecked(); // szValue (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(szValue), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -916,14 +883,13 @@
 // nodemod.on('engGetVarsOfEnt', (pEdict) => console.log('engGetVarsOfEnt fired!'));
   struct entvars_s * eng_pfnGetVarsOfEnt (edict_t * pEdict) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engGetVarsOfEnt", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engGetVarsOfEnt)) return nullptr;
+    struct entvars_s * returnValue{};
+    event::findAndCall<1>(EventId::engGetVarsOfEnt, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (struct entvars_s *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -931,14 +897,13 @@
 // nodemod.on('engPEntityOfEntOffset', (iEntOffset) => console.log('engPEntityOfEntOffset fired!'));
   edict_t* eng_pfnPEntityOfEntOffset (int iEntOffset) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engPEntityOfEntOffset", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engPEntityOfEntOffset)) return nullptr;
+    edict_t* returnValue{};
+    event::findAndCall<1>(EventId::engPEntityOfEntOffset, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, iEntOffset); // iEntOffset (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(iEntOffset), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (edict_t*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -946,14 +911,13 @@
 // nodemod.on('engEntOffsetOfPEntity', (pEdict) => console.log('engEntOffsetOfPEntity fired!'));
   int eng_pfnEntOffsetOfPEntity (const edict_t * pEdict) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engEntOffsetOfPEntity", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engEntOffsetOfPEntity)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::engEntOffsetOfPEntity, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (const edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -961,14 +925,13 @@
 // nodemod.on('engIndexOfEdict', (pEdict) => console.log('engIndexOfEdict fired!'));
   int eng_pfnIndexOfEdict (const edict_t * pEdict) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engIndexOfEdict", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engIndexOfEdict)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::engIndexOfEdict, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (const edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -976,14 +939,13 @@
 // nodemod.on('engPEntityOfEntIndex', (iEntIndex) => console.log('engPEntityOfEntIndex fired!'));
   edict_t* eng_pfnPEntityOfEntIndex (int iEntIndex) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engPEntityOfEntIndex", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engPEntityOfEntIndex)) return nullptr;
+    edict_t* returnValue{};
+    event::findAndCall<1>(EventId::engPEntityOfEntIndex, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, iEntIndex); // iEntIndex (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(iEntIndex), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (edict_t*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -991,14 +953,13 @@
 // nodemod.on('engFindEntityByVars', (pvars) => console.log('engFindEntityByVars fired!'));
   edict_t* eng_pfnFindEntityByVars (struct entvars_s* pvars) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engFindEntityByVars", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engFindEntityByVars)) return nullptr;
+    edict_t* returnValue{};
+    event::findAndCall<1>(EventId::engFindEntityByVars, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntvars(isolate, pvars); // pvars (struct entvars_s*)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pvars), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (edict_t*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -1006,14 +967,13 @@
 // nodemod.on('engGetModelPtr', (pEdict) => console.log('engGetModelPtr fired!'));
   void* eng_pfnGetModelPtr (edict_t* pEdict) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engGetModelPtr", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engGetModelPtr)) return nullptr;
+    void* returnValue{};
+    event::findAndCall<1>(EventId::engGetModelPtr, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (edict_t*)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (void*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -1021,15 +981,14 @@
 // nodemod.on('engRegUserMsg', (pszName, iSize) => console.log('engRegUserMsg fired!'));
   int eng_pfnRegUserMsg (const char * pszName, int iSize) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engRegUserMsg", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engRegUserMsg)) return 0;
+    int returnValue{};
+    event::findAndCall<2>(EventId::engRegUserMsg, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, pszName ? pszName : "").ToLocalChecked(); // pszName (const char *)
       v8_args[1] = v8::Number::New(isolate, iSize); // iSize (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pszName, iSize), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -1037,40 +996,36 @@
 // nodemod.on('engAnimationAutomove', (pEdict, flTime) => console.log('engAnimationAutomove fired!'));
   void eng_pfnAnimationAutomove (const edict_t* pEdict, float flTime) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engAnimationAutomove", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engAnimationAutomove)) return;
+    batch::record(EventId::engAnimationAutomove, pEdict, flTime);
+    event::findAndCall<2>(EventId::engAnimationAutomove, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (const edict_t*)
       v8_args[1] = v8::Number::New(isolate, flTime); // flTime (float)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict, flTime));
   }
 
 // nodemod.on('engGetBonePosition', (pEdict, iBone, rgflOrigin, rgflAngles) => console.log('engGetBonePosition fired!'));
   void eng_pfnGetBonePosition (const edict_t* pEdict, int iBone, float * rgflOrigin, float * rgflAngles) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engGetBonePosition", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 4;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[4];
+    if (!hooks::active(EventId::engGetBonePosition)) return;
+    event::findAndCall<4>(EventId::engGetBonePosition, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (const edict_t*)
       v8_args[1] = v8::Number::New(isolate, iBone); // iBone (int)
       v8_args[2] = utils::floatArrayToJS(isolate, rgflOrigin, 3); // rgflOrigin (float *)
       v8_args[3] = utils::floatArrayToJS(isolate, rgflAngles, 3); // rgflAngles (float *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict, iBone, rgflOrigin, rgflAngles));
   }
 
 // nodemod.on('engFunctionFromName', (pName) => console.log('engFunctionFromName fired!'));
   void* eng_pfnFunctionFromName (const char * pName) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engFunctionFromName", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engFunctionFromName)) return nullptr;
+    void* returnValue{};
+    event::findAndCall<1>(EventId::engFunctionFromName, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, pName ? pName : "").ToLocalChecked(); // pName (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pName), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (void*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -1078,14 +1033,13 @@
 // nodemod.on('engNameForFunction', (function) => console.log('engNameForFunction fired!'));
   const char * eng_pfnNameForFunction (void * function) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engNameForFunction", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engNameForFunction)) return nullptr;
+    const char * returnValue{};
+    event::findAndCall<1>(EventId::engNameForFunction, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::External::New(isolate, function); // function (void *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(function), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (const char *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -1093,33 +1047,33 @@
 // nodemod.on('engClientPrintf', (pEdict, ptype, szMsg) => console.log('engClientPrintf fired!'));
   void eng_pfnClientPrintf (edict_t* pEdict, PRINT_TYPE ptype, const char * szMsg) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engClientPrintf", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::engClientPrintf)) return;
+    batch::record(EventId::engClientPrintf, pEdict, ptype, szMsg);
+    event::findAndCall<3>(EventId::engClientPrintf, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (edict_t*)
       v8_args[1] = v8::Number::New(isolate, ptype); // ptype (PRINT_TYPE)
       v8_args[2] = v8::String::NewFromUtf8(isolate, szMsg ? szMsg : "").ToLocalChecked(); // szMsg (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict, ptype, szMsg));
   }
 
 // nodemod.on('engServerPrint', (szMsg) => console.log('engServerPrint fired!'));
   void eng_pfnServerPrint (const char * szMsg) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engServerPrint", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engServerPrint)) return;
+    batch::record(EventId::engServerPrint, szMsg);
+    event::findAndCall<1>(EventId::engServerPrint, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, szMsg ? szMsg : "").ToLocalChecked(); // szMsg (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(szMsg));
   }
 
 // nodemod.on('engCmdArgs', () => console.log('engCmdArgs fired!'));
   const char * eng_pfnCmd_Args () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engCmdArgs", nullptr, 0);
+    if (!hooks::active(EventId::engCmdArgs)) return nullptr;
+    const char * returnValue{};
+    event::findAndCall(EventId::engCmdArgs, nullptr, 0, event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (const char *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -1127,14 +1081,13 @@
 // nodemod.on('engCmdArgv', (argc) => console.log('engCmdArgv fired!'));
   const char * eng_pfnCmd_Argv (int argc) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engCmdArgv", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engCmdArgv)) return nullptr;
+    const char * returnValue{};
+    event::findAndCall<1>(EventId::engCmdArgv, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, argc); // argc (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(argc), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (const char *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -1142,9 +1095,11 @@
 // nodemod.on('engCmdArgc', () => console.log('engCmdArgc fired!'));
   int eng_pfnCmd_Argc () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engCmdArgc", nullptr, 0);
+    if (!hooks::active(EventId::engCmdArgc)) return 0;
+    int returnValue{};
+    event::findAndCall(EventId::engCmdArgc, nullptr, 0, event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -1152,64 +1107,55 @@
 // nodemod.on('engGetAttachment', (pEdict, iAttachment, rgflOrigin, rgflAngles) => console.log('engGetAttachment fired!'));
   void eng_pfnGetAttachment (const edict_t * pEdict, int iAttachment, float * rgflOrigin, float * rgflAngles) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engGetAttachment", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 4;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[4];
+    if (!hooks::active(EventId::engGetAttachment)) return;
+    event::findAndCall<4>(EventId::engGetAttachment, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (const edict_t *)
       v8_args[1] = v8::Number::New(isolate, iAttachment); // iAttachment (int)
       v8_args[2] = utils::floatArrayToJS(isolate, rgflOrigin, 3); // rgflOrigin (float *)
       v8_args[3] = utils::floatArrayToJS(isolate, rgflAngles, 3); // rgflAngles (float *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict, iAttachment, rgflOrigin, rgflAngles));
   }
 
 // nodemod.on('engCRC32Init', (pulCRC) => console.log('engCRC32Init fired!'));
   void eng_pfnCRC32_Init (CRC32_t * pulCRC) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engCRC32Init", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engCRC32Init)) return;
+    event::findAndCall<1>(EventId::engCRC32Init, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::External::New(isolate, pulCRC); // pulCRC (CRC32_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pulCRC));
   }
 
 // nodemod.on('engCRC32ProcessBuffer', (pulCRC, p, len) => console.log('engCRC32ProcessBuffer fired!'));
   void eng_pfnCRC32_ProcessBuffer (CRC32_t * pulCRC, void * p, int len) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engCRC32ProcessBuffer", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::engCRC32ProcessBuffer)) return;
+    event::findAndCall<3>(EventId::engCRC32ProcessBuffer, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::External::New(isolate, pulCRC); // pulCRC (CRC32_t *)
       v8_args[1] = v8::External::New(isolate, p); // p (void *)
       v8_args[2] = v8::Number::New(isolate, len); // len (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pulCRC, p, len));
   }
 
 // nodemod.on('engCRC32ProcessByte', (pulCRC, ch) => console.log('engCRC32ProcessByte fired!'));
   void eng_pfnCRC32_ProcessByte (CRC32_t * pulCRC, unsigned char ch) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engCRC32ProcessByte", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engCRC32ProcessByte)) return;
+    event::findAndCall<2>(EventId::engCRC32ProcessByte, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::External::New(isolate, pulCRC); // pulCRC (CRC32_t *)
       v8_args[1] = v8::Number::New(isolate, ch); // ch (unsigned char)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pulCRC, ch));
   }
 
 // nodemod.on('engCRC32Final', (pulCRC) => console.log('engCRC32Final fired!'));
   CRC32_t eng_pfnCRC32_Final (CRC32_t pulCRC) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engCRC32Final", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engCRC32Final)) return 0;
+    CRC32_t returnValue{};
+    event::findAndCall<1>(EventId::engCRC32Final, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, pulCRC); // pulCRC (CRC32_t)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pulCRC), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (CRC32_t)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -1217,15 +1163,14 @@
 // nodemod.on('engRandomLong', (lLow, lHigh) => console.log('engRandomLong fired!'));
   int eng_pfnRandomLong (int lLow, int lHigh) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engRandomLong", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engRandomLong)) return 0;
+    int returnValue{};
+    event::findAndCall<2>(EventId::engRandomLong, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, lLow); // lLow (int)
       v8_args[1] = v8::Number::New(isolate, lHigh); // lHigh (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(lLow, lHigh), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -1233,15 +1178,14 @@
 // nodemod.on('engRandomFloat', (flLow, flHigh) => console.log('engRandomFloat fired!'));
   float eng_pfnRandomFloat (float flLow, float flHigh) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engRandomFloat", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engRandomFloat)) return 0.0f;
+    float returnValue{};
+    event::findAndCall<2>(EventId::engRandomFloat, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, flLow); // flLow (float)
       v8_args[1] = v8::Number::New(isolate, flHigh); // flHigh (float)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(flLow, flHigh), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (float)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0.0f;
   }
@@ -1249,21 +1193,22 @@
 // nodemod.on('engSetView', (pClient, pViewent) => console.log('engSetView fired!'));
   void eng_pfnSetView (const edict_t * pClient, const edict_t * pViewent) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engSetView", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engSetView)) return;
+    batch::record(EventId::engSetView, pClient, pViewent);
+    event::findAndCall<2>(EventId::engSetView, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pClient); // pClient (const edict_t *)
       v8_args[1] = structures::wrapEntity(isolate, pViewent); // pViewent (const edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pClient, pViewent));
   }
 
 // nodemod.on('engTime', () => console.log('engTime fired!'));
   float eng_pfnTime () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engTime", nullptr, 0);
+    if (!hooks::active(EventId::engTime)) return 0.0f;
+    float returnValue{};
+    event::findAndCall(EventId::engTime, nullptr, 0, event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (float)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0.0f;
   }
@@ -1271,28 +1216,26 @@
 // nodemod.on('engCrosshairAngle', (pClient, pitch, yaw) => console.log('engCrosshairAngle fired!'));
   void eng_pfnCrosshairAngle (const edict_t * pClient, float pitch, float yaw) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engCrosshairAngle", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::engCrosshairAngle)) return;
+    batch::record(EventId::engCrosshairAngle, pClient, pitch, yaw);
+    event::findAndCall<3>(EventId::engCrosshairAngle, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pClient); // pClient (const edict_t *)
       v8_args[1] = v8::Number::New(isolate, pitch); // pitch (float)
       v8_args[2] = v8::Number::New(isolate, yaw); // yaw (float)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pClient, pitch, yaw));
   }
 
 // nodemod.on('engLoadFileForMe', (filename, pLength) => console.log('engLoadFileForMe fired!'));
   byte* eng_pfnLoadFileForMe (const char * filename, int * pLength) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engLoadFileForMe", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engLoadFileForMe)) return nullptr;
+    byte* returnValue{};
+    event::findAndCall<2>(EventId::engLoadFileForMe, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, filename ? filename : "").ToLocalChecked(); // filename (const char *)
       v8_args[1] = utils::intArrayToJS(isolate, pLength, 1); // pLength (int *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(filename, pLength), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (byte*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -1300,38 +1243,34 @@
 // nodemod.on('engFreeFile', (buffer) => console.log('engFreeFile fired!'));
   void eng_pfnFreeFile (void * buffer) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engFreeFile", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engFreeFile)) return;
+    event::findAndCall<1>(EventId::engFreeFile, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::External::New(isolate, buffer); // buffer (void *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(buffer));
   }
 
 // nodemod.on('engEndSection', (pszSectionName) => console.log('engEndSection fired!'));
   void eng_pfnEndSection (const char * pszSectionName) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engEndSection", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engEndSection)) return;
+    batch::record(EventId::engEndSection, pszSectionName);
+    event::findAndCall<1>(EventId::engEndSection, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, pszSectionName ? pszSectionName : "").ToLocalChecked(); // pszSectionName (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pszSectionName));
   }
 
 // nodemod.on('engCompareFileTime', (filename1, filename2, iCompare) => console.log('engCompareFileTime fired!'));
   int eng_pfnCompareFileTime (char * filename1, char * filename2, int * iCompare) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engCompareFileTime", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::engCompareFileTime)) return 0;
+    int returnValue{};
+    event::findAndCall<3>(EventId::engCompareFileTime, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, filename1 ? filename1 : "").ToLocalChecked(); // filename1 (char *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, filename2 ? filename2 : "").ToLocalChecked(); // filename2 (char *)
       v8_args[2] = utils::intArrayToJS(isolate, iCompare, 1); // iCompare (int *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(filename1, filename2, iCompare), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -1339,63 +1278,57 @@
 // nodemod.on('engGetGameDir', (szGetGameDir) => console.log('engGetGameDir fired!'));
   void eng_pfnGetGameDir (char * szGetGameDir) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engGetGameDir", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engGetGameDir)) return;
+    batch::record(EventId::engGetGameDir, szGetGameDir);
+    event::findAndCall<1>(EventId::engGetGameDir, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, szGetGameDir ? szGetGameDir : "").ToLocalChecked(); // szGetGameDir (char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(szGetGameDir));
   }
 
 // nodemod.on('engCvarRegisterVariable', (variable) => console.log('engCvarRegisterVariable fired!'));
   void eng_pfnCvar_RegisterVariable (cvar_t * variable) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engCvarRegisterVariable", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engCvarRegisterVariable)) return;
+    event::findAndCall<1>(EventId::engCvarRegisterVariable, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapCvar(isolate, variable); // variable (cvar_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(variable));
   }
 
 // nodemod.on('engFadeClientVolume', (pEdict, fadePercent, fadeOutSeconds, holdTime, fadeInSeconds) => console.log('engFadeClientVolume fired!'));
   void eng_pfnFadeClientVolume (const edict_t * pEdict, int fadePercent, int fadeOutSeconds, int holdTime, int fadeInSeconds) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engFadeClientVolume", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 5;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[5];
+    if (!hooks::active(EventId::engFadeClientVolume)) return;
+    batch::record(EventId::engFadeClientVolume, pEdict, fadePercent, fadeOutSeconds, holdTime, fadeInSeconds);
+    event::findAndCall<5>(EventId::engFadeClientVolume, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (const edict_t *)
       v8_args[1] = v8::Number::New(isolate, fadePercent); // fadePercent (int)
       v8_args[2] = v8::Number::New(isolate, fadeOutSeconds); // fadeOutSeconds (int)
       v8_args[3] = v8::Number::New(isolate, holdTime); // holdTime (int)
       v8_args[4] = v8::Number::New(isolate, fadeInSeconds); // fadeInSeconds (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict, fadePercent, fadeOutSeconds, holdTime, fadeInSeconds));
   }
 
 // nodemod.on('engSetClientMaxspeed', (pEdict, fNewMaxspeed) => console.log('engSetClientMaxspeed fired!'));
   void eng_pfnSetClientMaxspeed (const edict_t * pEdict, float fNewMaxspeed) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engSetClientMaxspeed", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engSetClientMaxspeed)) return;
+    batch::record(EventId::engSetClientMaxspeed, pEdict, fNewMaxspeed);
+    event::findAndCall<2>(EventId::engSetClientMaxspeed, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (const edict_t *)
       v8_args[1] = v8::Number::New(isolate, fNewMaxspeed); // fNewMaxspeed (float)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict, fNewMaxspeed));
   }
 
 // nodemod.on('engCreateFakeClient', (netname) => console.log('engCreateFakeClient fired!'));
   edict_t * eng_pfnCreateFakeClient (const char * netname) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engCreateFakeClient", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engCreateFakeClient)) return nullptr;
+    edict_t * returnValue{};
+    event::findAndCall<1>(EventId::engCreateFakeClient, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, netname ? netname : "").ToLocalChecked(); // netname (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(netname), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (edict_t *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -1403,9 +1336,9 @@
 // nodemod.on('engRunPlayerMove', (fakeclient, viewangles, forwardmove, sidemove, upmove, buttons, impulse, msec) => console.log('engRunPlayerMove fired!'));
   void eng_pfnRunPlayerMove (edict_t * fakeclient, const float * viewangles, float forwardmove, float sidemove, float upmove, unsigned short buttons, byte impulse, byte msec) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engRunPlayerMove", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 8;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[8];
+    if (!hooks::active(EventId::engRunPlayerMove)) return;
+    batch::record(EventId::engRunPlayerMove, fakeclient, viewangles, forwardmove, sidemove, upmove, buttons, impulse, msec);
+    event::findAndCall<8>(EventId::engRunPlayerMove, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, fakeclient); // fakeclient (edict_t *)
       v8_args[1] = utils::floatArrayToJS(isolate, viewangles, 3); // viewangles (const float *)
       v8_args[2] = v8::Number::New(isolate, forwardmove); // forwardmove (float)
@@ -1414,16 +1347,17 @@
       v8_args[5] = v8::Number::New(isolate, buttons); // buttons (unsigned short)
       v8_args[6] = v8::Number::New(isolate, impulse); // impulse (byte)
       v8_args[7] = v8::Number::New(isolate, msec); // msec (byte)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(fakeclient, viewangles, forwardmove, sidemove, upmove, buttons, impulse, msec));
   }
 
 // nodemod.on('engNumberOfEntities', () => console.log('engNumberOfEntities fired!'));
   int eng_pfnNumberOfEntities () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engNumberOfEntities", nullptr, 0);
+    if (!hooks::active(EventId::engNumberOfEntities)) return 0;
+    int returnValue{};
+    event::findAndCall(EventId::engNumberOfEntities, nullptr, 0, event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -1431,14 +1365,13 @@
 // nodemod.on('engGetInfoKeyBuffer', (e) => console.log('engGetInfoKeyBuffer fired!'));
   char* eng_pfnGetInfoKeyBuffer (edict_t * e) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engGetInfoKeyBuffer", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engGetInfoKeyBuffer)) return nullptr;
+    char* returnValue{};
+    event::findAndCall<1>(EventId::engGetInfoKeyBuffer, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, e); // e (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(e), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (char*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -1446,15 +1379,14 @@
 // nodemod.on('engInfoKeyValue', (infobuffer, key) => console.log('engInfoKeyValue fired!'));
   char* eng_pfnInfoKeyValue (char * infobuffer, const char * key) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engInfoKeyValue", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engInfoKeyValue)) return nullptr;
+    char* returnValue{};
+    event::findAndCall<2>(EventId::engInfoKeyValue, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, infobuffer ? infobuffer : "").ToLocalChecked(); // infobuffer (char *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, key ? key : "").ToLocalChecked(); // key (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(infobuffer, key), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (char*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -1462,41 +1394,38 @@
 // nodemod.on('engSetKeyValue', (infobuffer, key, value) => console.log('engSetKeyValue fired!'));
   void eng_pfnSetKeyValue (char * infobuffer, const char * key, const char * value) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engSetKeyValue", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::engSetKeyValue)) return;
+    batch::record(EventId::engSetKeyValue, infobuffer, key, value);
+    event::findAndCall<3>(EventId::engSetKeyValue, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, infobuffer ? infobuffer : "").ToLocalChecked(); // infobuffer (char *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, key ? key : "").ToLocalChecked(); // key (const char *)
       v8_args[2] = v8::String::NewFromUtf8(isolate, value ? value : "").ToLocalChecked(); // value (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(infobuffer, key, value));
   }
 
 // nodemod.on('engSetClientKeyValue', (clientIndex, infobuffer, key, value) => console.log('engSetClientKeyValue fired!'));
   void eng_pfnSetClientKeyValue (int clientIndex, char * infobuffer, const char * key, const char * value) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engSetClientKeyValue", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 4;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[4];
+    if (!hooks::active(EventId::engSetClientKeyValue)) return;
+    batch::record(EventId::engSetClientKeyValue, clientIndex, infobuffer, key, value);
+    event::findAndCall<4>(EventId::engSetClientKeyValue, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, clientIndex); // clientIndex (int)
       v8_args[1] = v8::String::NewFromUtf8(isolate, infobuffer ? infobuffer : "").ToLocalChecked(); // infobuffer (char *)
       v8_args[2] = v8::String::NewFromUtf8(isolate, key ? key : "").ToLocalChecked(); // key (const char *)
       v8_args[3] = v8::String::NewFromUtf8(isolate, value ? value : "").ToLocalChecked(); // value (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(clientIndex, infobuffer, key, value));
   }
 
 // nodemod.on('engIsMapValid', (filename) => console.log('engIsMapValid fired!'));
   int eng_pfnIsMapValid (const char * filename) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engIsMapValid", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engIsMapValid)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::engIsMapValid, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, filename ? filename : "").ToLocalChecked(); // filename (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(filename), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -1504,28 +1433,26 @@
 // nodemod.on('engStaticDecal', (origin, decalIndex, entityIndex, modelIndex) => console.log('engStaticDecal fired!'));
   void eng_pfnStaticDecal (const float * origin, int decalIndex, int entityIndex, int modelIndex) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engStaticDecal", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 4;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[4];
+    if (!hooks::active(EventId::engStaticDecal)) return;
+    batch::record(EventId::engStaticDecal, origin, decalIndex, entityIndex, modelIndex);
+    event::findAndCall<4>(EventId::engStaticDecal, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::floatArrayToJS(isolate, origin, 3); // origin (const float *)
       v8_args[1] = v8::Number::New(isolate, decalIndex); // decalIndex (int)
       v8_args[2] = v8::Number::New(isolate, entityIndex); // entityIndex (int)
       v8_args[3] = v8::Number::New(isolate, modelIndex); // modelIndex (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(origin, decalIndex, entityIndex, modelIndex));
   }
 
 // nodemod.on('engPrecacheGeneric', (s) => console.log('engPrecacheGeneric fired!'));
   int eng_pfnPrecacheGeneric (const char * s) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engPrecacheGeneric", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engPrecacheGeneric)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::engPrecacheGeneric, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, s ? s : "").ToLocalChecked(); // s (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(s), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -1533,14 +1460,13 @@
 // nodemod.on('engGetPlayerUserId', (e) => console.log('engGetPlayerUserId fired!'));
   int eng_pfnGetPlayerUserId (edict_t * e) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engGetPlayerUserId", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engGetPlayerUserId)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::engGetPlayerUserId, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, e); // e (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(e), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -1548,9 +1474,9 @@
 // nodemod.on('engBuildSoundMsg', (entity, channel, sample, volume, attenuation, fFlags, pitch, msg_dest, msg_type, pOrigin, ed) => console.log('engBuildSoundMsg fired!'));
   void eng_pfnBuildSoundMsg (edict_t * entity, int channel, const char * sample, float volume, float attenuation, int fFlags, int pitch, int msg_dest, int msg_type, const float * pOrigin, edict_t * ed) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engBuildSoundMsg", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 11;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[11];
+    if (!hooks::active(EventId::engBuildSoundMsg)) return;
+    batch::record(EventId::engBuildSoundMsg, entity, channel, sample, volume, attenuation, fFlags, pitch, msg_dest, msg_type, pOrigin, ed);
+    event::findAndCall<11>(EventId::engBuildSoundMsg, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, entity); // entity (edict_t *)
       v8_args[1] = v8::Number::New(isolate, channel); // channel (int)
       v8_args[2] = v8::String::NewFromUtf8(isolate, sample ? sample : "").ToLocalChecked(); // sample (const char *)
@@ -1562,16 +1488,17 @@
       v8_args[8] = v8::Number::New(isolate, msg_type); // msg_type (int)
       v8_args[9] = utils::floatArrayToJS(isolate, pOrigin, 3); // pOrigin (const float *)
       v8_args[10] = structures::wrapEntity(isolate, ed); // ed (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(entity, channel, sample, volume, attenuation, fFlags, pitch, msg_dest, msg_type, pOrigin, ed));
   }
 
 // nodemod.on('engIsDedicatedServer', () => console.log('engIsDedicatedServer fired!'));
   int eng_pfnIsDedicatedServer () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engIsDedicatedServer", nullptr, 0);
+    if (!hooks::active(EventId::engIsDedicatedServer)) return 0;
+    int returnValue{};
+    event::findAndCall(EventId::engIsDedicatedServer, nullptr, 0, event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -1579,14 +1506,13 @@
 // nodemod.on('engCVarGetPointer', (szVarName) => console.log('engCVarGetPointer fired!'));
   cvar_t * eng_pfnCVarGetPointer (const char * szVarName) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engCVarGetPointer", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engCVarGetPointer)) return nullptr;
+    cvar_t * returnValue{};
+    event::findAndCall<1>(EventId::engCVarGetPointer, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, szVarName ? szVarName : "").ToLocalChecked(); // szVarName (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(szVarName), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (cvar_t *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -1594,14 +1520,13 @@
 // nodemod.on('engGetPlayerWONId', (e) => console.log('engGetPlayerWONId fired!'));
   unsigned int eng_pfnGetPlayerWONId (edict_t * e) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engGetPlayerWONId", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engGetPlayerWONId)) return 0;
+    unsigned int returnValue{};
+    event::findAndCall<1>(EventId::engGetPlayerWONId, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, e); // e (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(e), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (unsigned int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -1609,27 +1534,25 @@
 // nodemod.on('engInfoRemoveKey', (s, key) => console.log('engInfoRemoveKey fired!'));
   void eng_pfnInfo_RemoveKey (char * s, const char * key) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engInfoRemoveKey", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engInfoRemoveKey)) return;
+    batch::record(EventId::engInfoRemoveKey, s, key);
+    event::findAndCall<2>(EventId::engInfoRemoveKey, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, s ? s : "").ToLocalChecked(); // s (char *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, key ? key : "").ToLocalChecked(); // key (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(s, key));
   }
 
 // nodemod.on('engGetPhysicsKeyValue', (pClient, key) => console.log('engGetPhysicsKeyValue fired!'));
   const char * eng_pfnGetPhysicsKeyValue (const edict_t * pClient, const char * key) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engGetPhysicsKeyValue", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engGetPhysicsKeyValue)) return nullptr;
+    const char * returnValue{};
+    event::findAndCall<2>(EventId::engGetPhysicsKeyValue, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pClient); // pClient (const edict_t *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, key ? key : "").ToLocalChecked(); // key (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pClient, key), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (const char *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -1637,27 +1560,25 @@
 // nodemod.on('engSetPhysicsKeyValue', (pClient, key, value) => console.log('engSetPhysicsKeyValue fired!'));
   void eng_pfnSetPhysicsKeyValue (const edict_t * pClient, const char * key, const char * value) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engSetPhysicsKeyValue", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::engSetPhysicsKeyValue)) return;
+    batch::record(EventId::engSetPhysicsKeyValue, pClient, key, value);
+    event::findAndCall<3>(EventId::engSetPhysicsKeyValue, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pClient); // pClient (const edict_t *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, key ? key : "").ToLocalChecked(); // key (const char *)
       v8_args[2] = v8::String::NewFromUtf8(isolate, value ? value : "").ToLocalChecked(); // value (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pClient, key, value));
   }
 
 // nodemod.on('engGetPhysicsInfoString', (pClient) => console.log('engGetPhysicsInfoString fired!'));
   const char * eng_pfnGetPhysicsInfoString (const edict_t * pClient) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engGetPhysicsInfoString", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engGetPhysicsInfoString)) return nullptr;
+    const char * returnValue{};
+    event::findAndCall<1>(EventId::engGetPhysicsInfoString, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pClient); // pClient (const edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pClient), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (const char *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -1665,15 +1586,14 @@
 // nodemod.on('engPrecacheEvent', (type, psz) => console.log('engPrecacheEvent fired!'));
   unsigned short eng_pfnPrecacheEvent (int type, const char* psz) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engPrecacheEvent", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engPrecacheEvent)) return 0;
+    unsigned short returnValue{};
+    event::findAndCall<2>(EventId::engPrecacheEvent, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, type); // type (int)
       v8_args[1] = v8::String::NewFromUtf8(isolate, psz ? psz : "").ToLocalChecked(); // psz (const char*)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(type, psz), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (unsigned short)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -1681,9 +1601,9 @@
 // nodemod.on('engPlaybackEvent', (flags, pInvoker, eventindex, delay, origin, angles, fparam1, fparam2, iparam1, iparam2, bparam1, bparam2) => console.log('engPlaybackEvent fired!'));
   void eng_pfnPlaybackEvent (int flags, const edict_t * pInvoker, unsigned short eventindex, float delay, const float * origin, const float * angles, float fparam1, float fparam2, int iparam1, int iparam2, int bparam1, int bparam2) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engPlaybackEvent", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 12;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[12];
+    if (!hooks::active(EventId::engPlaybackEvent)) return;
+    batch::record(EventId::engPlaybackEvent, flags, pInvoker, eventindex, delay, origin, angles, fparam1, fparam2, iparam1, iparam2, bparam1, bparam2);
+    event::findAndCall<12>(EventId::engPlaybackEvent, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, flags); // flags (int)
       v8_args[1] = structures::wrapEntity(isolate, pInvoker); // pInvoker (const edict_t *)
       v8_args[2] = v8::Number::New(isolate, eventindex); // eventindex (unsigned short)
@@ -1696,21 +1616,19 @@
       v8_args[9] = v8::Number::New(isolate, iparam2); // iparam2 (int)
       v8_args[10] = v8::Number::New(isolate, bparam1); // bparam1 (int)
       v8_args[11] = v8::Number::New(isolate, bparam2); // bparam2 (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(flags, pInvoker, eventindex, delay, origin, angles, fparam1, fparam2, iparam1, iparam2, bparam1, bparam2));
   }
 
 // nodemod.on('engSetFatPVS', (org) => console.log('engSetFatPVS fired!'));
   unsigned char * eng_pfnSetFatPVS (const float * org) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engSetFatPVS", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engSetFatPVS)) return nullptr;
+    unsigned char * returnValue{};
+    event::findAndCall<1>(EventId::engSetFatPVS, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::floatArrayToJS(isolate, org, 3); // org (const float *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(org), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (unsigned char *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -1718,14 +1636,13 @@
 // nodemod.on('engSetFatPAS', (org) => console.log('engSetFatPAS fired!'));
   unsigned char * eng_pfnSetFatPAS (const float * org) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engSetFatPAS", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engSetFatPAS)) return nullptr;
+    unsigned char * returnValue{};
+    event::findAndCall<1>(EventId::engSetFatPAS, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::floatArrayToJS(isolate, org, 3); // org (const float *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(org), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (unsigned char *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -1733,15 +1650,14 @@
 // nodemod.on('engCheckVisibility', (entity, pset) => console.log('engCheckVisibility fired!'));
   int eng_pfnCheckVisibility (const edict_t * entity, unsigned char * pset) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engCheckVisibility", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engCheckVisibility)) return 0;
+    int returnValue{};
+    event::findAndCall<2>(EventId::engCheckVisibility, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, entity); // entity (const edict_t *)
       v8_args[1] = utils::byteArrayToJS(isolate, pset, 1); // pset (unsigned char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(entity, pset), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -1749,45 +1665,41 @@
 // nodemod.on('engDeltaSetField', (pFields, fieldname) => console.log('engDeltaSetField fired!'));
   void eng_pfnDeltaSetField (struct delta_s * pFields, const char * fieldname) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engDeltaSetField", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engDeltaSetField)) return;
+    event::findAndCall<2>(EventId::engDeltaSetField, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapDelta(isolate, pFields); // pFields (struct delta_s *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, fieldname ? fieldname : "").ToLocalChecked(); // fieldname (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pFields, fieldname));
   }
 
 // nodemod.on('engDeltaUnsetField', (pFields, fieldname) => console.log('engDeltaUnsetField fired!'));
   void eng_pfnDeltaUnsetField (struct delta_s * pFields, const char * fieldname) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engDeltaUnsetField", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engDeltaUnsetField)) return;
+    event::findAndCall<2>(EventId::engDeltaUnsetField, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapDelta(isolate, pFields); // pFields (struct delta_s *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, fieldname ? fieldname : "").ToLocalChecked(); // fieldname (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pFields, fieldname));
   }
 
 // nodemod.on('engDeltaAddEncoder', (name, value1) => console.log('engDeltaAddEncoder fired!'));
   void eng_pfnDeltaAddEncoder (const char * name, void* value1) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engDeltaAddEncoder", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engDeltaAddEncoder)) return;
+    event::findAndCall<2>(EventId::engDeltaAddEncoder, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, name ? name : "").ToLocalChecked(); // name (const char *)
       v8_args[1] = v8::External::New(isolate, value1); // value1 (void*)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(name, value1));
   }
 
 // nodemod.on('engGetCurrentPlayer', () => console.log('engGetCurrentPlayer fired!'));
   int eng_pfnGetCurrentPlayer () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engGetCurrentPlayer", nullptr, 0);
+    if (!hooks::active(EventId::engGetCurrentPlayer)) return 0;
+    int returnValue{};
+    event::findAndCall(EventId::engGetCurrentPlayer, nullptr, 0, event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -1795,14 +1707,13 @@
 // nodemod.on('engCanSkipPlayer', (player) => console.log('engCanSkipPlayer fired!'));
   int eng_pfnCanSkipPlayer (const edict_t * player) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engCanSkipPlayer", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engCanSkipPlayer)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::engCanSkipPlayer, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, player); // player (const edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(player), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -1810,15 +1721,14 @@
 // nodemod.on('engDeltaFindField', (pFields, fieldname) => console.log('engDeltaFindField fired!'));
   int eng_pfnDeltaFindField (struct delta_s * pFields, const char * fieldname) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engDeltaFindField", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engDeltaFindField)) return 0;
+    int returnValue{};
+    event::findAndCall<2>(EventId::engDeltaFindField, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapDelta(isolate, pFields); // pFields (struct delta_s *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, fieldname ? fieldname : "").ToLocalChecked(); // fieldname (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pFields, fieldname), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -1826,51 +1736,45 @@
 // nodemod.on('engDeltaSetFieldByIndex', (pFields, fieldNumber) => console.log('engDeltaSetFieldByIndex fired!'));
   void eng_pfnDeltaSetFieldByIndex (struct delta_s * pFields, int fieldNumber) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engDeltaSetFieldByIndex", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engDeltaSetFieldByIndex)) return;
+    event::findAndCall<2>(EventId::engDeltaSetFieldByIndex, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapDelta(isolate, pFields); // pFields (struct delta_s *)
       v8_args[1] = v8::Number::New(isolate, fieldNumber); // fieldNumber (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pFields, fieldNumber));
   }
 
 // nodemod.on('engDeltaUnsetFieldByIndex', (pFields, fieldNumber) => console.log('engDeltaUnsetFieldByIndex fired!'));
   void eng_pfnDeltaUnsetFieldByIndex (struct delta_s * pFields, int fieldNumber) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engDeltaUnsetFieldByIndex", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engDeltaUnsetFieldByIndex)) return;
+    event::findAndCall<2>(EventId::engDeltaUnsetFieldByIndex, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapDelta(isolate, pFields); // pFields (struct delta_s *)
       v8_args[1] = v8::Number::New(isolate, fieldNumber); // fieldNumber (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pFields, fieldNumber));
   }
 
 // nodemod.on('engSetGroupMask', (mask, op) => console.log('engSetGroupMask fired!'));
   void eng_pfnSetGroupMask (int mask, int op) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engSetGroupMask", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engSetGroupMask)) return;
+    batch::record(EventId::engSetGroupMask, mask, op);
+    event::findAndCall<2>(EventId::engSetGroupMask, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, mask); // mask (int)
       v8_args[1] = v8::Number::New(isolate, op); // op (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(mask, op));
   }
 
 // nodemod.on('engCreateInstancedBaseline', (classname, baseline) => console.log('engCreateInstancedBaseline fired!'));
   int eng_pfnCreateInstancedBaseline (int classname, struct entity_state_s * baseline) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engCreateInstancedBaseline", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engCreateInstancedBaseline)) return 0;
+    int returnValue{};
+    event::findAndCall<2>(EventId::engCreateInstancedBaseline, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, classname); // classname (int)
       v8_args[1] = structures::wrapEntityState(isolate, baseline); // baseline (struct entity_state_s *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(classname, baseline), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -1878,66 +1782,58 @@
 // nodemod.on('engCvarDirectSet', (var, value) => console.log('engCvarDirectSet fired!'));
   void eng_pfnCvar_DirectSet (struct cvar_s * var, const char * value) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engCvarDirectSet", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engCvarDirectSet)) return;
+    event::findAndCall<2>(EventId::engCvarDirectSet, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapCvar(isolate, var); // var (struct cvar_s *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, value ? value : "").ToLocalChecked(); // value (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(var, value));
   }
 
 // nodemod.on('engForceUnmodified', (type, mins, maxs, filename) => console.log('engForceUnmodified fired!'));
   void eng_pfnForceUnmodified (FORCE_TYPE type, const float * mins, const float * maxs, const char * filename) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engForceUnmodified", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 4;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[4];
+    if (!hooks::active(EventId::engForceUnmodified)) return;
+    batch::record(EventId::engForceUnmodified, type, mins, maxs, filename);
+    event::findAndCall<4>(EventId::engForceUnmodified, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, type); // type (FORCE_TYPE)
       v8_args[1] = utils::floatArrayToJS(isolate, mins, 3); // mins (const float *)
       v8_args[2] = utils::floatArrayToJS(isolate, maxs, 3); // maxs (const float *)
       v8_args[3] = v8::String::NewFromUtf8(isolate, filename ? filename : "").ToLocalChecked(); // filename (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(type, mins, maxs, filename));
   }
 
 // nodemod.on('engGetPlayerStats', (pClient, ping, packet_loss) => console.log('engGetPlayerStats fired!'));
   void eng_pfnGetPlayerStats (const edict_t * pClient, int * ping, int * packet_loss) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engGetPlayerStats", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::engGetPlayerStats)) return;
+    event::findAndCall<3>(EventId::engGetPlayerStats, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pClient); // pClient (const edict_t *)
       v8_args[1] = utils::intArrayToJS(isolate, ping, 1); // ping (int *)
       v8_args[2] = utils::intArrayToJS(isolate, packet_loss, 1); // packet_loss (int *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pClient, ping, packet_loss));
   }
 
 // nodemod.on('engAddServerCommand', (cmd_name, value1) => console.log('engAddServerCommand fired!'));
   void eng_pfnAddServerCommand (const char * cmd_name, void* value1) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engAddServerCommand", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engAddServerCommand)) return;
+    event::findAndCall<2>(EventId::engAddServerCommand, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, cmd_name ? cmd_name : "").ToLocalChecked(); // cmd_name (const char *)
       v8_args[1] = v8::External::New(isolate, value1); // value1 (void*)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(cmd_name, value1));
   }
 
 // nodemod.on('engVoiceGetClientListening', (iReceiver, iSender) => console.log('engVoiceGetClientListening fired!'));
   qboolean eng_pfnVoice_GetClientListening (int iReceiver, int iSender) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engVoiceGetClientListening", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engVoiceGetClientListening)) return 0;
+    qboolean returnValue{};
+    event::findAndCall<2>(EventId::engVoiceGetClientListening, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, iReceiver); // iReceiver (int)
       v8_args[1] = v8::Number::New(isolate, iSender); // iSender (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(iReceiver, iSender), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (qboolean)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -1945,16 +1841,15 @@
 // nodemod.on('engVoiceSetClientListening', (iReceiver, iSender, bListen) => console.log('engVoiceSetClientListening fired!'));
   qboolean eng_pfnVoice_SetClientListening (int iReceiver, int iSender, qboolean bListen) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engVoiceSetClientListening", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::engVoiceSetClientListening)) return 0;
+    qboolean returnValue{};
+    event::findAndCall<3>(EventId::engVoiceSetClientListening, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, iReceiver); // iReceiver (int)
       v8_args[1] = v8::Number::New(isolate, iSender); // iSender (int)
       v8_args[2] = v8::Boolean::New(isolate, bListen); // bListen (qboolean)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(iReceiver, iSender, bListen), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (qboolean)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -1962,14 +1857,13 @@
 // nodemod.on('engGetPlayerAuthId', (e) => console.log('engGetPlayerAuthId fired!'));
   const char * eng_pfnGetPlayerAuthId (edict_t * e) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engGetPlayerAuthId", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engGetPlayerAuthId)) return nullptr;
+    const char * returnValue{};
+    event::findAndCall<1>(EventId::engGetPlayerAuthId, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, e); // e (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(e), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (const char *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -1977,15 +1871,14 @@
 // nodemod.on('engSequenceGet', (fileName, entryName) => console.log('engSequenceGet fired!'));
   void * eng_pfnSequenceGet (const char * fileName, const char * entryName) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engSequenceGet", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engSequenceGet)) return nullptr;
+    void * returnValue{};
+    event::findAndCall<2>(EventId::engSequenceGet, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, fileName ? fileName : "").ToLocalChecked(); // fileName (const char *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, entryName ? entryName : "").ToLocalChecked(); // entryName (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(fileName, entryName), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (void *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -1993,16 +1886,15 @@
 // nodemod.on('engSequencePickSentence', (groupName, pickMethod, picked) => console.log('engSequencePickSentence fired!'));
   void * eng_pfnSequencePickSentence (const char * groupName, int pickMethod, int * picked) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engSequencePickSentence", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::engSequencePickSentence)) return nullptr;
+    void * returnValue{};
+    event::findAndCall<3>(EventId::engSequencePickSentence, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, groupName ? groupName : "").ToLocalChecked(); // groupName (const char *)
       v8_args[1] = v8::Number::New(isolate, pickMethod); // pickMethod (int)
       v8_args[2] = utils::intArrayToJS(isolate, picked, 1); // picked (int *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(groupName, pickMethod, picked), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (void *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -2010,14 +1902,13 @@
 // nodemod.on('engGetFileSize', (filename) => console.log('engGetFileSize fired!'));
   int eng_pfnGetFileSize (const char * filename) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engGetFileSize", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engGetFileSize)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::engGetFileSize, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, filename ? filename : "").ToLocalChecked(); // filename (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(filename), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -2025,14 +1916,13 @@
 // nodemod.on('engGetApproxWavePlayLen', (filepath) => console.log('engGetApproxWavePlayLen fired!'));
   unsigned int eng_pfnGetApproxWavePlayLen (const char * filepath) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engGetApproxWavePlayLen", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engGetApproxWavePlayLen)) return 0;
+    unsigned int returnValue{};
+    event::findAndCall<1>(EventId::engGetApproxWavePlayLen, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, filepath ? filepath : "").ToLocalChecked(); // filepath (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(filepath), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (unsigned int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -2040,9 +1930,11 @@
 // nodemod.on('engIsCareerMatch', () => console.log('engIsCareerMatch fired!'));
   int eng_pfnIsCareerMatch () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engIsCareerMatch", nullptr, 0);
+    if (!hooks::active(EventId::engIsCareerMatch)) return 0;
+    int returnValue{};
+    event::findAndCall(EventId::engIsCareerMatch, nullptr, 0, event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -2050,14 +1942,13 @@
 // nodemod.on('engGetLocalizedStringLength', (label) => console.log('engGetLocalizedStringLength fired!'));
   int eng_pfnGetLocalizedStringLength (const char * label) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engGetLocalizedStringLength", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engGetLocalizedStringLength)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::engGetLocalizedStringLength, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, label ? label : "").ToLocalChecked(); // label (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(label), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -2065,25 +1956,23 @@
 // nodemod.on('engRegisterTutorMessageShown', (mid) => console.log('engRegisterTutorMessageShown fired!'));
   void eng_pfnRegisterTutorMessageShown (int mid) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engRegisterTutorMessageShown", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engRegisterTutorMessageShown)) return;
+    batch::record(EventId::engRegisterTutorMessageShown, mid);
+    event::findAndCall<1>(EventId::engRegisterTutorMessageShown, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, mid); // mid (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(mid));
   }
 
 // nodemod.on('engGetTimesTutorMessageShown', (mid) => console.log('engGetTimesTutorMessageShown fired!'));
   int eng_pfnGetTimesTutorMessageShown (int mid) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engGetTimesTutorMessageShown", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engGetTimesTutorMessageShown)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::engGetTimesTutorMessageShown, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, mid); // mid (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(mid), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -2091,68 +1980,62 @@
 // nodemod.on('engProcessTutorMessageDecayBuffer', (buffer) => console.log('engProcessTutorMessageDecayBuffer fired!'));
   void eng_pfnProcessTutorMessageDecayBuffer (int * buffer, int bufferLength) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engProcessTutorMessageDecayBuffer", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engProcessTutorMessageDecayBuffer)) return;
+    event::findAndCall<1>(EventId::engProcessTutorMessageDecayBuffer, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::intArrayToJS(isolate, buffer, bufferLength); // buffer (int *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(buffer));
   }
 
 // nodemod.on('engConstructTutorMessageDecayBuffer', (buffer) => console.log('engConstructTutorMessageDecayBuffer fired!'));
   void eng_pfnConstructTutorMessageDecayBuffer (int * buffer, int bufferLength) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engConstructTutorMessageDecayBuffer", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engConstructTutorMessageDecayBuffer)) return;
+    event::findAndCall<1>(EventId::engConstructTutorMessageDecayBuffer, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::intArrayToJS(isolate, buffer, bufferLength); // buffer (int *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(buffer));
   }
 
 // nodemod.on('engResetTutorMessageDecayData', () => console.log('engResetTutorMessageDecayData fired!'));
   void eng_pfnResetTutorMessageDecayData () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engResetTutorMessageDecayData", nullptr, 0);
+    if (!hooks::active(EventId::engResetTutorMessageDecayData)) return;
+    event::findAndCall(EventId::engResetTutorMessageDecayData, nullptr, 0);
   }
 
 // nodemod.on('engQueryClientCvarValue', (player, cvarName) => console.log('engQueryClientCvarValue fired!'));
   void eng_pfnQueryClientCvarValue (const edict_t * player, const char * cvarName) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engQueryClientCvarValue", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engQueryClientCvarValue)) return;
+    batch::record(EventId::engQueryClientCvarValue, player, cvarName);
+    event::findAndCall<2>(EventId::engQueryClientCvarValue, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, player); // player (const edict_t *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, cvarName ? cvarName : "").ToLocalChecked(); // cvarName (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(player, cvarName));
   }
 
 // nodemod.on('engQueryClientCvarValue2', (player, cvarName, requestID) => console.log('engQueryClientCvarValue2 fired!'));
   void eng_pfnQueryClientCvarValue2 (const edict_t * player, const char * cvarName, int requestID) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engQueryClientCvarValue2", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::engQueryClientCvarValue2)) return;
+    batch::record(EventId::engQueryClientCvarValue2, player, cvarName, requestID);
+    event::findAndCall<3>(EventId::engQueryClientCvarValue2, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, player); // player (const edict_t *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, cvarName ? cvarName : "").ToLocalChecked(); // cvarName (const char *)
       v8_args[2] = v8::Number::New(isolate, requestID); // requestID (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(player, cvarName, requestID));
   }
 
 // nodemod.on('engCheckParm', (parm, ppnext) => console.log('engCheckParm fired!'));
   int eng_CheckParm (char * parm, char ** ppnext) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engCheckParm", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::engCheckParm)) return 0;
+    int returnValue{};
+    event::findAndCall<2>(EventId::engCheckParm, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, parm ? parm : "").ToLocalChecked(); // parm (char *)
       v8_args[1] = utils::stringArrayToJS(isolate, ppnext); // ppnext (char **)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(parm, ppnext), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -2160,14 +2043,13 @@
 // nodemod.on('engPEntityOfEntIndexAllEntities', (iEntIndex) => console.log('engPEntityOfEntIndexAllEntities fired!'));
   edict_t* eng_pfnPEntityOfEntIndexAllEntities (int iEntIndex) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("engPEntityOfEntIndexAllEntities", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::engPEntityOfEntIndexAllEntities)) return nullptr;
+    edict_t* returnValue{};
+    event::findAndCall<1>(EventId::engPEntityOfEntIndexAllEntities, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, iEntIndex); // iEntIndex (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(iEntIndex), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (edict_t*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -2338,14 +2220,13 @@
     // nodemod.on('postEngPrecacheModel', (s) => console.log('postEngPrecacheModel fired!'));
   int postEng_pfnPrecacheModel (const char * s) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngPrecacheModel", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngPrecacheModel)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::postEngPrecacheModel, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, s ? s : "").ToLocalChecked(); // s (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(s), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -2353,14 +2234,13 @@
 // nodemod.on('postEngPrecacheSound', (s) => console.log('postEngPrecacheSound fired!'));
   int postEng_pfnPrecacheSound (const char * s) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngPrecacheSound", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngPrecacheSound)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::postEngPrecacheSound, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, s ? s : "").ToLocalChecked(); // s (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(s), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -2368,26 +2248,24 @@
 // nodemod.on('postEngSetModel', (e, m) => console.log('postEngSetModel fired!'));
   void postEng_pfnSetModel (edict_t * e, const char * m) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngSetModel", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngSetModel)) return;
+    batch::record(EventId::postEngSetModel, e, m);
+    event::findAndCall<2>(EventId::postEngSetModel, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, e); // e (edict_t *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, m ? m : "").ToLocalChecked(); // m (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(e, m));
   }
 
 // nodemod.on('postEngModelIndex', (m) => console.log('postEngModelIndex fired!'));
   int postEng_pfnModelIndex (const char * m) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngModelIndex", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngModelIndex)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::postEngModelIndex, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, m ? m : "").ToLocalChecked(); // m (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(m), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -2395,14 +2273,13 @@
 // nodemod.on('postEngModelFrames', (modelIndex) => console.log('postEngModelFrames fired!'));
   int postEng_pfnModelFrames (int modelIndex) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngModelFrames", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngModelFrames)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::postEngModelFrames, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, modelIndex); // modelIndex (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(modelIndex), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -2410,61 +2287,57 @@
 // nodemod.on('postEngSetSize', (e, rgflMin, rgflMax) => console.log('postEngSetSize fired!'));
   void postEng_pfnSetSize (edict_t * e, const float * rgflMin, const float * rgflMax) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngSetSize", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::postEngSetSize)) return;
+    batch::record(EventId::postEngSetSize, e, rgflMin, rgflMax);
+    event::findAndCall<3>(EventId::postEngSetSize, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, e); // e (edict_t *)
       v8_args[1] = utils::floatArrayToJS(isolate, rgflMin, 3); // rgflMin (const float *)
       v8_args[2] = utils::floatArrayToJS(isolate, rgflMax, 3); // rgflMax (const float *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(e, rgflMin, rgflMax));
+    spatial::touch(e);
   }
 
 // nodemod.on('postEngChangeLevel', (s1, s2) => console.log('postEngChangeLevel fired!'));
   void postEng_pfnChangeLevel (const char * s1, const char * s2) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngChangeLevel", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngChangeLevel)) return;
+    batch::record(EventId::postEngChangeLevel, s1, s2);
+    event::findAndCall<2>(EventId::postEngChangeLevel, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, s1 ? s1 : "").ToLocalChecked(); // s1 (const char *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, s2 ? s2 : "").ToLocalChecked(); // s2 (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(s1, s2));
   }
 
 // nodemod.on('postEngGetSpawnParms', (ent) => console.log('postEngGetSpawnParms fired!'));
   void postEng_pfnGetSpawnParms (edict_t * ent) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngGetSpawnParms", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngGetSpawnParms)) return;
+    batch::record(EventId::postEngGetSpawnParms, ent);
+    event::findAndCall<1>(EventId::postEngGetSpawnParms, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, ent); // ent (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(ent));
   }
 
 // nodemod.on('postEngSaveSpawnParms', (ent) => console.log('postEngSaveSpawnParms fired!'));
   void postEng_pfnSaveSpawnParms (edict_t * ent) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngSaveSpawnParms", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngSaveSpawnParms)) return;
+    batch::record(EventId::postEngSaveSpawnParms, ent);
+    event::findAndCall<1>(EventId::postEngSaveSpawnParms, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, ent); // ent (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(ent));
   }
 
 // nodemod.on('postEngVecToYaw', (rgflVector) => console.log('postEngVecToYaw fired!'));
   float postEng_pfnVecToYaw (const float * rgflVector) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngVecToYaw", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngVecToYaw)) return 0.0f;
+    float returnValue{};
+    event::findAndCall<1>(EventId::postEngVecToYaw, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::floatArrayToJS(isolate, rgflVector, 3); // rgflVector (const float *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(rgflVector), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (float)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0.0f;
   }
@@ -2472,64 +2345,58 @@
 // nodemod.on('postEngVecToAngles', (rgflVectorIn, rgflVectorOut) => console.log('postEngVecToAngles fired!'));
   void postEng_pfnVecToAngles (const float * rgflVectorIn, float * rgflVectorOut) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngVecToAngles", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngVecToAngles)) return;
+    event::findAndCall<2>(EventId::postEngVecToAngles, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::floatArrayToJS(isolate, rgflVectorIn, 3); // rgflVectorIn (const float *)
       v8_args[1] = utils::floatArrayToJS(isolate, rgflVectorOut, 3); // rgflVectorOut (float *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(rgflVectorIn, rgflVectorOut));
   }
 
 // nodemod.on('postEngMoveToOrigin', (ent, pflGoal, dist, iMoveType) => console.log('postEngMoveToOrigin fired!'));
   void postEng_pfnMoveToOrigin (edict_t * ent, const float * pflGoal, float dist, int iMoveType) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngMoveToOrigin", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 4;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[4];
+    if (!hooks::active(EventId::postEngMoveToOrigin)) return;
+    batch::record(EventId::postEngMoveToOrigin, ent, pflGoal, dist, iMoveType);
+    event::findAndCall<4>(EventId::postEngMoveToOrigin, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, ent); // ent (edict_t *)
       v8_args[1] = utils::floatArrayToJS(isolate, pflGoal, 3); // pflGoal (const float *)
       v8_args[2] = v8::Number::New(isolate, dist); // dist (float)
       v8_args[3] = v8::Number::New(isolate, iMoveType); // iMoveType (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(ent, pflGoal, dist, iMoveType));
   }
 
 // nodemod.on('postEngChangeYaw', (ent) => console.log('postEngChangeYaw fired!'));
   void postEng_pfnChangeYaw (edict_t* ent) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngChangeYaw", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngChangeYaw)) return;
+    batch::record(EventId::postEngChangeYaw, ent);
+    event::findAndCall<1>(EventId::postEngChangeYaw, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, ent); // ent (edict_t*)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(ent));
   }
 
 // nodemod.on('postEngChangePitch', (ent) => console.log('postEngChangePitch fired!'));
   void postEng_pfnChangePitch (edict_t* ent) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngChangePitch", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngChangePitch)) return;
+    batch::record(EventId::postEngChangePitch, ent);
+    event::findAndCall<1>(EventId::postEngChangePitch, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, ent); // ent (edict_t*)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(ent));
   }
 
 // nodemod.on('postEngFindEntityByString', (pEdictStartSearchAfter, pszField, pszValue) => console.log('postEngFindEntityByString fired!'));
   edict_t* postEng_pfnFindEntityByString (edict_t * pEdictStartSearchAfter, const char * pszField, const char * pszValue) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngFindEntityByString", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::postEngFindEntityByString)) return nullptr;
+    edict_t* returnValue{};
+    event::findAndCall<3>(EventId::postEngFindEntityByString, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdictStartSearchAfter); // pEdictStartSearchAfter (edict_t *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, pszField ? pszField : "").ToLocalChecked(); // pszField (const char *)
       v8_args[2] = v8::String::NewFromUtf8(isolate, pszValue ? pszValue : "").ToLocalChecked(); // pszValue (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdictStartSearchAfter, pszField, pszValue), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (edict_t*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -2537,14 +2404,13 @@
 // nodemod.on('postEngGetEntityIllum', (pEnt) => console.log('postEngGetEntityIllum fired!'));
   int postEng_pfnGetEntityIllum (edict_t* pEnt) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngGetEntityIllum", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngGetEntityIllum)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::postEngGetEntityIllum, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEnt); // pEnt (edict_t*)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEnt), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -2552,16 +2418,15 @@
 // nodemod.on('postEngFindEntityInSphere', (pEdictStartSearchAfter, org, rad) => console.log('postEngFindEntityInSphere fired!'));
   edict_t* postEng_pfnFindEntityInSphere (edict_t * pEdictStartSearchAfter, const float * org, float rad) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngFindEntityInSphere", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::postEngFindEntityInSphere)) return nullptr;
+    edict_t* returnValue{};
+    event::findAndCall<3>(EventId::postEngFindEntityInSphere, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdictStartSearchAfter); // pEdictStartSearchAfter (edict_t *)
       v8_args[1] = utils::floatArrayToJS(isolate, org, 3); // org (const float *)
       v8_args[2] = v8::Number::New(isolate, rad); // rad (float)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdictStartSearchAfter, org, rad), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (edict_t*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -2569,14 +2434,13 @@
 // nodemod.on('postEngFindClientInPVS', (pEdict) => console.log('postEngFindClientInPVS fired!'));
   edict_t* postEng_pfnFindClientInPVS (edict_t * pEdict) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngFindClientInPVS", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngFindClientInPVS)) return nullptr;
+    edict_t* returnValue{};
+    event::findAndCall<1>(EventId::postEngFindClientInPVS, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (edict_t*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -2584,14 +2448,13 @@
 // nodemod.on('postEngEntitiesInPVS', (pplayer) => console.log('postEngEntitiesInPVS fired!'));
   edict_t* postEng_pfnEntitiesInPVS (edict_t * pplayer) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngEntitiesInPVS", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngEntitiesInPVS)) return nullptr;
+    edict_t* returnValue{};
+    event::findAndCall<1>(EventId::postEngEntitiesInPVS, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pplayer); // pplayer (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pplayer), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (edict_t*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -2599,34 +2462,33 @@
 // nodemod.on('postEngMakeVectors', (rgflVector) => console.log('postEngMakeVectors fired!'));
   void postEng_pfnMakeVectors (const float * rgflVector) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngMakeVectors", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngMakeVectors)) return;
+    batch::record(EventId::postEngMakeVectors, rgflVector);
+    event::findAndCall<1>(EventId::postEngMakeVectors, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::floatArrayToJS(isolate, rgflVector, 3); // rgflVector (const float *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(rgflVector));
   }
 
 // nodemod.on('postEngAngleVectors', (rgflVector, forward, right, up) => console.log('postEngAngleVectors fired!'));
   void postEng_pfnAngleVectors (const float * rgflVector, float * forward, float * right, float * up) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngAngleVectors", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 4;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[4];
+    if (!hooks::active(EventId::postEngAngleVectors)) return;
+    event::findAndCall<4>(EventId::postEngAngleVectors, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::floatArrayToJS(isolate, rgflVector, 3); // rgflVector (const float *)
       v8_args[1] = utils::floatArrayToJS(isolate, forward, 3); // forward (float *)
       v8_args[2] = utils::floatArrayToJS(isolate, right, 3); // right (float *)
       v8_args[3] = utils::floatArrayToJS(isolate, up, 3); // up (float *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(rgflVector, forward, right, up));
   }
 
 // nodemod.on('postEngCreateEntity', () => console.log('postEngCreateEntity fired!'));
   edict_t* postEng_pfnCreateEntity () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngCreateEntity", nullptr, 0);
+    if (!hooks::active(EventId::postEngCreateEntity)) return nullptr;
+    edict_t* returnValue{};
+    event::findAndCall(EventId::postEngCreateEntity, nullptr, 0, event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (edict_t*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -2634,25 +2496,23 @@
 // nodemod.on('postEngRemoveEntity', (e) => console.log('postEngRemoveEntity fired!'));
   void postEng_pfnRemoveEntity (edict_t* e) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngRemoveEntity", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngRemoveEntity)) return;
+    batch::record(EventId::postEngRemoveEntity, e);
+    event::findAndCall<1>(EventId::postEngRemoveEntity, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, e); // e (edict_t*)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(e));
   }
 
 // nodemod.on('postEngCreateNamedEntity', (className) => console.log('postEngCreateNamedEntity fired!'));
   edict_t* postEng_pfnCreateNamedEntity (int className) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngCreateNamedEntity", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngCreateNamedEntity)) return nullptr;
+    edict_t* returnValue{};
+    event::findAndCall<1>(EventId::postEngCreateNamedEntity, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, className); // className (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(className), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (edict_t*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -2660,25 +2520,23 @@
 // nodemod.on('postEngMakeStatic', (ent) => console.log('postEngMakeStatic fired!'));
   void postEng_pfnMakeStatic (edict_t * ent) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngMakeStatic", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngMakeStatic)) return;
+    batch::record(EventId::postEngMakeStatic, ent);
+    event::findAndCall<1>(EventId::postEngMakeStatic, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, ent); // ent (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(ent));
   }
 
 // nodemod.on('postEngEntIsOnFloor', (e) => console.log('postEngEntIsOnFloor fired!'));
   int postEng_pfnEntIsOnFloor (edict_t * e) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngEntIsOnFloor", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngEntIsOnFloor)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::postEngEntIsOnFloor, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, e); // e (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(e), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -2686,14 +2544,13 @@
 // nodemod.on('postEngDropToFloor', (e) => console.log('postEngDropToFloor fired!'));
   int postEng_pfnDropToFloor (edict_t* e) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngDropToFloor", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngDropToFloor)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::postEngDropToFloor, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, e); // e (edict_t*)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(e), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -2701,17 +2558,16 @@
 // nodemod.on('postEngWalkMove', (ent, yaw, dist, iMode) => console.log('postEngWalkMove fired!'));
   int postEng_pfnWalkMove (edict_t * ent, float yaw, float dist, int iMode) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngWalkMove", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 4;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[4];
+    if (!hooks::active(EventId::postEngWalkMove)) return 0;
+    int returnValue{};
+    event::findAndCall<4>(EventId::postEngWalkMove, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, ent); // ent (edict_t *)
       v8_args[1] = v8::Number::New(isolate, yaw); // yaw (float)
       v8_args[2] = v8::Number::New(isolate, dist); // dist (float)
       v8_args[3] = v8::Number::New(isolate, iMode); // iMode (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(ent, yaw, dist, iMode), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -2719,21 +2575,21 @@
 // nodemod.on('postEngSetOrigin', (e, rgflOrigin) => console.log('postEngSetOrigin fired!'));
   void postEng_pfnSetOrigin (edict_t * e, const float * rgflOrigin) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngSetOrigin", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngSetOrigin)) return;
+    batch::record(EventId::postEngSetOrigin, e, rgflOrigin);
+    event::findAndCall<2>(EventId::postEngSetOrigin, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, e); // e (edict_t *)
       v8_args[1] = utils::floatArrayToJS(isolate, rgflOrigin, 3); // rgflOrigin (const float *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(e, rgflOrigin));
+    spatial::touch(e);
   }
 
 // nodemod.on('postEngEmitSound', (entity, channel, sample, volume, attenuation, fFlags, pitch) => console.log('postEngEmitSound fired!'));
   void postEng_pfnEmitSound (edict_t * entity, int channel, const char * sample, float volume, float attenuation, int fFlags, int pitch) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngEmitSound", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 7;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[7];
+    if (!hooks::active(EventId::postEngEmitSound)) return;
+    batch::record(EventId::postEngEmitSound, entity, channel, sample, volume, attenuation, fFlags, pitch);
+    event::findAndCall<7>(EventId::postEngEmitSound, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, entity); // entity (edict_t *)
       v8_args[1] = v8::Number::New(isolate, channel); // channel (int)
       v8_args[2] = v8::String::NewFromUtf8(isolate, sample ? sample : "").ToLocalChecked(); // sample (const char *)
@@ -2741,16 +2597,15 @@
       v8_args[4] = v8::Number::New(isolate, attenuation); // attenuation (float)
       v8_args[5] = v8::Number::New(isolate, fFlags); // fFlags (int)
       v8_args[6] = v8::Number::New(isolate, pitch); // pitch (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(entity, channel, sample, volume, attenuation, fFlags, pitch));
   }
 
 // nodemod.on('postEngEmitAmbientSound', (entity, pos, samp, vol, attenuation, fFlags, pitch) => console.log('postEngEmitAmbientSound fired!'));
   void postEng_pfnEmitAmbientSound (edict_t * entity, const float * pos, const char * samp, float vol, float attenuation, int fFlags, int pitch) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngEmitAmbientSound", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 7;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[7];
+    if (!hooks::active(EventId::postEngEmitAmbientSound)) return;
+    batch::record(EventId::postEngEmitAmbientSound, entity, pos, samp, vol, attenuation, fFlags, pitch);
+    event::findAndCall<7>(EventId::postEngEmitAmbientSound, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, entity); // entity (edict_t *)
       v8_args[1] = utils::floatArrayToJS(isolate, pos, 3); // pos (const float *)
       v8_args[2] = v8::String::NewFromUtf8(isolate, samp ? samp : "").ToLocalChecked(); // samp (const char *)
@@ -2758,54 +2613,48 @@
       v8_args[4] = v8::Number::New(isolate, attenuation); // attenuation (float)
       v8_args[5] = v8::Number::New(isolate, fFlags); // fFlags (int)
       v8_args[6] = v8::Number::New(isolate, pitch); // pitch (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(entity, pos, samp, vol, attenuation, fFlags, pitch));
   }
 
 // nodemod.on('postEngTraceLine', (v1, v2, fNoMonsters, pentToSkip, ptr) => console.log('postEngTraceLine fired!'));
   void postEng_pfnTraceLine (const float * v1, const float * v2, int fNoMonsters, edict_t * pentToSkip, TraceResult * ptr) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngTraceLine", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 5;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[5];
+    if (!hooks::active(EventId::postEngTraceLine)) return;
+    event::findAndCall<5>(EventId::postEngTraceLine, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::floatArrayToJS(isolate, v1, 3); // v1 (const float *)
       v8_args[1] = utils::floatArrayToJS(isolate, v2, 3); // v2 (const float *)
       v8_args[2] = v8::Number::New(isolate, fNoMonsters); // fNoMonsters (int)
       v8_args[3] = structures::wrapEntity(isolate, pentToSkip); // pentToSkip (edict_t *)
       v8_args[4] = structures::wrapTraceResult(isolate, ptr); // ptr (TraceResult *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(v1, v2, fNoMonsters, pentToSkip, ptr));
   }
 
 // nodemod.on('postEngTraceToss', (pent, pentToIgnore, ptr) => console.log('postEngTraceToss fired!'));
   void postEng_pfnTraceToss (edict_t* pent, edict_t* pentToIgnore, TraceResult * ptr) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngTraceToss", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::postEngTraceToss)) return;
+    event::findAndCall<3>(EventId::postEngTraceToss, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pent); // pent (edict_t*)
       v8_args[1] = structures::wrapEntity(isolate, pentToIgnore); // pentToIgnore (edict_t*)
       v8_args[2] = structures::wrapTraceResult(isolate, ptr); // ptr (TraceResult *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pent, pentToIgnore, ptr));
   }
 
 // nodemod.on('postEngTraceMonsterHull', (pEdict, v1, v2, fNoMonsters, pentToSkip, ptr) => console.log('postEngTraceMonsterHull fired!'));
   int postEng_pfnTraceMonsterHull (edict_t * pEdict, const float * v1, const float * v2, int fNoMonsters, edict_t * pentToSkip, TraceResult * ptr) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngTraceMonsterHull", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 6;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[6];
+    if (!hooks::active(EventId::postEngTraceMonsterHull)) return 0;
+    int returnValue{};
+    event::findAndCall<6>(EventId::postEngTraceMonsterHull, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (edict_t *)
       v8_args[1] = utils::floatArrayToJS(isolate, v1, 3); // v1 (const float *)
       v8_args[2] = utils::floatArrayToJS(isolate, v2, 3); // v2 (const float *)
       v8_args[3] = v8::Number::New(isolate, fNoMonsters); // fNoMonsters (int)
       v8_args[4] = structures::wrapEntity(isolate, pentToSkip); // pentToSkip (edict_t *)
       v8_args[5] = structures::wrapTraceResult(isolate, ptr); // ptr (TraceResult *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict, v1, v2, fNoMonsters, pentToSkip, ptr), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -2813,47 +2662,42 @@
 // nodemod.on('postEngTraceHull', (v1, v2, fNoMonsters, hullNumber, pentToSkip, ptr) => console.log('postEngTraceHull fired!'));
   void postEng_pfnTraceHull (const float * v1, const float * v2, int fNoMonsters, int hullNumber, edict_t * pentToSkip, TraceResult * ptr) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngTraceHull", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 6;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[6];
+    if (!hooks::active(EventId::postEngTraceHull)) return;
+    event::findAndCall<6>(EventId::postEngTraceHull, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::floatArrayToJS(isolate, v1, 3); // v1 (const float *)
       v8_args[1] = utils::floatArrayToJS(isolate, v2, 3); // v2 (const float *)
       v8_args[2] = v8::Number::New(isolate, fNoMonsters); // fNoMonsters (int)
       v8_args[3] = v8::Number::New(isolate, hullNumber); // hullNumber (int)
       v8_args[4] = structures::wrapEntity(isolate, pentToSkip); // pentToSkip (edict_t *)
       v8_args[5] = structures::wrapTraceResult(isolate, ptr); // ptr (TraceResult *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(v1, v2, fNoMonsters, hullNumber, pentToSkip, ptr));
   }
 
 // nodemod.on('postEngTraceModel', (v1, v2, hullNumber, pent, ptr) => console.log('postEngTraceModel fired!'));
   void postEng_pfnTraceModel (const float * v1, const float * v2, int hullNumber, edict_t * pent, TraceResult * ptr) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngTraceModel", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 5;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[5];
+    if (!hooks::active(EventId::postEngTraceModel)) return;
+    event::findAndCall<5>(EventId::postEngTraceModel, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::floatArrayToJS(isolate, v1, 3); // v1 (const float *)
       v8_args[1] = utils::floatArrayToJS(isolate, v2, 3); // v2 (const float *)
       v8_args[2] = v8::Number::New(isolate, hullNumber); // hullNumber (int)
       v8_args[3] = structures::wrapEntity(isolate, pent); // pent (edict_t *)
       v8_args[4] = structures::wrapTraceResult(isolate, ptr); // ptr (TraceResult *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(v1, v2, hullNumber, pent, ptr));
   }
 
 // nodemod.on('postEngTraceTexture', (pTextureEntity, v1, v2) => console.log('postEngTraceTexture fired!'));
   const char * postEng_pfnTraceTexture (edict_t * pTextureEntity, const float * v1, const float * v2) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngTraceTexture", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::postEngTraceTexture)) return nullptr;
+    const char * returnValue{};
+    event::findAndCall<3>(EventId::postEngTraceTexture, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pTextureEntity); // pTextureEntity (edict_t *)
       v8_args[1] = utils::floatArrayToJS(isolate, v1, 3); // v1 (const float *)
       v8_args[2] = utils::floatArrayToJS(isolate, v2, 3); // v2 (const float *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pTextureEntity, v1, v2), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (const char *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -2861,98 +2705,89 @@
 // nodemod.on('postEngTraceSphere', (v1, v2, fNoMonsters, radius, pentToSkip, ptr) => console.log('postEngTraceSphere fired!'));
   void postEng_pfnTraceSphere (const float * v1, const float * v2, int fNoMonsters, float radius, edict_t * pentToSkip, TraceResult * ptr) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngTraceSphere", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 6;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[6];
+    if (!hooks::active(EventId::postEngTraceSphere)) return;
+    event::findAndCall<6>(EventId::postEngTraceSphere, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::floatArrayToJS(isolate, v1, 3); // v1 (const float *)
       v8_args[1] = utils::floatArrayToJS(isolate, v2, 3); // v2 (const float *)
       v8_args[2] = v8::Number::New(isolate, fNoMonsters); // fNoMonsters (int)
       v8_args[3] = v8::Number::New(isolate, radius); // radius (float)
       v8_args[4] = structures::wrapEntity(isolate, pentToSkip); // pentToSkip (edict_t *)
       v8_args[5] = structures::wrapTraceResult(isolate, ptr); // ptr (TraceResult *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(v1, v2, fNoMonsters, radius, pentToSkip, ptr));
   }
 
 // nodemod.on('postEngGetAimVector', (ent, speed, rgflReturn) => console.log('postEngGetAimVector fired!'));
   void postEng_pfnGetAimVector (edict_t * ent, float speed, float * rgflReturn) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngGetAimVector", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::postEngGetAimVector)) return;
+    event::findAndCall<3>(EventId::postEngGetAimVector, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, ent); // ent (edict_t *)
       v8_args[1] = v8::Number::New(isolate, speed); // speed (float)
       v8_args[2] = utils::floatArrayToJS(isolate, rgflReturn, 3); // rgflReturn (float *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(ent, speed, rgflReturn));
   }
 
 // nodemod.on('postEngServerCommand', (str) => console.log('postEngServerCommand fired!'));
   void postEng_pfnServerCommand (const char * str) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngServerCommand", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngServerCommand)) return;
+    batch::record(EventId::postEngServerCommand, str);
+    event::findAndCall<1>(EventId::postEngServerCommand, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, str ? str : "").ToLocalChecked(); // str (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(str));
   }
 
 // nodemod.on('postEngServerExecute', () => console.log('postEngServerExecute fired!'));
   void postEng_pfnServerExecute () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngServerExecute", nullptr, 0);
+    if (!hooks::active(EventId::postEngServerExecute)) return;
+    event::findAndCall(EventId::postEngServerExecute, nullptr, 0);
   }
 
 // nodemod.on('postEngClientCommand', (pEdict, szFmt) => console.log('postEngClientCommand fired!'));
   void postEng_pfnClientCommand (edict_t* ed, const char *szFmt, ...) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngClientCommand", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-  v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
-  v8_args[0] = structures::wrapEntity(isolate, ed);
+    if (!hooks::active(EventId::postEngClientCommand)) return;
+    event::findAndCall<2>(EventId::postEngClientCommand, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
+      v8_args[0] = structures::wrapEntity(isolate, ed);
   v8_args[1] = v8::String::NewFromUtf8(isolate, CMD_ARGS()).ToLocalChecked();
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
     });
   }
 
 // nodemod.on('postEngParticleEffect', (org, dir, color, count) => console.log('postEngParticleEffect fired!'));
   void postEng_pfnParticleEffect (const float * org, const float * dir, float color, float count) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngParticleEffect", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 4;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[4];
+    if (!hooks::active(EventId::postEngParticleEffect)) return;
+    batch::record(EventId::postEngParticleEffect, org, dir, color, count);
+    event::findAndCall<4>(EventId::postEngParticleEffect, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::floatArrayToJS(isolate, org, 3); // org (const float *)
       v8_args[1] = utils::floatArrayToJS(isolate, dir, 3); // dir (const float *)
       v8_args[2] = v8::Number::New(isolate, color); // color (float)
       v8_args[3] = v8::Number::New(isolate, count); // count (float)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(org, dir, color, count));
   }
 
 // nodemod.on('postEngLightStyle', (style, val) => console.log('postEngLightStyle fired!'));
   void postEng_pfnLightStyle (int style, const char * val) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngLightStyle", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngLightStyle)) return;
+    batch::record(EventId::postEngLightStyle, style, val);
+    event::findAndCall<2>(EventId::postEngLightStyle, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, style); // style (int)
       v8_args[1] = v8::String::NewFromUtf8(isolate, val ? val : "").ToLocalChecked(); // val (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(style, val));
   }
 
 // nodemod.on('postEngDecalIndex', (name) => console.log('postEngDecalIndex fired!'));
   int postEng_pfnDecalIndex (const char * name) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngDecalIndex", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngDecalIndex)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::postEngDecalIndex, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, name ? name : "").ToLocalChecked(); // name (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(name), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -2960,14 +2795,13 @@
 // nodemod.on('postEngPointContents', (rgflVector) => console.log('postEngPointContents fired!'));
   int postEng_pfnPointContents (const float * rgflVector) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngPointContents", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngPointContents)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::postEngPointContents, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::floatArrayToJS(isolate, rgflVector, 3); // rgflVector (const float *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(rgflVector), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -2975,133 +2809,142 @@
 // nodemod.on('postEngMessageBegin', (msg_dest, msg_type, pOrigin, ed) => console.log('postEngMessageBegin fired!'));
   void postEng_pfnMessageBegin (int msg_dest, int msg_type, const float * pOrigin, edict_t * ed) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngMessageBegin", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 4;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[4];
+    if (!hooks::active(EventId::postEngMessageBegin)) return;
+    if (messages::replaying) return;
+
+    batch::record(EventId::postEngMessageBegin, msg_dest, msg_type, pOrigin, ed);
+    event::findAndCall<4>(EventId::postEngMessageBegin, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, msg_dest); // msg_dest (int)
       v8_args[1] = v8::Number::New(isolate, msg_type); // msg_type (int)
       v8_args[2] = utils::floatArrayToJS(isolate, pOrigin, 3); // pOrigin (const float *)
       v8_args[3] = structures::wrapEntity(isolate, ed); // ed (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(msg_dest, msg_type, pOrigin, ed));
   }
 
 // nodemod.on('postEngMessageEnd', () => console.log('postEngMessageEnd fired!'));
   void postEng_pfnMessageEnd () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngMessageEnd", nullptr, 0);
+    if (!hooks::active(EventId::postEngMessageEnd)) return;
+    if (messages::replaying) return;
+
+    event::findAndCall(EventId::postEngMessageEnd, nullptr, 0);
   }
 
 // nodemod.on('postEngWriteByte', (iValue) => console.log('postEngWriteByte fired!'));
   void postEng_pfnWriteByte (int iValue) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngWriteByte", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngWriteByte)) return;
+    if (messages::replaying) return;
+
+    batch::record(EventId::postEngWriteByte, iValue);
+    event::findAndCall<1>(EventId::postEngWriteByte, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, iValue); // iValue (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(iValue));
   }
 
 // nodemod.on('postEngWriteChar', (iValue) => console.log('postEngWriteChar fired!'));
   void postEng_pfnWriteChar (int iValue) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngWriteChar", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngWriteChar)) return;
+    if (messages::replaying) return;
+
+    batch::record(EventId::postEngWriteChar, iValue);
+    event::findAndCall<1>(EventId::postEngWriteChar, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, iValue); // iValue (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(iValue));
   }
 
 // nodemod.on('postEngWriteShort', (iValue) => console.log('postEngWriteShort fired!'));
   void postEng_pfnWriteShort (int iValue) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngWriteShort", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngWriteShort)) return;
+    if (messages::replaying) return;
+
+    batch::record(EventId::postEngWriteShort, iValue);
+    event::findAndCall<1>(EventId::postEngWriteShort, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, iValue); // iValue (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(iValue));
   }
 
 // nodemod.on('postEngWriteLong', (iValue) => console.log('postEngWriteLong fired!'));
   void postEng_pfnWriteLong (int iValue) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngWriteLong", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngWriteLong)) return;
+    if (messages::replaying) return;
+
+    batch::record(EventId::postEngWriteLong, iValue);
+    event::findAndCall<1>(EventId::postEngWriteLong, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, iValue); // iValue (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(iValue));
   }
 
 // nodemod.on('postEngWriteAngle', (flValue) => console.log('postEngWriteAngle fired!'));
   void postEng_pfnWriteAngle (float flValue) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngWriteAngle", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngWriteAngle)) return;
+    if (messages::replaying) return;
+
+    batch::record(EventId::postEngWriteAngle, flValue);
+    event::findAndCall<1>(EventId::postEngWriteAngle, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, flValue); // flValue (float)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(flValue));
   }
 
 // nodemod.on('postEngWriteCoord', (flValue) => console.log('postEngWriteCoord fired!'));
   void postEng_pfnWriteCoord (float flValue) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngWriteCoord", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngWriteCoord)) return;
+    if (messages::replaying) return;
+
+    batch::record(EventId::postEngWriteCoord, flValue);
+    event::findAndCall<1>(EventId::postEngWriteCoord, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, flValue); // flValue (float)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(flValue));
   }
 
 // nodemod.on('postEngWriteString', (sz) => console.log('postEngWriteString fired!'));
   void postEng_pfnWriteString (const char * sz) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngWriteString", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngWriteString)) return;
+    if (messages::replaying) return;
+
+    batch::record(EventId::postEngWriteString, sz);
+    event::findAndCall<1>(EventId::postEngWriteString, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, sz ? sz : "").ToLocalChecked(); // sz (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(sz));
   }
 
 // nodemod.on('postEngWriteEntity', (iValue) => console.log('postEngWriteEntity fired!'));
   void postEng_pfnWriteEntity (int iValue) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngWriteEntity", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngWriteEntity)) return;
+    if (messages::replaying) return;
+
+    batch::record(EventId::postEngWriteEntity, iValue);
+    event::findAndCall<1>(EventId::postEngWriteEntity, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, iValue); // iValue (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(iValue));
   }
 
 // nodemod.on('postEngCVarRegister', (pCvar) => console.log('postEngCVarRegister fired!'));
   void postEng_pfnCVarRegister (cvar_t * pCvar) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngCVarRegister", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngCVarRegister)) return;
+    event::findAndCall<1>(EventId::postEngCVarRegister, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapCvar(isolate, pCvar); // pCvar (cvar_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pCvar));
   }
 
 // nodemod.on('postEngCVarGetFloat', (szVarName) => console.log('postEngCVarGetFloat fired!'));
   float postEng_pfnCVarGetFloat (const char * szVarName) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngCVarGetFloat", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngCVarGetFloat)) return 0.0f;
+    float returnValue{};
+    event::findAndCall<1>(EventId::postEngCVarGetFloat, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, szVarName ? szVarName : "").ToLocalChecked(); // szVarName (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(szVarName), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (float)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0.0f;
   }
@@ -3109,14 +2952,13 @@
 // nodemod.on('postEngCVarGetString', (szVarName) => console.log('postEngCVarGetString fired!'));
   const char* postEng_pfnCVarGetString (const char * szVarName) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngCVarGetString", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngCVarGetString)) return nullptr;
+    const char* returnValue{};
+    event::findAndCall<1>(EventId::postEngCVarGetString, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, szVarName ? szVarName : "").ToLocalChecked(); // szVarName (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(szVarName), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (const char*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -3124,63 +2966,56 @@
 // nodemod.on('postEngCVarSetFloat', (szVarName, flValue) => console.log('postEngCVarSetFloat fired!'));
   void postEng_pfnCVarSetFloat (const char * szVarName, float flValue) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngCVarSetFloat", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngCVarSetFloat)) return;
+    batch::record(EventId::postEngCVarSetFloat, szVarName, flValue);
+    event::findAndCall<2>(EventId::postEngCVarSetFloat, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, szVarName ? szVarName : "").ToLocalChecked(); // szVarName (const char *)
       v8_args[1] = v8::Number::New(isolate, flValue); // flValue (float)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(szVarName, flValue));
   }
 
 // nodemod.on('postEngCVarSetString', (szVarName, szValue) => console.log('postEngCVarSetString fired!'));
   void postEng_pfnCVarSetString (const char * szVarName, const char * szValue) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngCVarSetString", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngCVarSetString)) return;
+    batch::record(EventId::postEngCVarSetString, szVarName, szValue);
+    event::findAndCall<2>(EventId::postEngCVarSetString, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, szVarName ? szVarName : "").ToLocalChecked(); // szVarName (const char *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, szValue ? szValue : "").ToLocalChecked(); // szValue (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(szVarName, szValue));
   }
 
 // nodemod.on('postEngAlertMessage', (atype, szFmt) => console.log('postEngAlertMessage fired!'));
   void postEng_pfnAlertMessage (ALERT_TYPE atype, const char * szFmt, ...) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngAlertMessage", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngAlertMessage)) return;
+    event::findAndCall<2>(EventId::postEngAlertMessage, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, atype); // atype (ALERT_TYPE)
       v8_args[1] = v8::String::NewFromUtf8(isolate, szFmt ? szFmt : "").ToLocalChecked(); // szFmt (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(atype, szFmt));
   }
 
 // nodemod.on('postEngEngineFprintf', (pfile, szFmt) => console.log('postEngEngineFprintf fired!'));
   void postEng_pfnEngineFprintf (FILE * pfile, const char * szFmt, ...) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngEngineFprintf", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngEngineFprintf)) return;
+    event::findAndCall<2>(EventId::postEngEngineFprintf, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::External::New(isolate, pfile); // pfile (FILE *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, szFmt ? szFmt : "").ToLocalChecked(); // szFmt (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pfile, szFmt));
   }
 
 // nodemod.on('postEngPvAllocEntPrivateData', (pEdict, cb) => console.log('postEngPvAllocEntPrivateData fired!'));
   void* postEng_pfnPvAllocEntPrivateData (edict_t * pEdict, int cb) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngPvAllocEntPrivateData", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngPvAllocEntPrivateData)) return nullptr;
+    void* returnValue{};
+    event::findAndCall<2>(EventId::postEngPvAllocEntPrivateData, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (edict_t *)
       v8_args[1] = v8::Number::New(isolate, cb); // cb (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict, cb), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (void*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -3188,14 +3023,13 @@
 // nodemod.on('postEngPvEntPrivateData', (pEdict) => console.log('postEngPvEntPrivateData fired!'));
   void* postEng_pfnPvEntPrivateData (edict_t * pEdict) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngPvEntPrivateData", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngPvEntPrivateData)) return nullptr;
+    void* returnValue{};
+    event::findAndCall<1>(EventId::postEngPvEntPrivateData, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (void*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -3203,25 +3037,23 @@
 // nodemod.on('postEngFreeEntPrivateData', (pEdict) => console.log('postEngFreeEntPrivateData fired!'));
   void postEng_pfnFreeEntPrivateData (edict_t * pEdict) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngFreeEntPrivateData", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngFreeEntPrivateData)) return;
+    batch::record(EventId::postEngFreeEntPrivateData, pEdict);
+    event::findAndCall<1>(EventId::postEngFreeEntPrivateData, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict));
   }
 
 // nodemod.on('postEngSzFromIndex', (iString) => console.log('postEngSzFromIndex fired!'));
   const char * postEng_pfnSzFromIndex (int iString) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngSzFromIndex", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngSzFromIndex)) return nullptr;
+    const char * returnValue{};
+    event::findAndCall<1>(EventId::postEngSzFromIndex, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, iString); // iString (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(iString), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (const char *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -3229,14 +3061,13 @@
 // nodemod.on('postEngAllocString', (szValue) => console.log('postEngAllocString fired!'));
   int postEng_pfnAllocString (const char * szValue) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngAllocString", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngAllocString)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::postEngAllocString, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, szValue ? szValue : "").ToLocalChecked(); // szValue (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(szValue), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -3244,14 +3075,13 @@
 // nodemod.on('postEngGetVarsOfEnt', (pEdict) => console.log('postEngGetVarsOfEnt fired!'));
   struct entvars_s * postEng_pfnGetVarsOfEnt (edict_t * pEdict) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngGetVarsOfEnt", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngGetVarsOfEnt)) return nullptr;
+    struct entvars_s * returnValue{};
+    event::findAndCall<1>(EventId::postEngGetVarsOfEnt, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (struct entvars_s *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -3259,14 +3089,13 @@
 // nodemod.on('postEngPEntityOfEntOffset', (iEntOffset) => console.log('postEngPEntityOfEntOffset fired!'));
   edict_t* postEng_pfnPEntityOfEntOffset (int iEntOffset) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngPEntityOfEntOffset", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngPEntityOfEntOffset)) return nullptr;
+    edict_t* returnValue{};
+    event::findAndCall<1>(EventId::postEngPEntityOfEntOffset, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, iEntOffset); // iEntOffset (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(iEntOffset), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (edict_t*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -3274,14 +3103,13 @@
 // nodemod.on('postEngEntOffsetOfPEntity', (pEdict) => console.log('postEngEntOffsetOfPEntity fired!'));
   int postEng_pfnEntOffsetOfPEntity (const edict_t * pEdict) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngEntOffsetOfPEntity", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngEntOffsetOfPEntity)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::postEngEntOffsetOfPEntity, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (const edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -3289,14 +3117,13 @@
 // nodemod.on('postEngIndexOfEdict', (pEdict) => console.log('postEngIndexOfEdict fired!'));
   int postEng_pfnIndexOfEdict (const edict_t * pEdict) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngIndexOfEdict", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngIndexOfEdict)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::postEngIndexOfEdict, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (const edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -3304,14 +3131,13 @@
 // nodemod.on('postEngPEntityOfEntIndex', (iEntIndex) => console.log('postEngPEntityOfEntIndex fired!'));
   edict_t* postEng_pfnPEntityOfEntIndex (int iEntIndex) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngPEntityOfEntIndex", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngPEntityOfEntIndex)) return nullptr;
+    edict_t* returnValue{};
+    event::findAndCall<1>(EventId::postEngPEntityOfEntIndex, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, iEntIndex); // iEntIndex (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(iEntIndex), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (edict_t*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -3319,14 +3145,13 @@
 // nodemod.on('postEngFindEntityByVars', (pvars) => console.log('postEngFindEntityByVars fired!'));
   edict_t* postEng_pfnFindEntityByVars (struct entvars_s* pvars) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngFindEntityByVars", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngFindEntityByVars)) return nullptr;
+    edict_t* returnValue{};
+    event::findAndCall<1>(EventId::postEngFindEntityByVars, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntvars(isolate, pvars); // pvars (struct entvars_s*)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pvars), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (edict_t*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -3334,14 +3159,13 @@
 // nodemod.on('postEngGetModelPtr', (pEdict) => console.log('postEngGetModelPtr fired!'));
   void* postEng_pfnGetModelPtr (edict_t* pEdict) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngGetModelPtr", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngGetModelPtr)) return nullptr;
+    void* returnValue{};
+    event::findAndCall<1>(EventId::postEngGetModelPtr, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (edict_t*)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (void*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -3349,15 +3173,14 @@
 // nodemod.on('postEngRegUserMsg', (pszName, iSize) => console.log('postEngRegUserMsg fired!'));
   int postEng_pfnRegUserMsg (const char * pszName, int iSize) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngRegUserMsg", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngRegUserMsg)) return 0;
+    int returnValue{};
+    event::findAndCall<2>(EventId::postEngRegUserMsg, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, pszName ? pszName : "").ToLocalChecked(); // pszName (const char *)
       v8_args[1] = v8::Number::New(isolate, iSize); // iSize (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pszName, iSize), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -3365,40 +3188,36 @@
 // nodemod.on('postEngAnimationAutomove', (pEdict, flTime) => console.log('postEngAnimationAutomove fired!'));
   void postEng_pfnAnimationAutomove (const edict_t* pEdict, float flTime) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngAnimationAutomove", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngAnimationAutomove)) return;
+    batch::record(EventId::postEngAnimationAutomove, pEdict, flTime);
+    event::findAndCall<2>(EventId::postEngAnimationAutomove, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (const edict_t*)
       v8_args[1] = v8::Number::New(isolate, flTime); // flTime (float)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict, flTime));
   }
 
 // nodemod.on('postEngGetBonePosition', (pEdict, iBone, rgflOrigin, rgflAngles) => console.log('postEngGetBonePosition fired!'));
   void postEng_pfnGetBonePosition (const edict_t* pEdict, int iBone, float * rgflOrigin, float * rgflAngles) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngGetBonePosition", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 4;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[4];
+    if (!hooks::active(EventId::postEngGetBonePosition)) return;
+    event::findAndCall<4>(EventId::postEngGetBonePosition, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (const edict_t*)
       v8_args[1] = v8::Number::New(isolate, iBone); // iBone (int)
       v8_args[2] = utils::floatArrayToJS(isolate, rgflOrigin, 3); // rgflOrigin (float *)
       v8_args[3] = utils::floatArrayToJS(isolate, rgflAngles, 3); // rgflAngles (float *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict, iBone, rgflOrigin, rgflAngles));
   }
 
 // nodemod.on('postEngFunctionFromName', (pName) => console.log('postEngFunctionFromName fired!'));
   void* postEng_pfnFunctionFromName (const char * pName) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngFunctionFromName", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngFunctionFromName)) return nullptr;
+    void* returnValue{};
+    event::findAndCall<1>(EventId::postEngFunctionFromName, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, pName ? pName : "").ToLocalChecked(); // pName (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pName), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (void*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -3406,14 +3225,13 @@
 // nodemod.on('postEngNameForFunction', (function) => console.log('postEngNameForFunction fired!'));
   const char * postEng_pfnNameForFunction (void * function) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngNameForFunction", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngNameForFunction)) return nullptr;
+    const char * returnValue{};
+    event::findAndCall<1>(EventId::postEngNameForFunction, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::External::New(isolate, function); // function (void *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(function), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (const char *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -3421,33 +3239,33 @@
 // nodemod.on('postEngClientPrintf', (pEdict, ptype, szMsg) => console.log('postEngClientPrintf fired!'));
   void postEng_pfnClientPrintf (edict_t* pEdict, PRINT_TYPE ptype, const char * szMsg) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngClientPrintf", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::postEngClientPrintf)) return;
+    batch::record(EventId::postEngClientPrintf, pEdict, ptype, szMsg);
+    event::findAndCall<3>(EventId::postEngClientPrintf, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (edict_t*)
       v8_args[1] = v8::Number::New(isolate, ptype); // ptype (PRINT_TYPE)
       v8_args[2] = v8::String::NewFromUtf8(isolate, szMsg ? szMsg : "").ToLocalChecked(); // szMsg (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict, ptype, szMsg));
   }
 
 // nodemod.on('postEngServerPrint', (szMsg) => console.log('postEngServerPrint fired!'));
   void postEng_pfnServerPrint (const char * szMsg) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngServerPrint", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngServerPrint)) return;
+    batch::record(EventId::postEngServerPrint, szMsg);
+    event::findAndCall<1>(EventId::postEngServerPrint, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, szMsg ? szMsg : "").ToLocalChecked(); // szMsg (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(szMsg));
   }
 
 // nodemod.on('postEngCmdArgs', () => console.log('postEngCmdArgs fired!'));
   const char * postEng_pfnCmd_Args () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngCmdArgs", nullptr, 0);
+    if (!hooks::active(EventId::postEngCmdArgs)) return nullptr;
+    const char * returnValue{};
+    event::findAndCall(EventId::postEngCmdArgs, nullptr, 0, event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (const char *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -3455,14 +3273,13 @@
 // nodemod.on('postEngCmdArgv', (argc) => console.log('postEngCmdArgv fired!'));
   const char * postEng_pfnCmd_Argv (int argc) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngCmdArgv", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngCmdArgv)) return nullptr;
+    const char * returnValue{};
+    event::findAndCall<1>(EventId::postEngCmdArgv, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, argc); // argc (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(argc), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (const char *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -3470,9 +3287,11 @@
 // nodemod.on('postEngCmdArgc', () => console.log('postEngCmdArgc fired!'));
   int postEng_pfnCmd_Argc () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngCmdArgc", nullptr, 0);
+    if (!hooks::active(EventId::postEngCmdArgc)) return 0;
+    int returnValue{};
+    event::findAndCall(EventId::postEngCmdArgc, nullptr, 0, event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -3480,64 +3299,55 @@
 // nodemod.on('postEngGetAttachment', (pEdict, iAttachment, rgflOrigin, rgflAngles) => console.log('postEngGetAttachment fired!'));
   void postEng_pfnGetAttachment (const edict_t * pEdict, int iAttachment, float * rgflOrigin, float * rgflAngles) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngGetAttachment", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 4;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[4];
+    if (!hooks::active(EventId::postEngGetAttachment)) return;
+    event::findAndCall<4>(EventId::postEngGetAttachment, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (const edict_t *)
       v8_args[1] = v8::Number::New(isolate, iAttachment); // iAttachment (int)
       v8_args[2] = utils::floatArrayToJS(isolate, rgflOrigin, 3); // rgflOrigin (float *)
       v8_args[3] = utils::floatArrayToJS(isolate, rgflAngles, 3); // rgflAngles (float *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict, iAttachment, rgflOrigin, rgflAngles));
   }
 
 // nodemod.on('postEngCRC32Init', (pulCRC) => console.log('postEngCRC32Init fired!'));
   void postEng_pfnCRC32_Init (CRC32_t * pulCRC) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngCRC32Init", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngCRC32Init)) return;
+    event::findAndCall<1>(EventId::postEngCRC32Init, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::External::New(isolate, pulCRC); // pulCRC (CRC32_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pulCRC));
   }
 
 // nodemod.on('postEngCRC32ProcessBuffer', (pulCRC, p, len) => console.log('postEngCRC32ProcessBuffer fired!'));
   void postEng_pfnCRC32_ProcessBuffer (CRC32_t * pulCRC, void * p, int len) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngCRC32ProcessBuffer", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::postEngCRC32ProcessBuffer)) return;
+    event::findAndCall<3>(EventId::postEngCRC32ProcessBuffer, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::External::New(isolate, pulCRC); // pulCRC (CRC32_t *)
       v8_args[1] = v8::External::New(isolate, p); // p (void *)
       v8_args[2] = v8::Number::New(isolate, len); // len (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pulCRC, p, len));
   }
 
 // nodemod.on('postEngCRC32ProcessByte', (pulCRC, ch) => console.log('postEngCRC32ProcessByte fired!'));
   void postEng_pfnCRC32_ProcessByte (CRC32_t * pulCRC, unsigned char ch) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngCRC32ProcessByte", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngCRC32ProcessByte)) return;
+    event::findAndCall<2>(EventId::postEngCRC32ProcessByte, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::External::New(isolate, pulCRC); // pulCRC (CRC32_t *)
       v8_args[1] = v8::Number::New(isolate, ch); // ch (unsigned char)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pulCRC, ch));
   }
 
 // nodemod.on('postEngCRC32Final', (pulCRC) => console.log('postEngCRC32Final fired!'));
   CRC32_t postEng_pfnCRC32_Final (CRC32_t pulCRC) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngCRC32Final", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngCRC32Final)) return 0;
+    CRC32_t returnValue{};
+    event::findAndCall<1>(EventId::postEngCRC32Final, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, pulCRC); // pulCRC (CRC32_t)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pulCRC), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (CRC32_t)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -3545,15 +3355,14 @@
 // nodemod.on('postEngRandomLong', (lLow, lHigh) => console.log('postEngRandomLong fired!'));
   int postEng_pfnRandomLong (int lLow, int lHigh) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngRandomLong", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngRandomLong)) return 0;
+    int returnValue{};
+    event::findAndCall<2>(EventId::postEngRandomLong, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, lLow); // lLow (int)
       v8_args[1] = v8::Number::New(isolate, lHigh); // lHigh (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(lLow, lHigh), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -3561,15 +3370,14 @@
 // nodemod.on('postEngRandomFloat', (flLow, flHigh) => console.log('postEngRandomFloat fired!'));
   float postEng_pfnRandomFloat (float flLow, float flHigh) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngRandomFloat", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngRandomFloat)) return 0.0f;
+    float returnValue{};
+    event::findAndCall<2>(EventId::postEngRandomFloat, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, flLow); // flLow (float)
       v8_args[1] = v8::Number::New(isolate, flHigh); // flHigh (float)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(flLow, flHigh), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (float)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0.0f;
   }
@@ -3577,21 +3385,22 @@
 // nodemod.on('postEngSetView', (pClient, pViewent) => console.log('postEngSetView fired!'));
   void postEng_pfnSetView (const edict_t * pClient, const edict_t * pViewent) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngSetView", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngSetView)) return;
+    batch::record(EventId::postEngSetView, pClient, pViewent);
+    event::findAndCall<2>(EventId::postEngSetView, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pClient); // pClient (const edict_t *)
       v8_args[1] = structures::wrapEntity(isolate, pViewent); // pViewent (const edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pClient, pViewent));
   }
 
 // nodemod.on('postEngTime', () => console.log('postEngTime fired!'));
   float postEng_pfnTime () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngTime", nullptr, 0);
+    if (!hooks::active(EventId::postEngTime)) return 0.0f;
+    float returnValue{};
+    event::findAndCall(EventId::postEngTime, nullptr, 0, event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (float)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0.0f;
   }
@@ -3599,28 +3408,26 @@
 // nodemod.on('postEngCrosshairAngle', (pClient, pitch, yaw) => console.log('postEngCrosshairAngle fired!'));
   void postEng_pfnCrosshairAngle (const edict_t * pClient, float pitch, float yaw) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngCrosshairAngle", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::postEngCrosshairAngle)) return;
+    batch::record(EventId::postEngCrosshairAngle, pClient, pitch, yaw);
+    event::findAndCall<3>(EventId::postEngCrosshairAngle, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pClient); // pClient (const edict_t *)
       v8_args[1] = v8::Number::New(isolate, pitch); // pitch (float)
       v8_args[2] = v8::Number::New(isolate, yaw); // yaw (float)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pClient, pitch, yaw));
   }
 
 // nodemod.on('postEngLoadFileForMe', (filename, pLength) => console.log('postEngLoadFileForMe fired!'));
   byte* postEng_pfnLoadFileForMe (const char * filename, int * pLength) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngLoadFileForMe", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngLoadFileForMe)) return nullptr;
+    byte* returnValue{};
+    event::findAndCall<2>(EventId::postEngLoadFileForMe, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, filename ? filename : "").ToLocalChecked(); // filename (const char *)
       v8_args[1] = utils::intArrayToJS(isolate, pLength, 1); // pLength (int *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(filename, pLength), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (byte*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -3628,38 +3435,34 @@
 // nodemod.on('postEngFreeFile', (buffer) => console.log('postEngFreeFile fired!'));
   void postEng_pfnFreeFile (void * buffer) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngFreeFile", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngFreeFile)) return;
+    event::findAndCall<1>(EventId::postEngFreeFile, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::External::New(isolate, buffer); // buffer (void *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(buffer));
   }
 
 // nodemod.on('postEngEndSection', (pszSectionName) => console.log('postEngEndSection fired!'));
   void postEng_pfnEndSection (const char * pszSectionName) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngEndSection", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngEndSection)) return;
+    batch::record(EventId::postEngEndSection, pszSectionName);
+    event::findAndCall<1>(EventId::postEngEndSection, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, pszSectionName ? pszSectionName : "").ToLocalChecked(); // pszSectionName (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pszSectionName));
   }
 
 // nodemod.on('postEngCompareFileTime', (filename1, filename2, iCompare) => console.log('postEngCompareFileTime fired!'));
   int postEng_pfnCompareFileTime (char * filename1, char * filename2, int * iCompare) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngCompareFileTime", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::postEngCompareFileTime)) return 0;
+    int returnValue{};
+    event::findAndCall<3>(EventId::postEngCompareFileTime, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, filename1 ? filename1 : "").ToLocalChecked(); // filename1 (char *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, filename2 ? filename2 : "").ToLocalChecked(); // filename2 (char *)
       v8_args[2] = utils::intArrayToJS(isolate, iCompare, 1); // iCompare (int *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(filename1, filename2, iCompare), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -3667,63 +3470,57 @@
 // nodemod.on('postEngGetGameDir', (szGetGameDir) => console.log('postEngGetGameDir fired!'));
   void postEng_pfnGetGameDir (char * szGetGameDir) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngGetGameDir", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngGetGameDir)) return;
+    batch::record(EventId::postEngGetGameDir, szGetGameDir);
+    event::findAndCall<1>(EventId::postEngGetGameDir, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, szGetGameDir ? szGetGameDir : "").ToLocalChecked(); // szGetGameDir (char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(szGetGameDir));
   }
 
 // nodemod.on('postEngCvarRegisterVariable', (variable) => console.log('postEngCvarRegisterVariable fired!'));
   void postEng_pfnCvar_RegisterVariable (cvar_t * variable) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngCvarRegisterVariable", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngCvarRegisterVariable)) return;
+    event::findAndCall<1>(EventId::postEngCvarRegisterVariable, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapCvar(isolate, variable); // variable (cvar_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(variable));
   }
 
 // nodemod.on('postEngFadeClientVolume', (pEdict, fadePercent, fadeOutSeconds, holdTime, fadeInSeconds) => console.log('postEngFadeClientVolume fired!'));
   void postEng_pfnFadeClientVolume (const edict_t * pEdict, int fadePercent, int fadeOutSeconds, int holdTime, int fadeInSeconds) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngFadeClientVolume", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 5;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[5];
+    if (!hooks::active(EventId::postEngFadeClientVolume)) return;
+    batch::record(EventId::postEngFadeClientVolume, pEdict, fadePercent, fadeOutSeconds, holdTime, fadeInSeconds);
+    event::findAndCall<5>(EventId::postEngFadeClientVolume, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (const edict_t *)
       v8_args[1] = v8::Number::New(isolate, fadePercent); // fadePercent (int)
       v8_args[2] = v8::Number::New(isolate, fadeOutSeconds); // fadeOutSeconds (int)
       v8_args[3] = v8::Number::New(isolate, holdTime); // holdTime (int)
       v8_args[4] = v8::Number::New(isolate, fadeInSeconds); // fadeInSeconds (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict, fadePercent, fadeOutSeconds, holdTime, fadeInSeconds));
   }
 
 // nodemod.on('postEngSetClientMaxspeed', (pEdict, fNewMaxspeed) => console.log('postEngSetClientMaxspeed fired!'));
   void postEng_pfnSetClientMaxspeed (const edict_t * pEdict, float fNewMaxspeed) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngSetClientMaxspeed", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngSetClientMaxspeed)) return;
+    batch::record(EventId::postEngSetClientMaxspeed, pEdict, fNewMaxspeed);
+    event::findAndCall<2>(EventId::postEngSetClientMaxspeed, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pEdict); // pEdict (const edict_t *)
       v8_args[1] = v8::Number::New(isolate, fNewMaxspeed); // fNewMaxspeed (float)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pEdict, fNewMaxspeed));
   }
 
 // nodemod.on('postEngCreateFakeClient', (netname) => console.log('postEngCreateFakeClient fired!'));
   edict_t * postEng_pfnCreateFakeClient (const char * netname) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngCreateFakeClient", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngCreateFakeClient)) return nullptr;
+    edict_t * returnValue{};
+    event::findAndCall<1>(EventId::postEngCreateFakeClient, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, netname ? netname : "").ToLocalChecked(); // netname (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(netname), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (edict_t *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -3731,9 +3528,9 @@
 // nodemod.on('postEngRunPlayerMove', (fakeclient, viewangles, forwardmove, sidemove, upmove, buttons, impulse, msec) => console.log('postEngRunPlayerMove fired!'));
   void postEng_pfnRunPlayerMove (edict_t * fakeclient, const float * viewangles, float forwardmove, float sidemove, float upmove, unsigned short buttons, byte impulse, byte msec) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngRunPlayerMove", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 8;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[8];
+    if (!hooks::active(EventId::postEngRunPlayerMove)) return;
+    batch::record(EventId::postEngRunPlayerMove, fakeclient, viewangles, forwardmove, sidemove, upmove, buttons, impulse, msec);
+    event::findAndCall<8>(EventId::postEngRunPlayerMove, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, fakeclient); // fakeclient (edict_t *)
       v8_args[1] = utils::floatArrayToJS(isolate, viewangles, 3); // viewangles (const float *)
       v8_args[2] = v8::Number::New(isolate, forwardmove); // forwardmove (float)
@@ -3742,16 +3539,17 @@
       v8_args[5] = v8::Number::New(isolate, buttons); // buttons (unsigned short)
       v8_args[6] = v8::Number::New(isolate, impulse); // impulse (byte)
       v8_args[7] = v8::Number::New(isolate, msec); // msec (byte)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(fakeclient, viewangles, forwardmove, sidemove, upmove, buttons, impulse, msec));
   }
 
 // nodemod.on('postEngNumberOfEntities', () => console.log('postEngNumberOfEntities fired!'));
   int postEng_pfnNumberOfEntities () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngNumberOfEntities", nullptr, 0);
+    if (!hooks::active(EventId::postEngNumberOfEntities)) return 0;
+    int returnValue{};
+    event::findAndCall(EventId::postEngNumberOfEntities, nullptr, 0, event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -3759,14 +3557,13 @@
 // nodemod.on('postEngGetInfoKeyBuffer', (e) => console.log('postEngGetInfoKeyBuffer fired!'));
   char* postEng_pfnGetInfoKeyBuffer (edict_t * e) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngGetInfoKeyBuffer", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngGetInfoKeyBuffer)) return nullptr;
+    char* returnValue{};
+    event::findAndCall<1>(EventId::postEngGetInfoKeyBuffer, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, e); // e (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(e), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (char*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -3774,15 +3571,14 @@
 // nodemod.on('postEngInfoKeyValue', (infobuffer, key) => console.log('postEngInfoKeyValue fired!'));
   char* postEng_pfnInfoKeyValue (char * infobuffer, const char * key) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngInfoKeyValue", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngInfoKeyValue)) return nullptr;
+    char* returnValue{};
+    event::findAndCall<2>(EventId::postEngInfoKeyValue, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, infobuffer ? infobuffer : "").ToLocalChecked(); // infobuffer (char *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, key ? key : "").ToLocalChecked(); // key (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(infobuffer, key), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (char*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -3790,41 +3586,38 @@
 // nodemod.on('postEngSetKeyValue', (infobuffer, key, value) => console.log('postEngSetKeyValue fired!'));
   void postEng_pfnSetKeyValue (char * infobuffer, const char * key, const char * value) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngSetKeyValue", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::postEngSetKeyValue)) return;
+    batch::record(EventId::postEngSetKeyValue, infobuffer, key, value);
+    event::findAndCall<3>(EventId::postEngSetKeyValue, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, infobuffer ? infobuffer : "").ToLocalChecked(); // infobuffer (char *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, key ? key : "").ToLocalChecked(); // key (const char *)
       v8_args[2] = v8::String::NewFromUtf8(isolate, value ? value : "").ToLocalChecked(); // value (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(infobuffer, key, value));
   }
 
 // nodemod.on('postEngSetClientKeyValue', (clientIndex, infobuffer, key, value) => console.log('postEngSetClientKeyValue fired!'));
   void postEng_pfnSetClientKeyValue (int clientIndex, char * infobuffer, const char * key, const char * value) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngSetClientKeyValue", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 4;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[4];
+    if (!hooks::active(EventId::postEngSetClientKeyValue)) return;
+    batch::record(EventId::postEngSetClientKeyValue, clientIndex, infobuffer, key, value);
+    event::findAndCall<4>(EventId::postEngSetClientKeyValue, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, clientIndex); // clientIndex (int)
       v8_args[1] = v8::String::NewFromUtf8(isolate, infobuffer ? infobuffer : "").ToLocalChecked(); // infobuffer (char *)
       v8_args[2] = v8::String::NewFromUtf8(isolate, key ? key : "").ToLocalChecked(); // key (const char *)
       v8_args[3] = v8::String::NewFromUtf8(isolate, value ? value : "").ToLocalChecked(); // value (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(clientIndex, infobuffer, key, value));
   }
 
 // nodemod.on('postEngIsMapValid', (filename) => console.log('postEngIsMapValid fired!'));
   int postEng_pfnIsMapValid (const char * filename) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngIsMapValid", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngIsMapValid)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::postEngIsMapValid, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, filename ? filename : "").ToLocalChecked(); // filename (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(filename), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -3832,28 +3625,26 @@
 // nodemod.on('postEngStaticDecal', (origin, decalIndex, entityIndex, modelIndex) => console.log('postEngStaticDecal fired!'));
   void postEng_pfnStaticDecal (const float * origin, int decalIndex, int entityIndex, int modelIndex) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngStaticDecal", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 4;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[4];
+    if (!hooks::active(EventId::postEngStaticDecal)) return;
+    batch::record(EventId::postEngStaticDecal, origin, decalIndex, entityIndex, modelIndex);
+    event::findAndCall<4>(EventId::postEngStaticDecal, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::floatArrayToJS(isolate, origin, 3); // origin (const float *)
       v8_args[1] = v8::Number::New(isolate, decalIndex); // decalIndex (int)
       v8_args[2] = v8::Number::New(isolate, entityIndex); // entityIndex (int)
       v8_args[3] = v8::Number::New(isolate, modelIndex); // modelIndex (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(origin, decalIndex, entityIndex, modelIndex));
   }
 
 // nodemod.on('postEngPrecacheGeneric', (s) => console.log('postEngPrecacheGeneric fired!'));
   int postEng_pfnPrecacheGeneric (const char * s) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngPrecacheGeneric", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngPrecacheGeneric)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::postEngPrecacheGeneric, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, s ? s : "").ToLocalChecked(); // s (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(s), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -3861,14 +3652,13 @@
 // nodemod.on('postEngGetPlayerUserId', (e) => console.log('postEngGetPlayerUserId fired!'));
   int postEng_pfnGetPlayerUserId (edict_t * e) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngGetPlayerUserId", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngGetPlayerUserId)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::postEngGetPlayerUserId, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, e); // e (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(e), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -3876,9 +3666,9 @@
 // nodemod.on('postEngBuildSoundMsg', (entity, channel, sample, volume, attenuation, fFlags, pitch, msg_dest, msg_type, pOrigin, ed) => console.log('postEngBuildSoundMsg fired!'));
   void postEng_pfnBuildSoundMsg (edict_t * entity, int channel, const char * sample, float volume, float attenuation, int fFlags, int pitch, int msg_dest, int msg_type, const float * pOrigin, edict_t * ed) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngBuildSoundMsg", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 11;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[11];
+    if (!hooks::active(EventId::postEngBuildSoundMsg)) return;
+    batch::record(EventId::postEngBuildSoundMsg, entity, channel, sample, volume, attenuation, fFlags, pitch, msg_dest, msg_type, pOrigin, ed);
+    event::findAndCall<11>(EventId::postEngBuildSoundMsg, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, entity); // entity (edict_t *)
       v8_args[1] = v8::Number::New(isolate, channel); // channel (int)
       v8_args[2] = v8::String::NewFromUtf8(isolate, sample ? sample : "").ToLocalChecked(); // sample (const char *)
@@ -3890,16 +3680,17 @@
       v8_args[8] = v8::Number::New(isolate, msg_type); // msg_type (int)
       v8_args[9] = utils::floatArrayToJS(isolate, pOrigin, 3); // pOrigin (const float *)
       v8_args[10] = structures::wrapEntity(isolate, ed); // ed (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(entity, channel, sample, volume, attenuation, fFlags, pitch, msg_dest, msg_type, pOrigin, ed));
   }
 
 // nodemod.on('postEngIsDedicatedServer', () => console.log('postEngIsDedicatedServer fired!'));
   int postEng_pfnIsDedicatedServer () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngIsDedicatedServer", nullptr, 0);
+    if (!hooks::active(EventId::postEngIsDedicatedServer)) return 0;
+    int returnValue{};
+    event::findAndCall(EventId::postEngIsDedicatedServer, nullptr, 0, event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -3907,14 +3698,13 @@
 // nodemod.on('postEngCVarGetPointer', (szVarName) => console.log('postEngCVarGetPointer fired!'));
   cvar_t * postEng_pfnCVarGetPointer (const char * szVarName) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngCVarGetPointer", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngCVarGetPointer)) return nullptr;
+    cvar_t * returnValue{};
+    event::findAndCall<1>(EventId::postEngCVarGetPointer, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, szVarName ? szVarName : "").ToLocalChecked(); // szVarName (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(szVarName), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (cvar_t *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -3922,14 +3712,13 @@
 // nodemod.on('postEngGetPlayerWONId', (e) => console.log('postEngGetPlayerWONId fired!'));
   unsigned int postEng_pfnGetPlayerWONId (edict_t * e) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngGetPlayerWONId", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngGetPlayerWONId)) return 0;
+    unsigned int returnValue{};
+    event::findAndCall<1>(EventId::postEngGetPlayerWONId, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, e); // e (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(e), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (unsigned int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -3937,27 +3726,25 @@
 // nodemod.on('postEngInfoRemoveKey', (s, key) => console.log('postEngInfoRemoveKey fired!'));
   void postEng_pfnInfo_RemoveKey (char * s, const char * key) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngInfoRemoveKey", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngInfoRemoveKey)) return;
+    batch::record(EventId::postEngInfoRemoveKey, s, key);
+    event::findAndCall<2>(EventId::postEngInfoRemoveKey, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, s ? s : "").ToLocalChecked(); // s (char *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, key ? key : "").ToLocalChecked(); // key (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(s, key));
   }
 
 // nodemod.on('postEngGetPhysicsKeyValue', (pClient, key) => console.log('postEngGetPhysicsKeyValue fired!'));
   const char * postEng_pfnGetPhysicsKeyValue (const edict_t * pClient, const char * key) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngGetPhysicsKeyValue", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngGetPhysicsKeyValue)) return nullptr;
+    const char * returnValue{};
+    event::findAndCall<2>(EventId::postEngGetPhysicsKeyValue, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pClient); // pClient (const edict_t *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, key ? key : "").ToLocalChecked(); // key (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pClient, key), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (const char *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -3965,27 +3752,25 @@
 // nodemod.on('postEngSetPhysicsKeyValue', (pClient, key, value) => console.log('postEngSetPhysicsKeyValue fired!'));
   void postEng_pfnSetPhysicsKeyValue (const edict_t * pClient, const char * key, const char * value) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngSetPhysicsKeyValue", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::postEngSetPhysicsKeyValue)) return;
+    batch::record(EventId::postEngSetPhysicsKeyValue, pClient, key, value);
+    event::findAndCall<3>(EventId::postEngSetPhysicsKeyValue, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pClient); // pClient (const edict_t *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, key ? key : "").ToLocalChecked(); // key (const char *)
       v8_args[2] = v8::String::NewFromUtf8(isolate, value ? value : "").ToLocalChecked(); // value (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pClient, key, value));
   }
 
 // nodemod.on('postEngGetPhysicsInfoString', (pClient) => console.log('postEngGetPhysicsInfoString fired!'));
   const char * postEng_pfnGetPhysicsInfoString (const edict_t * pClient) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngGetPhysicsInfoString", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngGetPhysicsInfoString)) return nullptr;
+    const char * returnValue{};
+    event::findAndCall<1>(EventId::postEngGetPhysicsInfoString, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pClient); // pClient (const edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pClient), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (const char *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -3993,15 +3778,14 @@
 // nodemod.on('postEngPrecacheEvent', (type, psz) => console.log('postEngPrecacheEvent fired!'));
   unsigned short postEng_pfnPrecacheEvent (int type, const char* psz) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngPrecacheEvent", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngPrecacheEvent)) return 0;
+    unsigned short returnValue{};
+    event::findAndCall<2>(EventId::postEngPrecacheEvent, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, type); // type (int)
       v8_args[1] = v8::String::NewFromUtf8(isolate, psz ? psz : "").ToLocalChecked(); // psz (const char*)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(type, psz), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (unsigned short)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -4009,9 +3793,9 @@
 // nodemod.on('postEngPlaybackEvent', (flags, pInvoker, eventindex, delay, origin, angles, fparam1, fparam2, iparam1, iparam2, bparam1, bparam2) => console.log('postEngPlaybackEvent fired!'));
   void postEng_pfnPlaybackEvent (int flags, const edict_t * pInvoker, unsigned short eventindex, float delay, const float * origin, const float * angles, float fparam1, float fparam2, int iparam1, int iparam2, int bparam1, int bparam2) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngPlaybackEvent", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 12;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[12];
+    if (!hooks::active(EventId::postEngPlaybackEvent)) return;
+    batch::record(EventId::postEngPlaybackEvent, flags, pInvoker, eventindex, delay, origin, angles, fparam1, fparam2, iparam1, iparam2, bparam1, bparam2);
+    event::findAndCall<12>(EventId::postEngPlaybackEvent, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, flags); // flags (int)
       v8_args[1] = structures::wrapEntity(isolate, pInvoker); // pInvoker (const edict_t *)
       v8_args[2] = v8::Number::New(isolate, eventindex); // eventindex (unsigned short)
@@ -4024,21 +3808,19 @@
       v8_args[9] = v8::Number::New(isolate, iparam2); // iparam2 (int)
       v8_args[10] = v8::Number::New(isolate, bparam1); // bparam1 (int)
       v8_args[11] = v8::Number::New(isolate, bparam2); // bparam2 (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(flags, pInvoker, eventindex, delay, origin, angles, fparam1, fparam2, iparam1, iparam2, bparam1, bparam2));
   }
 
 // nodemod.on('postEngSetFatPVS', (org) => console.log('postEngSetFatPVS fired!'));
   unsigned char * postEng_pfnSetFatPVS (const float * org) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngSetFatPVS", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngSetFatPVS)) return nullptr;
+    unsigned char * returnValue{};
+    event::findAndCall<1>(EventId::postEngSetFatPVS, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::floatArrayToJS(isolate, org, 3); // org (const float *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(org), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (unsigned char *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -4046,14 +3828,13 @@
 // nodemod.on('postEngSetFatPAS', (org) => console.log('postEngSetFatPAS fired!'));
   unsigned char * postEng_pfnSetFatPAS (const float * org) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngSetFatPAS", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngSetFatPAS)) return nullptr;
+    unsigned char * returnValue{};
+    event::findAndCall<1>(EventId::postEngSetFatPAS, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::floatArrayToJS(isolate, org, 3); // org (const float *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(org), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (unsigned char *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -4061,15 +3842,14 @@
 // nodemod.on('postEngCheckVisibility', (entity, pset) => console.log('postEngCheckVisibility fired!'));
   int postEng_pfnCheckVisibility (const edict_t * entity, unsigned char * pset) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngCheckVisibility", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngCheckVisibility)) return 0;
+    int returnValue{};
+    event::findAndCall<2>(EventId::postEngCheckVisibility, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, entity); // entity (const edict_t *)
       v8_args[1] = utils::byteArrayToJS(isolate, pset, 1); // pset (unsigned char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(entity, pset), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -4077,45 +3857,41 @@
 // nodemod.on('postEngDeltaSetField', (pFields, fieldname) => console.log('postEngDeltaSetField fired!'));
   void postEng_pfnDeltaSetField (struct delta_s * pFields, const char * fieldname) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngDeltaSetField", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngDeltaSetField)) return;
+    event::findAndCall<2>(EventId::postEngDeltaSetField, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapDelta(isolate, pFields); // pFields (struct delta_s *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, fieldname ? fieldname : "").ToLocalChecked(); // fieldname (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pFields, fieldname));
   }
 
 // nodemod.on('postEngDeltaUnsetField', (pFields, fieldname) => console.log('postEngDeltaUnsetField fired!'));
   void postEng_pfnDeltaUnsetField (struct delta_s * pFields, const char * fieldname) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngDeltaUnsetField", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngDeltaUnsetField)) return;
+    event::findAndCall<2>(EventId::postEngDeltaUnsetField, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapDelta(isolate, pFields); // pFields (struct delta_s *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, fieldname ? fieldname : "").ToLocalChecked(); // fieldname (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pFields, fieldname));
   }
 
 // nodemod.on('postEngDeltaAddEncoder', (name, value1) => console.log('postEngDeltaAddEncoder fired!'));
   void postEng_pfnDeltaAddEncoder (const char * name, void* value1) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngDeltaAddEncoder", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngDeltaAddEncoder)) return;
+    event::findAndCall<2>(EventId::postEngDeltaAddEncoder, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, name ? name : "").ToLocalChecked(); // name (const char *)
       v8_args[1] = v8::External::New(isolate, value1); // value1 (void*)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(name, value1));
   }
 
 // nodemod.on('postEngGetCurrentPlayer', () => console.log('postEngGetCurrentPlayer fired!'));
   int postEng_pfnGetCurrentPlayer () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngGetCurrentPlayer", nullptr, 0);
+    if (!hooks::active(EventId::postEngGetCurrentPlayer)) return 0;
+    int returnValue{};
+    event::findAndCall(EventId::postEngGetCurrentPlayer, nullptr, 0, event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -4123,14 +3899,13 @@
 // nodemod.on('postEngCanSkipPlayer', (player) => console.log('postEngCanSkipPlayer fired!'));
   int postEng_pfnCanSkipPlayer (const edict_t * player) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngCanSkipPlayer", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngCanSkipPlayer)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::postEngCanSkipPlayer, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, player); // player (const edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(player), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -4138,15 +3913,14 @@
 // nodemod.on('postEngDeltaFindField', (pFields, fieldname) => console.log('postEngDeltaFindField fired!'));
   int postEng_pfnDeltaFindField (struct delta_s * pFields, const char * fieldname) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngDeltaFindField", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngDeltaFindField)) return 0;
+    int returnValue{};
+    event::findAndCall<2>(EventId::postEngDeltaFindField, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapDelta(isolate, pFields); // pFields (struct delta_s *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, fieldname ? fieldname : "").ToLocalChecked(); // fieldname (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pFields, fieldname), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -4154,51 +3928,45 @@
 // nodemod.on('postEngDeltaSetFieldByIndex', (pFields, fieldNumber) => console.log('postEngDeltaSetFieldByIndex fired!'));
   void postEng_pfnDeltaSetFieldByIndex (struct delta_s * pFields, int fieldNumber) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngDeltaSetFieldByIndex", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngDeltaSetFieldByIndex)) return;
+    event::findAndCall<2>(EventId::postEngDeltaSetFieldByIndex, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapDelta(isolate, pFields); // pFields (struct delta_s *)
       v8_args[1] = v8::Number::New(isolate, fieldNumber); // fieldNumber (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pFields, fieldNumber));
   }
 
 // nodemod.on('postEngDeltaUnsetFieldByIndex', (pFields, fieldNumber) => console.log('postEngDeltaUnsetFieldByIndex fired!'));
   void postEng_pfnDeltaUnsetFieldByIndex (struct delta_s * pFields, int fieldNumber) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngDeltaUnsetFieldByIndex", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngDeltaUnsetFieldByIndex)) return;
+    event::findAndCall<2>(EventId::postEngDeltaUnsetFieldByIndex, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapDelta(isolate, pFields); // pFields (struct delta_s *)
       v8_args[1] = v8::Number::New(isolate, fieldNumber); // fieldNumber (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pFields, fieldNumber));
   }
 
 // nodemod.on('postEngSetGroupMask', (mask, op) => console.log('postEngSetGroupMask fired!'));
   void postEng_pfnSetGroupMask (int mask, int op) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngSetGroupMask", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngSetGroupMask)) return;
+    batch::record(EventId::postEngSetGroupMask, mask, op);
+    event::findAndCall<2>(EventId::postEngSetGroupMask, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, mask); // mask (int)
       v8_args[1] = v8::Number::New(isolate, op); // op (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(mask, op));
   }
 
 // nodemod.on('postEngCreateInstancedBaseline', (classname, baseline) => console.log('postEngCreateInstancedBaseline fired!'));
   int postEng_pfnCreateInstancedBaseline (int classname, struct entity_state_s * baseline) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngCreateInstancedBaseline", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngCreateInstancedBaseline)) return 0;
+    int returnValue{};
+    event::findAndCall<2>(EventId::postEngCreateInstancedBaseline, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, classname); // classname (int)
       v8_args[1] = structures::wrapEntityState(isolate, baseline); // baseline (struct entity_state_s *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(classname, baseline), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -4206,66 +3974,58 @@
 // nodemod.on('postEngCvarDirectSet', (var, value) => console.log('postEngCvarDirectSet fired!'));
   void postEng_pfnCvar_DirectSet (struct cvar_s * var, const char * value) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngCvarDirectSet", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngCvarDirectSet)) return;
+    event::findAndCall<2>(EventId::postEngCvarDirectSet, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapCvar(isolate, var); // var (struct cvar_s *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, value ? value : "").ToLocalChecked(); // value (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(var, value));
   }
 
 // nodemod.on('postEngForceUnmodified', (type, mins, maxs, filename) => console.log('postEngForceUnmodified fired!'));
   void postEng_pfnForceUnmodified (FORCE_TYPE type, const float * mins, const float * maxs, const char * filename) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngForceUnmodified", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 4;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[4];
+    if (!hooks::active(EventId::postEngForceUnmodified)) return;
+    batch::record(EventId::postEngForceUnmodified, type, mins, maxs, filename);
+    event::findAndCall<4>(EventId::postEngForceUnmodified, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, type); // type (FORCE_TYPE)
       v8_args[1] = utils::floatArrayToJS(isolate, mins, 3); // mins (const float *)
       v8_args[2] = utils::floatArrayToJS(isolate, maxs, 3); // maxs (const float *)
       v8_args[3] = v8::String::NewFromUtf8(isolate, filename ? filename : "").ToLocalChecked(); // filename (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(type, mins, maxs, filename));
   }
 
 // nodemod.on('postEngGetPlayerStats', (pClient, ping, packet_loss) => console.log('postEngGetPlayerStats fired!'));
   void postEng_pfnGetPlayerStats (const edict_t * pClient, int * ping, int * packet_loss) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngGetPlayerStats", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::postEngGetPlayerStats)) return;
+    event::findAndCall<3>(EventId::postEngGetPlayerStats, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, pClient); // pClient (const edict_t *)
       v8_args[1] = utils::intArrayToJS(isolate, ping, 1); // ping (int *)
       v8_args[2] = utils::intArrayToJS(isolate, packet_loss, 1); // packet_loss (int *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(pClient, ping, packet_loss));
   }
 
 // nodemod.on('postEngAddServerCommand', (cmd_name, value1) => console.log('postEngAddServerCommand fired!'));
   void postEng_pfnAddServerCommand (const char * cmd_name, void* value1) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngAddServerCommand", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngAddServerCommand)) return;
+    event::findAndCall<2>(EventId::postEngAddServerCommand, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, cmd_name ? cmd_name : "").ToLocalChecked(); // cmd_name (const char *)
       v8_args[1] = v8::External::New(isolate, value1); // value1 (void*)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(cmd_name, value1));
   }
 
 // nodemod.on('postEngVoiceGetClientListening', (iReceiver, iSender) => console.log('postEngVoiceGetClientListening fired!'));
   qboolean postEng_pfnVoice_GetClientListening (int iReceiver, int iSender) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngVoiceGetClientListening", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngVoiceGetClientListening)) return 0;
+    qboolean returnValue{};
+    event::findAndCall<2>(EventId::postEngVoiceGetClientListening, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, iReceiver); // iReceiver (int)
       v8_args[1] = v8::Number::New(isolate, iSender); // iSender (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(iReceiver, iSender), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (qboolean)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -4273,16 +4033,15 @@
 // nodemod.on('postEngVoiceSetClientListening', (iReceiver, iSender, bListen) => console.log('postEngVoiceSetClientListening fired!'));
   qboolean postEng_pfnVoice_SetClientListening (int iReceiver, int iSender, qboolean bListen) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngVoiceSetClientListening", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::postEngVoiceSetClientListening)) return 0;
+    qboolean returnValue{};
+    event::findAndCall<3>(EventId::postEngVoiceSetClientListening, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, iReceiver); // iReceiver (int)
       v8_args[1] = v8::Number::New(isolate, iSender); // iSender (int)
       v8_args[2] = v8::Boolean::New(isolate, bListen); // bListen (qboolean)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(iReceiver, iSender, bListen), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (qboolean)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -4290,14 +4049,13 @@
 // nodemod.on('postEngGetPlayerAuthId', (e) => console.log('postEngGetPlayerAuthId fired!'));
   const char * postEng_pfnGetPlayerAuthId (edict_t * e) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngGetPlayerAuthId", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngGetPlayerAuthId)) return nullptr;
+    const char * returnValue{};
+    event::findAndCall<1>(EventId::postEngGetPlayerAuthId, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, e); // e (edict_t *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(e), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (const char *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -4305,15 +4063,14 @@
 // nodemod.on('postEngSequenceGet', (fileName, entryName) => console.log('postEngSequenceGet fired!'));
   void * postEng_pfnSequenceGet (const char * fileName, const char * entryName) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngSequenceGet", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngSequenceGet)) return nullptr;
+    void * returnValue{};
+    event::findAndCall<2>(EventId::postEngSequenceGet, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, fileName ? fileName : "").ToLocalChecked(); // fileName (const char *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, entryName ? entryName : "").ToLocalChecked(); // entryName (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(fileName, entryName), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (void *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -4321,16 +4078,15 @@
 // nodemod.on('postEngSequencePickSentence', (groupName, pickMethod, picked) => console.log('postEngSequencePickSentence fired!'));
   void * postEng_pfnSequencePickSentence (const char * groupName, int pickMethod, int * picked) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngSequencePickSentence", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::postEngSequencePickSentence)) return nullptr;
+    void * returnValue{};
+    event::findAndCall<3>(EventId::postEngSequencePickSentence, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, groupName ? groupName : "").ToLocalChecked(); // groupName (const char *)
       v8_args[1] = v8::Number::New(isolate, pickMethod); // pickMethod (int)
       v8_args[2] = utils::intArrayToJS(isolate, picked, 1); // picked (int *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(groupName, pickMethod, picked), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (void *)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -4338,14 +4094,13 @@
 // nodemod.on('postEngGetFileSize', (filename) => console.log('postEngGetFileSize fired!'));
   int postEng_pfnGetFileSize (const char * filename) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngGetFileSize", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngGetFileSize)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::postEngGetFileSize, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, filename ? filename : "").ToLocalChecked(); // filename (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(filename), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -4353,14 +4108,13 @@
 // nodemod.on('postEngGetApproxWavePlayLen', (filepath) => console.log('postEngGetApproxWavePlayLen fired!'));
   unsigned int postEng_pfnGetApproxWavePlayLen (const char * filepath) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngGetApproxWavePlayLen", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngGetApproxWavePlayLen)) return 0;
+    unsigned int returnValue{};
+    event::findAndCall<1>(EventId::postEngGetApproxWavePlayLen, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, filepath ? filepath : "").ToLocalChecked(); // filepath (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(filepath), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (unsigned int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -4368,9 +4122,11 @@
 // nodemod.on('postEngIsCareerMatch', () => console.log('postEngIsCareerMatch fired!'));
   int postEng_pfnIsCareerMatch () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngIsCareerMatch", nullptr, 0);
+    if (!hooks::active(EventId::postEngIsCareerMatch)) return 0;
+    int returnValue{};
+    event::findAndCall(EventId::postEngIsCareerMatch, nullptr, 0, event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -4378,14 +4134,13 @@
 // nodemod.on('postEngGetLocalizedStringLength', (label) => console.log('postEngGetLocalizedStringLength fired!'));
   int postEng_pfnGetLocalizedStringLength (const char * label) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngGetLocalizedStringLength", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngGetLocalizedStringLength)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::postEngGetLocalizedStringLength, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, label ? label : "").ToLocalChecked(); // label (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(label), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -4393,25 +4148,23 @@
 // nodemod.on('postEngRegisterTutorMessageShown', (mid) => console.log('postEngRegisterTutorMessageShown fired!'));
   void postEng_pfnRegisterTutorMessageShown (int mid) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngRegisterTutorMessageShown", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngRegisterTutorMessageShown)) return;
+    batch::record(EventId::postEngRegisterTutorMessageShown, mid);
+    event::findAndCall<1>(EventId::postEngRegisterTutorMessageShown, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, mid); // mid (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(mid));
   }
 
 // nodemod.on('postEngGetTimesTutorMessageShown', (mid) => console.log('postEngGetTimesTutorMessageShown fired!'));
   int postEng_pfnGetTimesTutorMessageShown (int mid) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngGetTimesTutorMessageShown", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngGetTimesTutorMessageShown)) return 0;
+    int returnValue{};
+    event::findAndCall<1>(EventId::postEngGetTimesTutorMessageShown, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, mid); // mid (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(mid), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -4419,68 +4172,62 @@
 // nodemod.on('postEngProcessTutorMessageDecayBuffer', (buffer) => console.log('postEngProcessTutorMessageDecayBuffer fired!'));
   void postEng_pfnProcessTutorMessageDecayBuffer (int * buffer, int bufferLength) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngProcessTutorMessageDecayBuffer", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngProcessTutorMessageDecayBuffer)) return;
+    event::findAndCall<1>(EventId::postEngProcessTutorMessageDecayBuffer, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::intArrayToJS(isolate, buffer, bufferLength); // buffer (int *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(buffer));
   }
 
 // nodemod.on('postEngConstructTutorMessageDecayBuffer', (buffer) => console.log('postEngConstructTutorMessageDecayBuffer fired!'));
   void postEng_pfnConstructTutorMessageDecayBuffer (int * buffer, int bufferLength) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngConstructTutorMessageDecayBuffer", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngConstructTutorMessageDecayBuffer)) return;
+    event::findAndCall<1>(EventId::postEngConstructTutorMessageDecayBuffer, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = utils::intArrayToJS(isolate, buffer, bufferLength); // buffer (int *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(buffer));
   }
 
 // nodemod.on('postEngResetTutorMessageDecayData', () => console.log('postEngResetTutorMessageDecayData fired!'));
   void postEng_pfnResetTutorMessageDecayData () {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngResetTutorMessageDecayData", nullptr, 0);
+    if (!hooks::active(EventId::postEngResetTutorMessageDecayData)) return;
+    event::findAndCall(EventId::postEngResetTutorMessageDecayData, nullptr, 0);
   }
 
 // nodemod.on('postEngQueryClientCvarValue', (player, cvarName) => console.log('postEngQueryClientCvarValue fired!'));
   void postEng_pfnQueryClientCvarValue (const edict_t * player, const char * cvarName) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngQueryClientCvarValue", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngQueryClientCvarValue)) return;
+    batch::record(EventId::postEngQueryClientCvarValue, player, cvarName);
+    event::findAndCall<2>(EventId::postEngQueryClientCvarValue, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, player); // player (const edict_t *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, cvarName ? cvarName : "").ToLocalChecked(); // cvarName (const char *)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(player, cvarName));
   }
 
 // nodemod.on('postEngQueryClientCvarValue2', (player, cvarName, requestID) => console.log('postEngQueryClientCvarValue2 fired!'));
   void postEng_pfnQueryClientCvarValue2 (const edict_t * player, const char * cvarName, int requestID) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngQueryClientCvarValue2", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 3;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[3];
+    if (!hooks::active(EventId::postEngQueryClientCvarValue2)) return;
+    batch::record(EventId::postEngQueryClientCvarValue2, player, cvarName, requestID);
+    event::findAndCall<3>(EventId::postEngQueryClientCvarValue2, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = structures::wrapEntity(isolate, player); // player (const edict_t *)
       v8_args[1] = v8::String::NewFromUtf8(isolate, cvarName ? cvarName : "").ToLocalChecked(); // cvarName (const char *)
       v8_args[2] = v8::Number::New(isolate, requestID); // requestID (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(player, cvarName, requestID));
   }
 
 // nodemod.on('postEngCheckParm', (parm, ppnext) => console.log('postEngCheckParm fired!'));
   int postEng_CheckParm (char * parm, char ** ppnext) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngCheckParm", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 2;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[2];
+    if (!hooks::active(EventId::postEngCheckParm)) return 0;
+    int returnValue{};
+    event::findAndCall<2>(EventId::postEngCheckParm, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::String::NewFromUtf8(isolate, parm ? parm : "").ToLocalChecked(); // parm (char *)
       v8_args[1] = utils::stringArrayToJS(isolate, ppnext); // ppnext (char **)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(parm, ppnext), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (int)(intptr_t)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return 0;
   }
@@ -4488,14 +4235,13 @@
 // nodemod.on('postEngPEntityOfEntIndexAllEntities', (iEntIndex) => console.log('postEngPEntityOfEntIndexAllEntities fired!'));
   edict_t* postEng_pfnPEntityOfEntIndexAllEntities (int iEntIndex) {
     SET_META_RESULT(MRES_IGNORED);
-    event::findAndCall("postEngPEntityOfEntIndexAllEntities", [=](v8::Isolate* isolate) {
-      unsigned int v8_argCount = 1;
-      v8::Local<v8::Value>* v8_args = new v8::Local<v8::Value>[1];
+    if (!hooks::active(EventId::postEngPEntityOfEntIndexAllEntities)) return nullptr;
+    edict_t* returnValue{};
+    event::findAndCall<1>(EventId::postEngPEntityOfEntIndexAllEntities, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
       v8_args[0] = v8::Number::New(isolate, iEntIndex); // iEntIndex (int)
-      return std::pair<unsigned int, v8::Local<v8::Value>*>(v8_argCount, v8_args);
-    });
+    }, event::native(iEntIndex), event::returnInto(returnValue));
     if (gpMetaGlobals->mres == MRES_SUPERCEDE || gpMetaGlobals->mres == MRES_OVERRIDE) {
-      return (edict_t*)gpMetaGlobals->override_ret;
+      return returnValue;
     }
     return nullptr;
   }
@@ -4665,324 +4411,327 @@
     void registerEngineEvents()
     {
       // base
-      event::register_event("engPrecacheModel", "");
-event::register_event("engPrecacheSound", "");
-event::register_event("engSetModel", "");
-event::register_event("engModelIndex", "");
-event::register_event("engModelFrames", "");
-event::register_event("engSetSize", "");
-event::register_event("engChangeLevel", "");
-event::register_event("engGetSpawnParms", "");
-event::register_event("engSaveSpawnParms", "");
-event::register_event("engVecToYaw", "");
-event::register_event("engVecToAngles", "");
-event::register_event("engMoveToOrigin", "");
-event::register_event("engChangeYaw", "");
-event::register_event("engChangePitch", "");
-event::register_event("engFindEntityByString", "");
-event::register_event("engGetEntityIllum", "");
-event::register_event("engFindEntityInSphere", "");
-event::register_event("engFindClientInPVS", "");
-event::register_event("engEntitiesInPVS", "");
-event::register_event("engMakeVectors", "");
-event::register_event("engAngleVectors", "");
-event::register_event("engCreateEntity", "");
-event::register_event("engRemoveEntity", "");
-event::register_event("engCreateNamedEntity", "");
-event::register_event("engMakeStatic", "");
-event::register_event("engEntIsOnFloor", "");
-event::register_event("engDropToFloor", "");
-event::register_event("engWalkMove", "");
-event::register_event("engSetOrigin", "");
-event::register_event("engEmitSound", "");
-event::register_event("engEmitAmbientSound", "");
-event::register_event("engTraceLine", "");
-event::register_event("engTraceToss", "");
-event::register_event("engTraceMonsterHull", "");
-event::register_event("engTraceHull", "");
-event::register_event("engTraceModel", "");
-event::register_event("engTraceTexture", "");
-event::register_event("engTraceSphere", "");
-event::register_event("engGetAimVector", "");
-event::register_event("engServerCommand", "");
-event::register_event("engServerExecute", "");
-event::register_event("engClientCommand", "");
-event::register_event("engParticleEffect", "");
-event::register_event("engLightStyle", "");
-event::register_event("engDecalIndex", "");
-event::register_event("engPointContents", "");
-event::register_event("engMessageBegin", "");
-event::register_event("engMessageEnd", "");
-event::register_event("engWriteByte", "");
-event::register_event("engWriteChar", "");
-event::register_event("engWriteShort", "");
-event::register_event("engWriteLong", "");
-event::register_event("engWriteAngle", "");
-event::register_event("engWriteCoord", "");
-event::register_event("engWriteString", "");
-event::register_event("engWriteEntity", "");
-event::register_event("engCVarRegister", "");
-event::register_event("engCVarGetFloat", "");
-event::register_event("engCVarGetString", "");
-event::register_event("engCVarSetFloat", "");
-event::register_event("engCVarSetString", "");
-event::register_event("engAlertMessage", "");
-event::register_event("engEngineFprintf", "");
-event::register_event("engPvAllocEntPrivateData", "");
-event::register_event("engPvEntPrivateData", "");
-event::register_event("engFreeEntPrivateData", "");
-event::register_event("engSzFromIndex", "");
-event::register_event("engAllocString", "");
-event::register_event("engGetVarsOfEnt", "");
-event::register_event("engPEntityOfEntOffset", "");
-event::register_event("engEntOffsetOfPEntity", "");
-event::register_event("engIndexOfEdict", "");
-event::register_event("engPEntityOfEntIndex", "");
-event::register_event("engFindEntityByVars", "");
-event::register_event("engGetModelPtr", "");
-event::register_event("engRegUserMsg", "");
-event::register_event("engAnimationAutomove", "");
-event::register_event("engGetBonePosition", "");
-event::register_event("engFunctionFromName", "");
-event::register_event("engNameForFunction", "");
-event::register_event("engClientPrintf", "");
-event::register_event("engServerPrint", "");
-event::register_event("engCmdArgs", "");
-event::register_event("engCmdArgv", "");
-event::register_event("engCmdArgc", "");
-event::register_event("engGetAttachment", "");
-event::register_event("engCRC32Init", "");
-event::register_event("engCRC32ProcessBuffer", "");
-event::register_event("engCRC32ProcessByte", "");
-event::register_event("engCRC32Final", "");
-event::register_event("engRandomLong", "");
-event::register_event("engRandomFloat", "");
-event::register_event("engSetView", "");
-event::register_event("engTime", "");
-event::register_event("engCrosshairAngle", "");
-event::register_event("engLoadFileForMe", "");
-event::register_event("engFreeFile", "");
-event::register_event("engEndSection", "");
-event::register_event("engCompareFileTime", "");
-event::register_event("engGetGameDir", "");
-event::register_event("engCvarRegisterVariable", "");
-event::register_event("engFadeClientVolume", "");
-event::register_event("engSetClientMaxspeed", "");
-event::register_event("engCreateFakeClient", "");
-event::register_event("engRunPlayerMove", "");
-event::register_event("engNumberOfEntities", "");
-event::register_event("engGetInfoKeyBuffer", "");
-event::register_event("engInfoKeyValue", "");
-event::register_event("engSetKeyValue", "");
-event::register_event("engSetClientKeyValue", "");
-event::register_event("engIsMapValid", "");
-event::register_event("engStaticDecal", "");
-event::register_event("engPrecacheGeneric", "");
-event::register_event("engGetPlayerUserId", "");
-event::register_event("engBuildSoundMsg", "");
-event::register_event("engIsDedicatedServer", "");
-event::register_event("engCVarGetPointer", "");
-event::register_event("engGetPlayerWONId", "");
-event::register_event("engInfoRemoveKey", "");
-event::register_event("engGetPhysicsKeyValue", "");
-event::register_event("engSetPhysicsKeyValue", "");
-event::register_event("engGetPhysicsInfoString", "");
-event::register_event("engPrecacheEvent", "");
-event::register_event("engPlaybackEvent", "");
-event::register_event("engSetFatPVS", "");
-event::register_event("engSetFatPAS", "");
-event::register_event("engCheckVisibility", "");
-event::register_event("engDeltaSetField", "");
-event::register_event("engDeltaUnsetField", "");
-event::register_event("engDeltaAddEncoder", "");
-event::register_event("engGetCurrentPlayer", "");
-event::register_event("engCanSkipPlayer", "");
-event::register_event("engDeltaFindField", "");
-event::register_event("engDeltaSetFieldByIndex", "");
-event::register_event("engDeltaUnsetFieldByIndex", "");
-event::register_event("engSetGroupMask", "");
-event::register_event("engCreateInstancedBaseline", "");
-event::register_event("engCvarDirectSet", "");
-event::register_event("engForceUnmodified", "");
-event::register_event("engGetPlayerStats", "");
-event::register_event("engAddServerCommand", "");
-event::register_event("engVoiceGetClientListening", "");
-event::register_event("engVoiceSetClientListening", "");
-event::register_event("engGetPlayerAuthId", "");
-event::register_event("engSequenceGet", "");
-event::register_event("engSequencePickSentence", "");
-event::register_event("engGetFileSize", "");
-event::register_event("engGetApproxWavePlayLen", "");
-event::register_event("engIsCareerMatch", "");
-event::register_event("engGetLocalizedStringLength", "");
-event::register_event("engRegisterTutorMessageShown", "");
-event::register_event("engGetTimesTutorMessageShown", "");
-event::register_event("engProcessTutorMessageDecayBuffer", "");
-event::register_event("engConstructTutorMessageDecayBuffer", "");
-event::register_event("engResetTutorMessageDecayData", "");
-event::register_event("engQueryClientCvarValue", "");
-event::register_event("engQueryClientCvarValue2", "");
-event::register_event("engCheckParm", "");
-event::register_event("engPEntityOfEntIndexAllEntities", "");
+      event::register_event(EventId::engPrecacheModel, "");
+event::register_event(EventId::engPrecacheSound, "");
+event::register_event(EventId::engSetModel, "");
+event::register_event(EventId::engModelIndex, "");
+event::register_event(EventId::engModelFrames, "");
+event::register_event(EventId::engSetSize, "");
+event::register_event(EventId::engChangeLevel, "");
+event::register_event(EventId::engGetSpawnParms, "");
+event::register_event(EventId::engSaveSpawnParms, "");
+event::register_event(EventId::engVecToYaw, "");
+event::register_event(EventId::engVecToAngles, "");
+event::register_event(EventId::engMoveToOrigin, "");
+event::register_event(EventId::engChangeYaw, "");
+event::register_event(EventId::engChangePitch, "");
+event::register_event(EventId::engFindEntityByString, "");
+event::register_event(EventId::engGetEntityIllum, "");
+event::register_event(EventId::engFindEntityInSphere, "");
+event::register_event(EventId::engFindClientInPVS, "");
+event::register_event(EventId::engEntitiesInPVS, "");
+event::register_event(EventId::engMakeVectors, "");
+event::register_event(EventId::engAngleVectors, "");
+event::register_event(EventId::engCreateEntity, "");
+event::register_event(EventId::engRemoveEntity, "");
+event::register_event(EventId::engCreateNamedEntity, "");
+event::register_event(EventId::engMakeStatic, "");
+event::register_event(EventId::engEntIsOnFloor, "");
+event::register_event(EventId::engDropToFloor, "");
+event::register_event(EventId::engWalkMove, "");
+event::register_event(EventId::engSetOrigin, "");
+event::register_event(EventId::engEmitSound, "");
+event::register_event(EventId::engEmitAmbientSound, "");
+event::register_event(EventId::engTraceLine, "");
+event::register_event(EventId::engTraceToss, "");
+event::register_event(EventId::engTraceMonsterHull, "");
+event::register_event(EventId::engTraceHull, "");
+event::register_event(EventId::engTraceModel, "");
+event::register_event(EventId::engTraceTexture, "");
+event::register_event(EventId::engTraceSphere, "");
+event::register_event(EventId::engGetAimVector, "");
+event::register_event(EventId::engServerCommand, "");
+event::register_event(EventId::engServerExecute, "");
+event::register_event(EventId::engClientCommand, "");
+event::register_event(EventId::engParticleEffect, "");
+event::register_event(EventId::engLightStyle, "");
+event::register_event(EventId::engDecalIndex, "");
+event::register_event(EventId::engPointContents, "");
+event::register_event(EventId::engMessageBegin, "");
+event::register_event(EventId::engMessageEnd, "");
+event::register_event(EventId::engWriteByte, "");
+event::register_event(EventId::engWriteChar, "");
+event::register_event(EventId::engWriteShort, "");
+event::register_event(EventId::engWriteLong, "");
+event::register_event(EventId::engWriteAngle, "");
+event::register_event(EventId::engWriteCoord, "");
+event::register_event(EventId::engWriteString, "");
+event::register_event(EventId::engWriteEntity, "");
+event::register_event(EventId::engCVarRegister, "");
+event::register_event(EventId::engCVarGetFloat, "");
+event::register_event(EventId::engCVarGetString, "");
+event::register_event(EventId::engCVarSetFloat, "");
+event::register_event(EventId::engCVarSetString, "");
+event::register_event(EventId::engAlertMessage, "");
+event::register_event(EventId::engEngineFprintf, "");
+event::register_event(EventId::engPvAllocEntPrivateData, "");
+event::register_event(EventId::engPvEntPrivateData, "");
+event::register_event(EventId::engFreeEntPrivateData, "");
+event::register_event(EventId::engSzFromIndex, "");
+event::register_event(EventId::engAllocString, "");
+event::register_event(EventId::engGetVarsOfEnt, "");
+event::register_event(EventId::engPEntityOfEntOffset, "");
+event::register_event(EventId::engEntOffsetOfPEntity, "");
+event::register_event(EventId::engIndexOfEdict, "");
+event::register_event(EventId::engPEntityOfEntIndex, "");
+event::register_event(EventId::engFindEntityByVars, "");
+event::register_event(EventId::engGetModelPtr, "");
+event::register_event(EventId::engRegUserMsg, "");
+event::register_event(EventId::engAnimationAutomove, "");
+event::register_event(EventId::engGetBonePosition, "");
+event::register_event(EventId::engFunctionFromName, "");
+event::register_event(EventId::engNameForFunction, "");
+event::register_event(EventId::engClientPrintf, "");
+event::register_event(EventId::engServerPrint, "");
+event::register_event(EventId::engCmdArgs, "");
+event::register_event(EventId::engCmdArgv, "");
+event::register_event(EventId::engCmdArgc, "");
+event::register_event(EventId::engGetAttachment, "");
+event::register_event(EventId::engCRC32Init, "");
+event::register_event(EventId::engCRC32ProcessBuffer, "");
+event::register_event(EventId::engCRC32ProcessByte, "");
+event::register_event(EventId::engCRC32Final, "");
+event::register_event(EventId::engRandomLong, "");
+event::register_event(EventId::engRandomFloat, "");
+event::register_event(EventId::engSetView, "");
+event::register_event(EventId::engTime, "");
+event::register_event(EventId::engCrosshairAngle, "");
+event::register_event(EventId::engLoadFileForMe, "");
+event::register_event(EventId::engFreeFile, "");
+event::register_event(EventId::engEndSection, "");
+event::register_event(EventId::engCompareFileTime, "");
+event::register_event(EventId::engGetGameDir, "");
+event::register_event(EventId::engCvarRegisterVariable, "");
+event::register_event(EventId::engFadeClientVolume, "");
+event::register_event(EventId::engSetClientMaxspeed, "");
+event::register_event(EventId::engCreateFakeClient, "");
+event::register_event(EventId::engRunPlayerMove, "");
+event::register_event(EventId::engNumberOfEntities, "");
+event::register_event(EventId::engGetInfoKeyBuffer, "");
+event::register_event(EventId::engInfoKeyValue, "");
+event::register_event(EventId::engSetKeyValue, "");
+event::register_event(EventId::engSetClientKeyValue, "");
+event::register_event(EventId::engIsMapValid, "");
+event::register_event(EventId::engStaticDecal, "");
+event::register_event(EventId::engPrecacheGeneric, "");
+event::register_event(EventId::engGetPlayerUserId, "");
+event::register_event(EventId::engBuildSoundMsg, "");
+event::register_event(EventId::engIsDedicatedServer, "");
+event::register_event(EventId::engCVarGetPointer, "");
+event::register_event(EventId::engGetPlayerWONId, "");
+event::register_event(EventId::engInfoRemoveKey, "");
+event::register_event(EventId::engGetPhysicsKeyValue, "");
+event::register_event(EventId::engSetPhysicsKeyValue, "");
+event::register_event(EventId::engGetPhysicsInfoString, "");
+event::register_event(EventId::engPrecacheEvent, "");
+event::register_event(EventId::engPlaybackEvent, "");
+event::register_event(EventId::engSetFatPVS, "");
+event::register_event(EventId::engSetFatPAS, "");
+event::register_event(EventId::engCheckVisibility, "");
+event::register_event(EventId::engDeltaSetField, "");
+event::register_event(EventId::engDeltaUnsetField, "");
+event::register_event(EventId::engDeltaAddEncoder, "");
+event::register_event(EventId::engGetCurrentPlayer, "");
+event::register_event(EventId::engCanSkipPlayer, "");
+event::register_event(EventId::engDeltaFindField, "");
+event::register_event(EventId::engDeltaSetFieldByIndex, "");
+event::register_event(EventId::engDeltaUnsetFieldByIndex, "");
+event::register_event(EventId::engSetGroupMask, "");
+event::register_event(EventId::engCreateInstancedBaseline, "");
+event::register_event(EventId::engCvarDirectSet, "");
+event::register_event(EventId::engForceUnmodified, "");
+event::register_event(EventId::engGetPlayerStats, "");
+event::register_event(EventId::engAddServerCommand, "");
+event::register_event(EventId::engVoiceGetClientListening, "");
+event::register_event(EventId::engVoiceSetClientListening, "");
+event::register_event(EventId::engGetPlayerAuthId, "");
+event::register_event(EventId::engSequenceGet, "");
+event::register_event(EventId::engSequencePickSentence, "");
+event::register_event(EventId::engGetFileSize, "");
+event::register_event(EventId::engGetApproxWavePlayLen, "");
+event::register_event(EventId::engIsCareerMatch, "");
+event::register_event(EventId::engGetLocalizedStringLength, "");
+event::register_event(EventId::engRegisterTutorMessageShown, "");
+event::register_event(EventId::engGetTimesTutorMessageShown, "");
+event::register_event(EventId::engProcessTutorMessageDecayBuffer, "");
+event::register_event(EventId::engConstructTutorMessageDecayBuffer, "");
+event::register_event(EventId::engResetTutorMessageDecayData, "");
+event::register_event(EventId::engQueryClientCvarValue, "");
+event::register_event(EventId::engQueryClientCvarValue2, "");
+event::register_event(EventId::engCheckParm, "");
+event::register_event(EventId::engPEntityOfEntIndexAllEntities, "");
       // post
-      event::register_event("postEngPrecacheModel", "");
-event::register_event("postEngPrecacheSound", "");
-event::register_event("postEngSetModel", "");
-event::register_event("postEngModelIndex", "");
-event::register_event("postEngModelFrames", "");
-event::register_event("postEngSetSize", "");
-event::register_event("postEngChangeLevel", "");
-event::register_event("postEngGetSpawnParms", "");
-event::register_event("postEngSaveSpawnParms", "");
-event::register_event("postEngVecToYaw", "");
-event::register_event("postEngVecToAngles", "");
-event::register_event("postEngMoveToOrigin", "");
-event::register_event("postEngChangeYaw", "");
-event::register_event("postEngChangePitch", "");
-event::register_event("postEngFindEntityByString", "");
-event::register_event("postEngGetEntityIllum", "");
-event::register_event("postEngFindEntityInSphere", "");
-event::register_event("postEngFindClientInPVS", "");
-event::register_event("postEngEntitiesInPVS", "");
-event::register_event("postEngMakeVectors", "");
-event::register_event("postEngAngleVectors", "");
-event::register_event("postEngCreateEntity", "");
-event::register_event("postEngRemoveEntity", "");
-event::register_event("postEngCreateNamedEntity", "");
-event::register_event("postEngMakeStatic", "");
-event::register_event("postEngEntIsOnFloor", "");
-event::register_event("postEngDropToFloor", "");
-event::register_event("postEngWalkMove", "");
-event::register_event("postEngSetOrigin", "");
-event::register_event("postEngEmitSound", "");
-event::register_event("postEngEmitAmbientSound", "");
-event::register_event("postEngTraceLine", "");
-event::register_event("postEngTraceToss", "");
-event::register_event("postEngTraceMonsterHull", "");
-event::register_event("postEngTraceHull", "");
-event::register_event("postEngTraceModel", "");
-event::register_event("postEngTraceTexture", "");
-event::register_event("postEngTraceSphere", "");
-event::register_event("postEngGetAimVector", "");
-event::register_event("postEngServerCommand", "");
-event::register_event("postEngServerExecute", "");
-event::register_event("postEngClientCommand", "");
-event::register_event("postEngParticleEffect", "");
-event::register_event("postEngLightStyle", "");
-event::register_event("postEngDecalIndex", "");
-event::register_event("postEngPointContents", "");
-event::register_event("postEngMessageBegin", "");
-event::register_event("postEngMessageEnd", "");
-event::register_event("postEngWriteByte", "");
-event::register_event("postEngWriteChar", "");
-event::register_event("postEngWriteShort", "");
-event::register_event("postEngWriteLong", "");
-event::register_event("postEngWriteAngle", "");
-event::register_event("postEngWriteCoord", "");
-event::register_event("postEngWriteString", "");
-event::register_event("postEngWriteEntity", "");
-event::register_event("postEngCVarRegister", "");
-event::register_event("postEngCVarGetFloat", "");
-event::register_event("postEngCVarGetString", "");
-event::register_event("postEngCVarSetFloat", "");
-event::register_event("postEngCVarSetString", "");
-event::register_event("postEngAlertMessage", "");
-event::register_event("postEngEngineFprintf", "");
-event::register_event("postEngPvAllocEntPrivateData", "");
-event::register_event("postEngPvEntPrivateData", "");
-event::register_event("postEngFreeEntPrivateData", "");
-event::register_event("postEngSzFromIndex", "");
-event::register_event("postEngAllocString", "");
-event::register_event("postEngGetVarsOfEnt", "");
-event::register_event("postEngPEntityOfEntOffset", "");
-event::register_event("postEngEntOffsetOfPEntity", "");
-event::register_event("postEngIndexOfEdict", "");
-event::register_event("postEngPEntityOfEntIndex", "");
-event::register_event("postEngFindEntityByVars", "");
-event::register_event("postEngGetModelPtr", "");
-event::register_event("postEngRegUserMsg", "");
-event::register_event("postEngAnimationAutomove", "");
-event::register_event("postEngGetBonePosition", "");
-event::register_event("postEngFunctionFromName", "");
-event::register_event("postEngNameForFunction", "");
-event::register_event("postEngClientPrintf", "");
-event::register_event("postEngServerPrint", "");
-event::register_event("postEngCmdArgs", "");
-event::register_event("postEngCmdArgv", "");
-event::register_event("postEngCmdArgc", "");
-event::register_event("postEngGetAttachment", "");
-event::register_event("postEngCRC32Init", "");
-event::register_event("postEngCRC32ProcessBuffer", "");
-event::register_event("postEngCRC32ProcessByte", "");
-event::register_event("postEngCRC32Final", "");
-event::register_event("postEngRandomLong", "");
-event::register_event("postEngRandomFloat", "");
-event::register_event("postEngSetView", "");
-event::register_event("postEngTime", "");
-event::register_event("postEngCrosshairAngle", "");
-event::register_event("postEngLoadFileForMe", "");
-event::register_event("postEngFreeFile", "");
-event::register_event("postEngEndSection", "");
-event::register_event("postEngCompareFileTime", "");
-event::register_event("postEngGetGameDir", "");
-event::register_event("postEngCvarRegisterVariable", "");
-event::register_event("postEngFadeClientVolume", "");
-event::register_event("postEngSetClientMaxspeed", "");
-event::register_event("postEngCreateFakeClient", "");
-event::register_event("postEngRunPlayerMove", "");
-event::register_event("postEngNumberOfEntities", "");
-event::register_event("postEngGetInfoKeyBuffer", "");
-event::register_event("postEngInfoKeyValue", "");
-event::register_event("postEngSetKeyValue", "");
-event::register_event("postEngSetClientKeyValue", "");
-event::register_event("postEngIsMapValid", "");
-event::register_event("postEngStaticDecal", "");
-event::register_event("postEngPrecacheGeneric", "");
-event::register_event("postEngGetPlayerUserId", "");
-event::register_event("postEngBuildSoundMsg", "");
-event::register_event("postEngIsDedicatedServer", "");
-event::register_event("postEngCVarGetPointer", "");
-event::register_event("postEngGetPlayerWONId", "");
-event::register_event("postEngInfoRemoveKey", "");
-event::register_event("postEngGetPhysicsKeyValue", "");
-event::register_event("postEngSetPhysicsKeyValue", "");
-event::register_event("postEngGetPhysicsInfoString", "");
-event::register_event("postEngPrecacheEvent", "");
-event::register_event("postEngPlaybackEvent", "");
-event::register_event("postEngSetFatPVS", "");
-event::register_event("postEngSetFatPAS", "");
-event::register_event("postEngCheckVisibility", "");
-event::register_event("postEngDeltaSetField", "");
-event::register_event("postEngDeltaUnsetField", "");
-event::register_event("postEngDeltaAddEncoder", "");
-event::register_event("postEngGetCurrentPlayer", "");
-event::register_event("postEngCanSkipPlayer", "");
-event::register_event("postEngDeltaFindField", "");
-event::register_event("postEngDeltaSetFieldByIndex", "");
-event::register_event("postEngDeltaUnsetFieldByIndex", "");
-event::register_event("postEngSetGroupMask", "");
-event::register_event("postEngCreateInstancedBaseline", "");
-event::register_event("postEngCvarDirectSet", "");
-event::register_event("postEngForceUnmodified", "");
-event::register_event("postEngGetPlayerStats", "");
-event::register_event("postEngAddServerCommand", "");
-event::register_event("postEngVoiceGetClientListening", "");
-event::register_event("postEngVoiceSetClientListening", "");
-event::register_event("postEngGetPlayerAuthId", "");
-event::register_event("postEngSequenceGet", "");
-event::register_event("postEngSequencePickSentence", "");
-event::register_event("postEngGetFileSize", "");
-event::register_event("postEngGetApproxWavePlayLen", "");
-event::register_event("postEngIsCareerMatch", "");
-event::register_event("postEngGetLocalizedStringLength", "");
-event::register_event("postEngRegisterTutorMessageShown", "");
-event::register_event("postEngGetTimesTutorMessageShown", "");
-event::register_event("postEngProcessTutorMessageDecayBuffer", "");
-event::register_event("postEngConstructTutorMessageDecayBuffer", "");
-event::register_event("postEngResetTutorMessageDecayData", "");
-event::register_event("postEngQueryClientCvarValue", "");
-event::register_event("postEngQueryClientCvarValue2", "");
-event::register_event("postEngCheckParm", "");
-event::register_event("postEngPEntityOfEntIndexAllEntities", "");
+      event::register_event(EventId::postEngPrecacheModel, "");
+event::register_event(EventId::postEngPrecacheSound, "");
+event::register_event(EventId::postEngSetModel, "");
+event::register_event(EventId::postEngModelIndex, "");
+event::register_event(EventId::postEngModelFrames, "");
+event::register_event(EventId::postEngSetSize, "");
+event::register_event(EventId::postEngChangeLevel, "");
+event::register_event(EventId::postEngGetSpawnParms, "");
+event::register_event(EventId::postEngSaveSpawnParms, "");
+event::register_event(EventId::postEngVecToYaw, "");
+event::register_event(EventId::postEngVecToAngles, "");
+event::register_event(EventId::postEngMoveToOrigin, "");
+event::register_event(EventId::postEngChangeYaw, "");
+event::register_event(EventId::postEngChangePitch, "");
+event::register_event(EventId::postEngFindEntityByString, "");
+event::register_event(EventId::postEngGetEntityIllum, "");
+event::register_event(EventId::postEngFindEntityInSphere, "");
+event::register_event(EventId::postEngFindClientInPVS, "");
+event::register_event(EventId::postEngEntitiesInPVS, "");
+event::register_event(EventId::postEngMakeVectors, "");
+event::register_event(EventId::postEngAngleVectors, "");
+event::register_event(EventId::postEngCreateEntity, "");
+event::register_event(EventId::postEngRemoveEntity, "");
+event::register_event(EventId::postEngCreateNamedEntity, "");
+event::register_event(EventId::postEngMakeStatic, "");
+event::register_event(EventId::postEngEntIsOnFloor, "");
+event::register_event(EventId::postEngDropToFloor, "");
+event::register_event(EventId::postEngWalkMove, "");
+event::register_event(EventId::postEngSetOrigin, "");
+event::register_event(EventId::postEngEmitSound, "");
+event::register_event(EventId::postEngEmitAmbientSound, "");
+event::register_event(EventId::postEngTraceLine, "");
+event::register_event(EventId::postEngTraceToss, "");
+event::register_event(EventId::postEngTraceMonsterHull, "");
+event::register_event(EventId::postEngTraceHull, "");
+event::register_event(EventId::postEngTraceModel, "");
+event::register_event(EventId::postEngTraceTexture, "");
+event::register_event(EventId::postEngTraceSphere, "");
+event::register_event(EventId::postEngGetAimVector, "");
+event::register_event(EventId::postEngServerCommand, "");
+event::register_event(EventId::postEngServerExecute, "");
+event::register_event(EventId::postEngClientCommand, "");
+event::register_event(EventId::postEngParticleEffect, "");
+event::register_event(EventId::postEngLightStyle, "");
+event::register_event(EventId::postEngDecalIndex, "");
+event::register_event(EventId::postEngPointContents, "");
+event::register_event(EventId::postEngMessageBegin, "");
+event::register_event(EventId::postEngMessageEnd, "");
+event::register_event(EventId::postEngWriteByte, "");
+event::register_event(EventId::postEngWriteChar, "");
+event::register_event(EventId::postEngWriteShort, "");
+event::register_event(EventId::postEngWriteLong, "");
+event::register_event(EventId::postEngWriteAngle, "");
+event::register_event(EventId::postEngWriteCoord, "");
+event::register_event(EventId::postEngWriteString, "");
+event::register_event(EventId::postEngWriteEntity, "");
+event::register_event(EventId::postEngCVarRegister, "");
+event::register_event(EventId::postEngCVarGetFloat, "");
+event::register_event(EventId::postEngCVarGetString, "");
+event::register_event(EventId::postEngCVarSetFloat, "");
+event::register_event(EventId::postEngCVarSetString, "");
+event::register_event(EventId::postEngAlertMessage, "");
+event::register_event(EventId::postEngEngineFprintf, "");
+event::register_event(EventId::postEngPvAllocEntPrivateData, "");
+event::register_event(EventId::postEngPvEntPrivateData, "");
+event::register_event(EventId::postEngFreeEntPrivateData, "");
+event::register_event(EventId::postEngSzFromIndex, "");
+event::register_event(EventId::postEngAllocString, "");
+event::register_event(EventId::postEngGetVarsOfEnt, "");
+event::register_event(EventId::postEngPEntityOfEntOffset, "");
+event::register_event(EventId::postEngEntOffsetOfPEntity, "");
+event::register_event(EventId::postEngIndexOfEdict, "");
+event::register_event(EventId::postEngPEntityOfEntIndex, "");
+event::register_event(EventId::postEngFindEntityByVars, "");
+event::register_event(EventId::postEngGetModelPtr, "");
+event::register_event(EventId::postEngRegUserMsg, "");
+event::register_event(EventId::postEngAnimationAutomove, "");
+event::register_event(EventId::postEngGetBonePosition, "");
+event::register_event(EventId::postEngFunctionFromName, "");
+event::register_event(EventId::postEngNameForFunction, "");
+event::register_event(EventId::postEngClientPrintf, "");
+event::register_event(EventId::postEngServerPrint, "");
+event::register_event(EventId::postEngCmdArgs, "");
+event::register_event(EventId::postEngCmdArgv, "");
+event::register_event(EventId::postEngCmdArgc, "");
+event::register_event(EventId::postEngGetAttachment, "");
+event::register_event(EventId::postEngCRC32Init, "");
+event::register_event(EventId::postEngCRC32ProcessBuffer, "");
+event::register_event(EventId::postEngCRC32ProcessByte, "");
+event::register_event(EventId::postEngCRC32Final, "");
+event::register_event(EventId::postEngRandomLong, "");
+event::register_event(EventId::postEngRandomFloat, "");
+event::register_event(EventId::postEngSetView, "");
+event::register_event(EventId::postEngTime, "");
+event::register_event(EventId::postEngCrosshairAngle, "");
+event::register_event(EventId::postEngLoadFileForMe, "");
+event::register_event(EventId::postEngFreeFile, "");
+event::register_event(EventId::postEngEndSection, "");
+event::register_event(EventId::postEngCompareFileTime, "");
+event::register_event(EventId::postEngGetGameDir, "");
+event::register_event(EventId::postEngCvarRegisterVariable, "");
+event::register_event(EventId::postEngFadeClientVolume, "");
+event::register_event(EventId::postEngSetClientMaxspeed, "");
+event::register_event(EventId::postEngCreateFakeClient, "");
+event::register_event(EventId::postEngRunPlayerMove, "");
+event::register_event(EventId::postEngNumberOfEntities, "");
+event::register_event(EventId::postEngGetInfoKeyBuffer, "");
+event::register_event(EventId::postEngInfoKeyValue, "");
+event::register_event(EventId::postEngSetKeyValue, "");
+event::register_event(EventId::postEngSetClientKeyValue, "");
+event::register_event(EventId::postEngIsMapValid, "");
+event::register_event(EventId::postEngStaticDecal, "");
+event::register_event(EventId::postEngPrecacheGeneric, "");
+event::register_event(EventId::postEngGetPlayerUserId, "");
+event::register_event(EventId::postEngBuildSoundMsg, "");
+event::register_event(EventId::postEngIsDedicatedServer, "");
+event::register_event(EventId::postEngCVarGetPointer, "");
+event::register_event(EventId::postEngGetPlayerWONId, "");
+event::register_event(EventId::postEngInfoRemoveKey, "");
+event::register_event(EventId::postEngGetPhysicsKeyValue, "");
+event::register_event(EventId::postEngSetPhysicsKeyValue, "");
+event::register_event(EventId::postEngGetPhysicsInfoString, "");
+event::register_event(EventId::postEngPrecacheEvent, "");
+event::register_event(EventId::postEngPlaybackEvent, "");
+event::register_event(EventId::postEngSetFatPVS, "");
+event::register_event(EventId::postEngSetFatPAS, "");
+event::register_event(EventId::postEngCheckVisibility, "");
+event::register_event(EventId::postEngDeltaSetField, "");
+event::register_event(EventId::postEngDeltaUnsetField, "");
+event::register_event(EventId::postEngDeltaAddEncoder, "");
+event::register_event(EventId::postEngGetCurrentPlayer, "");
+event::register_event(EventId::postEngCanSkipPlayer, "");
+event::register_event(EventId::postEngDeltaFindField, "");
+event::register_event(EventId::postEngDeltaSetFieldByIndex, "");
+event::register_event(EventId::postEngDeltaUnsetFieldByIndex, "");
+event::register_event(EventId::postEngSetGroupMask, "");
+event::register_event(EventId::postEngCreateInstancedBaseline, "");
+event::register_event(EventId::postEngCvarDirectSet, "");
+event::register_event(EventId::postEngForceUnmodified, "");
+event::register_event(EventId::postEngGetPlayerStats, "");
+event::register_event(EventId::postEngAddServerCommand, "");
+event::register_event(EventId::postEngVoiceGetClientListening, "");
+event::register_event(EventId::postEngVoiceSetClientListening, "");
+event::register_event(EventId::postEngGetPlayerAuthId, "");
+event::register_event(EventId::postEngSequenceGet, "");
+event::register_event(EventId::postEngSequencePickSentence, "");
+event::register_event(EventId::postEngGetFileSize, "");
+event::register_event(EventId::postEngGetApproxWavePlayLen, "");
+event::register_event(EventId::postEngIsCareerMatch, "");
+event::register_event(EventId::postEngGetLocalizedStringLength, "");
+event::register_event(EventId::postEngRegisterTutorMessageShown, "");
+event::register_event(EventId::postEngGetTimesTutorMessageShown, "");
+event::register_event(EventId::postEngProcessTutorMessageDecayBuffer, "");
+event::register_event(EventId::postEngConstructTutorMessageDecayBuffer, "");
+event::register_event(EventId::postEngResetTutorMessageDecayData, "");
+event::register_event(EventId::postEngQueryClientCvarValue, "");
+event::register_event(EventId::postEngQueryClientCvarValue2, "");
+event::register_event(EventId::postEngCheckParm, "");
+event::register_event(EventId::postEngPEntityOfEntIndexAllEntities, "");
+      // native
+      event::register_event(EventId::engMessage, "");
+event::register_event(EventId::cvarChanged, "");
     }
   
\ No newline at end of file
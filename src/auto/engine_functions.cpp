@@ -1,16 +1,23 @@
 // This file is generated automatically. Don't edit it.
 #include <string>
 #include "v8.h"
+#include "v8-fast-api-calls.h"
 #include "extdll.h"
 #include "enginecallback.h"
 #include "node/nodeimpl.hpp"
 #include "node/utils.hpp"
+#include "node/arena.hpp"
+#include "node/events.hpp"
 
 #define V8_STUFF() v8::Isolate* isolate = info.GetIsolate(); \
-  v8::Locker locker(isolate); \
+  V8_ASSERT_LOCKED(isolate); \
   v8::HandleScope scope(isolate); \
   v8::Local<v8::Context> context = isolate->GetCurrentContext()
 
+#define V8_FAST_STUFF() v8::Isolate* isolate = options.isolate; \
+  V8_ASSERT_LOCKED(isolate); \
+  v8::HandleScope scope(isolate)
+
 #include "structures/structures.hpp"
 
 extern enginefuncs_t	 g_engfuncs;
@@ -20,7 +27,7 @@ void sf_eng_pfnPrecacheModel(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnPrecacheModel)(utils::js2string(isolate, info[0]))));
+  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnPrecacheModel)(arena::persistentString(isolate, info[0]))));
 }
 
 // nodemod.eng.precacheSound(s: string);
@@ -28,7 +35,7 @@ void sf_eng_pfnPrecacheSound(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnPrecacheSound)(utils::js2string(isolate, info[0]))));
+  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnPrecacheSound)(arena::persistentString(isolate, info[0]))));
 }
 
 // nodemod.eng.setModel(e: Entity, m: string);
@@ -37,7 +44,7 @@ void sf_eng_pfnSetModel(const v8::FunctionCallbackInfo<v8::Value>& info)
   V8_STUFF();
 
   (*g_engfuncs.pfnSetModel)(structures::unwrapEntity(isolate, info[0]),
-utils::js2string(isolate, info[1]));
+arena::persistentString(isolate, info[1]));
 }
 
 // nodemod.eng.modelIndex(m: string);
@@ -45,7 +52,7 @@ void sf_eng_pfnModelIndex(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnModelIndex)(utils::js2string(isolate, info[0]))));
+  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnModelIndex)(arena::frameString(isolate, info[0]))));
 }
 
 // nodemod.eng.modelFrames(modelIndex: number);
@@ -56,6 +63,13 @@ void sf_eng_pfnModelFrames(const v8::FunctionCallbackInfo<v8::Value>& info)
   info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnModelFrames)(info[0]->Int32Value(context).ToChecked())));
 }
 
+int32_t ff_eng_pfnModelFrames(v8::Local<v8::Object> receiver, int32_t modelIndex)
+{
+  event::FastCallScope fastCall;
+  return (*g_engfuncs.pfnModelFrames)(modelIndex);
+}
+static const v8::CFunction cf_eng_pfnModelFrames = v8::CFunction::Make(ff_eng_pfnModelFrames);
+
 // nodemod.eng.setSize(e: Entity, rgflMin: number[], rgflMax: number[]);
 void sf_eng_pfnSetSize(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
@@ -78,8 +92,8 @@ void sf_eng_pfnChangeLevel(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  (*g_engfuncs.pfnChangeLevel)(utils::js2string(isolate, info[0]),
-utils::js2string(isolate, info[1]));
+  (*g_engfuncs.pfnChangeLevel)(arena::frameString(isolate, info[0]),
+arena::frameString(isolate, info[1]));
 }
 
 // nodemod.eng.getSpawnParms(ent: Entity);
@@ -149,6 +163,14 @@ void sf_eng_pfnChangeYaw(const v8::FunctionCallbackInfo<v8::Value>& info)
   (*g_engfuncs.pfnChangeYaw)(structures::unwrapEntity(isolate, info[0]));
 }
 
+void ff_eng_pfnChangeYaw(v8::Local<v8::Object> receiver, v8::Local<v8::Value> ent, v8::FastApiCallbackOptions& options)
+{
+  event::FastCallScope fastCall;
+  V8_FAST_STUFF();
+  (*g_engfuncs.pfnChangeYaw)(structures::unwrapEntity(isolate, ent));
+}
+static const v8::CFunction cf_eng_pfnChangeYaw = v8::CFunction::Make(ff_eng_pfnChangeYaw);
+
 // nodemod.eng.changePitch(ent: Entity);
 void sf_eng_pfnChangePitch(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
@@ -157,14 +179,22 @@ void sf_eng_pfnChangePitch(const v8::FunctionCallbackInfo<v8::Value>& info)
   (*g_engfuncs.pfnChangePitch)(structures::unwrapEntity(isolate, info[0]));
 }
 
+void ff_eng_pfnChangePitch(v8::Local<v8::Object> receiver, v8::Local<v8::Value> ent, v8::FastApiCallbackOptions& options)
+{
+  event::FastCallScope fastCall;
+  V8_FAST_STUFF();
+  (*g_engfuncs.pfnChangePitch)(structures::unwrapEntity(isolate, ent));
+}
+static const v8::CFunction cf_eng_pfnChangePitch = v8::CFunction::Make(ff_eng_pfnChangePitch);
+
 // nodemod.eng.findEntityByString(pEdictStartSearchAfter: Entity, pszField: string, pszValue: string);
 void sf_eng_pfnFindEntityByString(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
   info.GetReturnValue().Set(structures::wrapEntity(isolate, (*g_engfuncs.pfnFindEntityByString)(structures::unwrapEntity(isolate, info[0]),
-utils::js2string(isolate, info[1]),
-utils::js2string(isolate, info[2]))));
+arena::frameString(isolate, info[1]),
+arena::frameString(isolate, info[2]))));
 }
 
 // nodemod.eng.getEntityIllum(pEnt: Entity);
@@ -175,6 +205,14 @@ void sf_eng_pfnGetEntityIllum(const v8::FunctionCallbackInfo<v8::Value>& info)
   info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnGetEntityIllum)(structures::unwrapEntity(isolate, info[0]))));
 }
 
+int32_t ff_eng_pfnGetEntityIllum(v8::Local<v8::Object> receiver, v8::Local<v8::Value> pEnt, v8::FastApiCallbackOptions& options)
+{
+  event::FastCallScope fastCall;
+  V8_FAST_STUFF();
+  return (*g_engfuncs.pfnGetEntityIllum)(structures::unwrapEntity(isolate, pEnt));
+}
+static const v8::CFunction cf_eng_pfnGetEntityIllum = v8::CFunction::Make(ff_eng_pfnGetEntityIllum);
+
 // nodemod.eng.findEntityInSphere(pEdictStartSearchAfter: Entity, org: number[], rad: number);
 void sf_eng_pfnFindEntityInSphere(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
@@ -281,6 +319,14 @@ void sf_eng_pfnEntIsOnFloor(const v8::FunctionCallbackInfo<v8::Value>& info)
   info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnEntIsOnFloor)(structures::unwrapEntity(isolate, info[0]))));
 }
 
+int32_t ff_eng_pfnEntIsOnFloor(v8::Local<v8::Object> receiver, v8::Local<v8::Value> e, v8::FastApiCallbackOptions& options)
+{
+  event::FastCallScope fastCall;
+  V8_FAST_STUFF();
+  return (*g_engfuncs.pfnEntIsOnFloor)(structures::unwrapEntity(isolate, e));
+}
+static const v8::CFunction cf_eng_pfnEntIsOnFloor = v8::CFunction::Make(ff_eng_pfnEntIsOnFloor);
+
 // nodemod.eng.dropToFloor(e: Entity);
 void sf_eng_pfnDropToFloor(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
@@ -320,7 +366,7 @@ void sf_eng_pfnEmitSound(const v8::FunctionCallbackInfo<v8::Value>& info)
 
   (*g_engfuncs.pfnEmitSound)(structures::unwrapEntity(isolate, info[0]),
 info[1]->Int32Value(context).ToChecked(),
-utils::js2string(isolate, info[2]),
+arena::frameString(isolate, info[2]),
 info[3]->NumberValue(context).ToChecked(),
 info[4]->NumberValue(context).ToChecked(),
 info[5]->Int32Value(context).ToChecked(),
@@ -338,7 +384,7 @@ void sf_eng_pfnEmitAmbientSound(const v8::FunctionCallbackInfo<v8::Value>& info)
 
   (*g_engfuncs.pfnEmitAmbientSound)(structures::unwrapEntity(isolate, info[0]),
 (const float*)utils::jsToPointer(isolate, info[1]),
-utils::js2string(isolate, info[2]),
+arena::frameString(isolate, info[2]),
 info[3]->NumberValue(context).ToChecked(),
 info[4]->NumberValue(context).ToChecked(),
 info[5]->Int32Value(context).ToChecked(),
@@ -494,7 +540,7 @@ void sf_eng_pfnServerCommand(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  (*g_engfuncs.pfnServerCommand)(utils::js2string(isolate, info[0]));
+  (*g_engfuncs.pfnServerCommand)(arena::frameString(isolate, info[0]));
 }
 
 // nodemod.eng.serverExecute();
@@ -510,7 +556,7 @@ void sf_eng_pfnClientCommand(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  (*g_engfuncs.pfnClientCommand)(structures::unwrapEntity(isolate, info[0]), utils::js2string(isolate, info[1]));;
+  (*g_engfuncs.pfnClientCommand)(structures::unwrapEntity(isolate, info[0]), arena::frameString(isolate, info[1]));;
 }
 
 // nodemod.eng.particleEffect(org: number[], dir: number[], color: number, count: number);
@@ -537,7 +583,7 @@ void sf_eng_pfnLightStyle(const v8::FunctionCallbackInfo<v8::Value>& info)
   V8_STUFF();
 
   (*g_engfuncs.pfnLightStyle)(info[0]->Int32Value(context).ToChecked(),
-utils::js2string(isolate, info[1]));
+arena::persistentString(isolate, info[1]));
 }
 
 // nodemod.eng.decalIndex(name: string);
@@ -545,7 +591,7 @@ void sf_eng_pfnDecalIndex(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnDecalIndex)(utils::js2string(isolate, info[0]))));
+  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnDecalIndex)(arena::frameString(isolate, info[0]))));
 }
 
 // nodemod.eng.pointContents(rgflVector: number[]);
@@ -636,7 +682,7 @@ void sf_eng_pfnWriteString(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  (*g_engfuncs.pfnWriteString)(utils::js2string(isolate, info[0]));
+  (*g_engfuncs.pfnWriteString)(arena::frameString(isolate, info[0]));
 }
 
 // nodemod.eng.writeEntity(iValue: number);
@@ -695,7 +741,7 @@ void sf_eng_pfnCVarGetFloat(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnCVarGetFloat)(utils::js2string(isolate, info[0]))));
+  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnCVarGetFloat)(arena::frameString(isolate, info[0]))));
 }
 
 // nodemod.eng.cVarGetString(szVarName: string);
@@ -703,7 +749,7 @@ void sf_eng_pfnCVarGetString(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  const char* temp_str = (*g_engfuncs.pfnCVarGetString)(utils::js2string(isolate, info[0]));
+  const char* temp_str = (*g_engfuncs.pfnCVarGetString)(arena::frameString(isolate, info[0]));
   info.GetReturnValue().Set(v8::String::NewFromUtf8(isolate, temp_str ? temp_str : "").ToLocalChecked());
 }
 
@@ -712,7 +758,7 @@ void sf_eng_pfnCVarSetFloat(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  (*g_engfuncs.pfnCVarSetFloat)(utils::js2string(isolate, info[0]),
+  (*g_engfuncs.pfnCVarSetFloat)(arena::frameString(isolate, info[0]),
 info[1]->NumberValue(context).ToChecked());
 }
 
@@ -721,8 +767,8 @@ void sf_eng_pfnCVarSetString(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  (*g_engfuncs.pfnCVarSetString)(utils::js2string(isolate, info[0]),
-utils::js2string(isolate, info[1]));
+  (*g_engfuncs.pfnCVarSetString)(arena::frameString(isolate, info[0]),
+arena::frameString(isolate, info[1]));
 }
 
 // nodemod.eng.alertMessage(atype: number, szFmt: string, ...args: any[]);
@@ -730,7 +776,7 @@ void sf_eng_pfnAlertMessage(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  (*g_engfuncs.pfnAlertMessage)((ALERT_TYPE)info[0]->Int32Value(context).ToChecked(), "%s", utils::js2string(isolate, info[1]));;
+  (*g_engfuncs.pfnAlertMessage)((ALERT_TYPE)info[0]->Int32Value(context).ToChecked(), "%s", arena::frameString(isolate, info[1]));;
 }
 
 // nodemod.eng.engineFprintf(pfile: FileHandle, szFmt: string, ...args: any[]);
@@ -738,7 +784,7 @@ void sf_eng_pfnEngineFprintf(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  fprintf((FILE*)utils::jsToPointer(isolate, info[0]), "%s", utils::js2string(isolate, info[1]));;
+  fprintf((FILE*)utils::jsToPointer(isolate, info[0]), "%s", arena::frameString(isolate, info[1]));;
 }
 
 // nodemod.eng.pvAllocEntPrivateData(pEdict: Entity, cb: number);
@@ -780,7 +826,7 @@ void sf_eng_pfnAllocString(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnAllocString)(utils::js2string(isolate, info[0]))));
+  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnAllocString)(arena::frameString(isolate, info[0]))));
 }
 
 // nodemod.eng.getVarsOfEnt(pEdict: Entity);
@@ -807,6 +853,14 @@ void sf_eng_pfnEntOffsetOfPEntity(const v8::FunctionCallbackInfo<v8::Value>& inf
   info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnEntOffsetOfPEntity)(structures::unwrapEntity(isolate, info[0]))));
 }
 
+int32_t ff_eng_pfnEntOffsetOfPEntity(v8::Local<v8::Object> receiver, v8::Local<v8::Value> pEdict, v8::FastApiCallbackOptions& options)
+{
+  event::FastCallScope fastCall;
+  V8_FAST_STUFF();
+  return (*g_engfuncs.pfnEntOffsetOfPEntity)(structures::unwrapEntity(isolate, pEdict));
+}
+static const v8::CFunction cf_eng_pfnEntOffsetOfPEntity = v8::CFunction::Make(ff_eng_pfnEntOffsetOfPEntity);
+
 // nodemod.eng.indexOfEdict(pEdict: Entity);
 void sf_eng_pfnIndexOfEdict(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
@@ -820,6 +874,15 @@ void sf_eng_pfnIndexOfEdict(const v8::FunctionCallbackInfo<v8::Value>& info)
   info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnIndexOfEdict)(ent)));;
 }
 
+int32_t ff_eng_pfnIndexOfEdict(v8::Local<v8::Object> receiver, v8::Local<v8::Value> pEdict, v8::FastApiCallbackOptions& options)
+{
+  event::FastCallScope fastCall;
+  V8_FAST_STUFF();
+  edict_t* ent = structures::unwrapEntity(isolate, pEdict);
+  return ent == NULL ? -1 : (*g_engfuncs.pfnIndexOfEdict)(ent);
+}
+static const v8::CFunction cf_eng_pfnIndexOfEdict = v8::CFunction::Make(ff_eng_pfnIndexOfEdict);
+
 // nodemod.eng.pEntityOfEntIndex(iEntIndex: number);
 void sf_eng_pfnPEntityOfEntIndex(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
@@ -849,7 +912,7 @@ void sf_eng_pfnRegUserMsg(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnRegUserMsg)(utils::js2string(isolate, info[0]),
+  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnRegUserMsg)(arena::persistentString(isolate, info[0]),
 info[1]->Int32Value(context).ToChecked())));
 }
 
@@ -885,7 +948,7 @@ void sf_eng_pfnFunctionFromName(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  info.GetReturnValue().Set(v8::External::New(isolate, (*g_engfuncs.pfnFunctionFromName)(utils::js2string(isolate, info[0]))));
+  info.GetReturnValue().Set(v8::External::New(isolate, (*g_engfuncs.pfnFunctionFromName)(arena::frameString(isolate, info[0]))));
 }
 
 // nodemod.eng.nameForFunction(callback: ArrayBuffer | Uint8Array | null);
@@ -908,7 +971,7 @@ void sf_eng_pfnClientPrintf(const v8::FunctionCallbackInfo<v8::Value>& info)
 
   (*g_engfuncs.pfnClientPrintf)(structures::unwrapEntity(isolate, info[0]),
 (PRINT_TYPE)info[1]->Int32Value(context).ToChecked(),
-utils::js2string(isolate, info[2]));
+arena::frameString(isolate, info[2]));
 }
 
 // nodemod.eng.serverPrint(szMsg: string);
@@ -916,7 +979,7 @@ void sf_eng_pfnServerPrint(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  (*g_engfuncs.pfnServerPrint)(utils::js2string(isolate, info[0]));
+  (*g_engfuncs.pfnServerPrint)(arena::frameString(isolate, info[0]));
 }
 
 // nodemod.eng.cmdArgs();
@@ -945,6 +1008,13 @@ void sf_eng_pfnCmd_Argc(const v8::FunctionCallbackInfo<v8::Value>& info)
   info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnCmd_Argc)()));
 }
 
+int32_t ff_eng_pfnCmd_Argc(v8::Local<v8::Object> receiver)
+{
+  event::FastCallScope fastCall;
+  return (*g_engfuncs.pfnCmd_Argc)();
+}
+static const v8::CFunction cf_eng_pfnCmd_Argc = v8::CFunction::Make(ff_eng_pfnCmd_Argc);
+
 // nodemod.eng.getAttachment(pEdict: Entity, iAttachment: number, rgflOrigin: number[], rgflAngles: number[]);
 void sf_eng_pfnGetAttachment(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
@@ -972,6 +1042,13 @@ void sf_eng_pfnRandomLong(const v8::FunctionCallbackInfo<v8::Value>& info)
 info[1]->Int32Value(context).ToChecked())));
 }
 
+int32_t ff_eng_pfnRandomLong(v8::Local<v8::Object> receiver, int32_t lLow, int32_t lHigh)
+{
+  event::FastCallScope fastCall;
+  return (*g_engfuncs.pfnRandomLong)(lLow, lHigh);
+}
+static const v8::CFunction cf_eng_pfnRandomLong = v8::CFunction::Make(ff_eng_pfnRandomLong);
+
 // nodemod.eng.randomFloat(flLow: number, flHigh: number);
 void sf_eng_pfnRandomFloat(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
@@ -981,6 +1058,13 @@ void sf_eng_pfnRandomFloat(const v8::FunctionCallbackInfo<v8::Value>& info)
 info[1]->NumberValue(context).ToChecked())));
 }
 
+double ff_eng_pfnRandomFloat(v8::Local<v8::Object> receiver, double flLow, double flHigh)
+{
+  event::FastCallScope fastCall;
+  return (*g_engfuncs.pfnRandomFloat)(flLow, flHigh);
+}
+static const v8::CFunction cf_eng_pfnRandomFloat = v8::CFunction::Make(ff_eng_pfnRandomFloat);
+
 // nodemod.eng.setView(pClient: Entity, pViewent: Entity);
 void sf_eng_pfnSetView(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
@@ -998,6 +1082,13 @@ void sf_eng_pfnTime(const v8::FunctionCallbackInfo<v8::Value>& info)
   info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnTime)()));
 }
 
+double ff_eng_pfnTime(v8::Local<v8::Object> receiver)
+{
+  event::FastCallScope fastCall;
+  return (*g_engfuncs.pfnTime)();
+}
+static const v8::CFunction cf_eng_pfnTime = v8::CFunction::Make(ff_eng_pfnTime);
+
 // nodemod.eng.crosshairAngle(pClient: Entity, pitch: number, yaw: number);
 void sf_eng_pfnCrosshairAngle(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
@@ -1014,7 +1105,7 @@ void sf_eng_pfnLoadFileForMe(const v8::FunctionCallbackInfo<v8::Value>& info)
   V8_STUFF();
 
   int fileLength = 0;
-  byte* result = (*g_engfuncs.pfnLoadFileForMe)(utils::js2string(isolate, info[0]), &fileLength);
+  byte* result = (*g_engfuncs.pfnLoadFileForMe)(arena::frameString(isolate, info[0]), &fileLength);
   if (result && fileLength > 0) {
     auto jsArray = utils::byteArrayToJS(isolate, result, fileLength);
     (*g_engfuncs.pfnFreeFile)(result);
@@ -1041,7 +1132,7 @@ void sf_eng_pfnEndSection(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  (*g_engfuncs.pfnEndSection)(utils::js2string(isolate, info[0]));
+  (*g_engfuncs.pfnEndSection)(arena::frameString(isolate, info[0]));
 }
 
 // nodemod.eng.compareFileTime(filename1: string, filename2: string, iCompare: number[]);
@@ -1053,8 +1144,8 @@ void sf_eng_pfnCompareFileTime(const v8::FunctionCallbackInfo<v8::Value>& info)
     //printf("Warning: pfnCompareFileTime parameter 2 (int *) is not External, using nullptr\n");
   //}
 
-  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnCompareFileTime)(utils::js2string(isolate, info[0]),
-utils::js2string(isolate, info[1]),
+  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnCompareFileTime)(arena::frameString(isolate, info[0]),
+arena::frameString(isolate, info[1]),
 (int*)utils::jsToPointer(isolate, info[2]))));
 }
 
@@ -1063,7 +1154,7 @@ void sf_eng_pfnGetGameDir(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  (*g_engfuncs.pfnGetGameDir)(utils::js2string(isolate, info[0]));
+  (*g_engfuncs.pfnGetGameDir)(arena::frameBuffer(isolate, info[0]));
 }
 
 // nodemod.eng.cvarRegisterVariable(variable: Cvar);
@@ -1100,7 +1191,7 @@ void sf_eng_pfnCreateFakeClient(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  info.GetReturnValue().Set(structures::wrapEntity(isolate, (*g_engfuncs.pfnCreateFakeClient)(utils::js2string(isolate, info[0]))));
+  info.GetReturnValue().Set(structures::wrapEntity(isolate, (*g_engfuncs.pfnCreateFakeClient)(arena::frameString(isolate, info[0]))));
 }
 
 // nodemod.eng.runPlayerMove(fakeclient: Entity, viewangles: number[], forwardmove: number, sidemove: number, upmove: number, buttons: number, impulse: number, msec: number);
@@ -1130,6 +1221,13 @@ void sf_eng_pfnNumberOfEntities(const v8::FunctionCallbackInfo<v8::Value>& info)
   info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnNumberOfEntities)()));
 }
 
+int32_t ff_eng_pfnNumberOfEntities(v8::Local<v8::Object> receiver)
+{
+  event::FastCallScope fastCall;
+  return (*g_engfuncs.pfnNumberOfEntities)();
+}
+static const v8::CFunction cf_eng_pfnNumberOfEntities = v8::CFunction::Make(ff_eng_pfnNumberOfEntities);
+
 // nodemod.eng.getInfoKeyBuffer(e: Entity);
 void sf_eng_pfnGetInfoKeyBuffer(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
@@ -1144,8 +1242,8 @@ void sf_eng_pfnInfoKeyValue(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  const char* temp_str = (*g_engfuncs.pfnInfoKeyValue)(utils::js2string(isolate, info[0]),
-utils::js2string(isolate, info[1]));
+  const char* temp_str = (*g_engfuncs.pfnInfoKeyValue)(arena::frameString(isolate, info[0]),
+arena::frameString(isolate, info[1]));
   info.GetReturnValue().Set(v8::String::NewFromUtf8(isolate, temp_str ? temp_str : "").ToLocalChecked());
 }
 
@@ -1154,9 +1252,9 @@ void sf_eng_pfnSetKeyValue(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  (*g_engfuncs.pfnSetKeyValue)(utils::js2string(isolate, info[0]),
-utils::js2string(isolate, info[1]),
-utils::js2string(isolate, info[2]));
+  (*g_engfuncs.pfnSetKeyValue)(arena::frameBuffer(isolate, info[0]),
+arena::frameString(isolate, info[1]),
+arena::frameString(isolate, info[2]));
 }
 
 // nodemod.eng.setClientKeyValue();
@@ -1169,8 +1267,8 @@ void sf_eng_pfnSetClientKeyValue(const v8::FunctionCallbackInfo<v8::Value>& info
   char* infobuffer = (*g_engfuncs.pfnGetInfoKeyBuffer)(entity);
   (*g_engfuncs.pfnSetClientKeyValue)(clientIndex,
     infobuffer,
-    utils::js2string(isolate, info[2]),
-    utils::js2string(isolate, info[3]));;
+    arena::frameString(isolate, info[2]),
+    arena::frameString(isolate, info[3]));;
 }
 
 // nodemod.eng.isMapValid(filename: string);
@@ -1178,7 +1276,7 @@ void sf_eng_pfnIsMapValid(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnIsMapValid)(utils::js2string(isolate, info[0]))));
+  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnIsMapValid)(arena::frameString(isolate, info[0]))));
 }
 
 // nodemod.eng.staticDecal(origin: number[], decalIndex: number, entityIndex: number, modelIndex: number);
@@ -1201,7 +1299,7 @@ void sf_eng_pfnPrecacheGeneric(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnPrecacheGeneric)(utils::js2string(isolate, info[0]))));
+  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnPrecacheGeneric)(arena::persistentString(isolate, info[0]))));
 }
 
 // nodemod.eng.getPlayerUserId(e: Entity);
@@ -1212,6 +1310,14 @@ void sf_eng_pfnGetPlayerUserId(const v8::FunctionCallbackInfo<v8::Value>& info)
   info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnGetPlayerUserId)(structures::unwrapEntity(isolate, info[0]))));
 }
 
+int32_t ff_eng_pfnGetPlayerUserId(v8::Local<v8::Object> receiver, v8::Local<v8::Value> e, v8::FastApiCallbackOptions& options)
+{
+  event::FastCallScope fastCall;
+  V8_FAST_STUFF();
+  return (*g_engfuncs.pfnGetPlayerUserId)(structures::unwrapEntity(isolate, e));
+}
+static const v8::CFunction cf_eng_pfnGetPlayerUserId = v8::CFunction::Make(ff_eng_pfnGetPlayerUserId);
+
 // nodemod.eng.buildSoundMsg(entity: Entity, channel: number, sample: string, volume: number, attenuation: number, fFlags: number, pitch: number, msg_dest: number, msg_type: number, pOrigin: number[], ed: Entity);
 void sf_eng_pfnBuildSoundMsg(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
@@ -1223,7 +1329,7 @@ void sf_eng_pfnBuildSoundMsg(const v8::FunctionCallbackInfo<v8::Value>& info)
 
   (*g_engfuncs.pfnBuildSoundMsg)(structures::unwrapEntity(isolate, info[0]),
 info[1]->Int32Value(context).ToChecked(),
-utils::js2string(isolate, info[2]),
+arena::frameString(isolate, info[2]),
 info[3]->NumberValue(context).ToChecked(),
 info[4]->NumberValue(context).ToChecked(),
 info[5]->Int32Value(context).ToChecked(),
@@ -1242,12 +1348,19 @@ void sf_eng_pfnIsDedicatedServer(const v8::FunctionCallbackInfo<v8::Value>& info
   info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnIsDedicatedServer)()));
 }
 
+int32_t ff_eng_pfnIsDedicatedServer(v8::Local<v8::Object> receiver)
+{
+  event::FastCallScope fastCall;
+  return (*g_engfuncs.pfnIsDedicatedServer)();
+}
+static const v8::CFunction cf_eng_pfnIsDedicatedServer = v8::CFunction::Make(ff_eng_pfnIsDedicatedServer);
+
 // nodemod.eng.cVarGetPointer(szVarName: string);
 void sf_eng_pfnCVarGetPointer(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  info.GetReturnValue().Set(structures::wrapCvar(isolate, (*g_engfuncs.pfnCVarGetPointer)(utils::js2string(isolate, info[0]))));
+  info.GetReturnValue().Set(structures::wrapCvar(isolate, (*g_engfuncs.pfnCVarGetPointer)(arena::frameString(isolate, info[0]))));
 }
 
 // nodemod.eng.getPlayerWONId(e: Entity);
@@ -1258,13 +1371,21 @@ void sf_eng_pfnGetPlayerWONId(const v8::FunctionCallbackInfo<v8::Value>& info)
   info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnGetPlayerWONId)(structures::unwrapEntity(isolate, info[0]))));
 }
 
+uint32_t ff_eng_pfnGetPlayerWONId(v8::Local<v8::Object> receiver, v8::Local<v8::Value> e, v8::FastApiCallbackOptions& options)
+{
+  event::FastCallScope fastCall;
+  V8_FAST_STUFF();
+  return (*g_engfuncs.pfnGetPlayerWONId)(structures::unwrapEntity(isolate, e));
+}
+static const v8::CFunction cf_eng_pfnGetPlayerWONId = v8::CFunction::Make(ff_eng_pfnGetPlayerWONId);
+
 // nodemod.eng.infoRemoveKey(s: string, key: string);
 void sf_eng_pfnInfo_RemoveKey(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  (*g_engfuncs.pfnInfo_RemoveKey)(utils::js2string(isolate, info[0]),
-utils::js2string(isolate, info[1]));
+  (*g_engfuncs.pfnInfo_RemoveKey)(arena::frameBuffer(isolate, info[0]),
+arena::frameString(isolate, info[1]));
 }
 
 // nodemod.eng.getPhysicsKeyValue(pClient: Entity, key: string);
@@ -1273,7 +1394,7 @@ void sf_eng_pfnGetPhysicsKeyValue(const v8::FunctionCallbackInfo<v8::Value>& inf
   V8_STUFF();
 
   const char* temp_str = (*g_engfuncs.pfnGetPhysicsKeyValue)(structures::unwrapEntity(isolate, info[0]),
-utils::js2string(isolate, info[1]));
+arena::frameString(isolate, info[1]));
   info.GetReturnValue().Set(v8::String::NewFromUtf8(isolate, temp_str ? temp_str : "").ToLocalChecked());
 }
 
@@ -1283,8 +1404,8 @@ void sf_eng_pfnSetPhysicsKeyValue(const v8::FunctionCallbackInfo<v8::Value>& inf
   V8_STUFF();
 
   (*g_engfuncs.pfnSetPhysicsKeyValue)(structures::unwrapEntity(isolate, info[0]),
-utils::js2string(isolate, info[1]),
-utils::js2string(isolate, info[2]));
+arena::frameString(isolate, info[1]),
+arena::frameString(isolate, info[2]));
 }
 
 // nodemod.eng.getPhysicsInfoString(pClient: Entity);
@@ -1302,7 +1423,7 @@ void sf_eng_pfnPrecacheEvent(const v8::FunctionCallbackInfo<v8::Value>& info)
   V8_STUFF();
 
   info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnPrecacheEvent)(info[0]->Int32Value(context).ToChecked(),
-utils::js2string(isolate, info[1]))));
+arena::persistentString(isolate, info[1]))));
 }
 
 // nodemod.eng.playbackEvent(flags: number, pInvoker: Entity, eventindex: number, delay: number, origin: number[], angles: number[], fparam1: number, fparam2: number, iparam1: number, iparam2: number, bparam1: number, bparam2: number);
@@ -1374,7 +1495,7 @@ void sf_eng_pfnDeltaSetField(const v8::FunctionCallbackInfo<v8::Value>& info)
   V8_STUFF();
 
   (*g_engfuncs.pfnDeltaSetField)(structures::unwrapDelta(isolate, info[0]),
-utils::js2string(isolate, info[1]));
+arena::frameString(isolate, info[1]));
 }
 
 // nodemod.eng.deltaUnsetField(pFields: Delta, fieldname: string);
@@ -1383,7 +1504,7 @@ void sf_eng_pfnDeltaUnsetField(const v8::FunctionCallbackInfo<v8::Value>& info)
   V8_STUFF();
 
   (*g_engfuncs.pfnDeltaUnsetField)(structures::unwrapDelta(isolate, info[0]),
-utils::js2string(isolate, info[1]));
+arena::frameString(isolate, info[1]));
 }
 
 // nodemod.eng.deltaAddEncoder();
@@ -1492,6 +1613,13 @@ void sf_eng_pfnGetCurrentPlayer(const v8::FunctionCallbackInfo<v8::Value>& info)
   info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnGetCurrentPlayer)()));
 }
 
+int32_t ff_eng_pfnGetCurrentPlayer(v8::Local<v8::Object> receiver)
+{
+  event::FastCallScope fastCall;
+  return (*g_engfuncs.pfnGetCurrentPlayer)();
+}
+static const v8::CFunction cf_eng_pfnGetCurrentPlayer = v8::CFunction::Make(ff_eng_pfnGetCurrentPlayer);
+
 // nodemod.eng.canSkipPlayer(player: Entity);
 void sf_eng_pfnCanSkipPlayer(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
@@ -1500,13 +1628,21 @@ void sf_eng_pfnCanSkipPlayer(const v8::FunctionCallbackInfo<v8::Value>& info)
   info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnCanSkipPlayer)(structures::unwrapEntity(isolate, info[0]))));
 }
 
+int32_t ff_eng_pfnCanSkipPlayer(v8::Local<v8::Object> receiver, v8::Local<v8::Value> player, v8::FastApiCallbackOptions& options)
+{
+  event::FastCallScope fastCall;
+  V8_FAST_STUFF();
+  return (*g_engfuncs.pfnCanSkipPlayer)(structures::unwrapEntity(isolate, player));
+}
+static const v8::CFunction cf_eng_pfnCanSkipPlayer = v8::CFunction::Make(ff_eng_pfnCanSkipPlayer);
+
 // nodemod.eng.deltaFindField(pFields: Delta, fieldname: string);
 void sf_eng_pfnDeltaFindField(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
   info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnDeltaFindField)(structures::unwrapDelta(isolate, info[0]),
-utils::js2string(isolate, info[1]))));
+arena::frameString(isolate, info[1]))));
 }
 
 // nodemod.eng.deltaSetFieldByIndex(pFields: Delta, fieldNumber: number);
@@ -1550,7 +1686,7 @@ void sf_eng_pfnCvar_DirectSet(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  (*g_engfuncs.pfnCvar_DirectSet)((cvar_t*)structures::unwrapCvar(isolate, info[0]), utils::js2string(isolate, info[1]));;
+  (*g_engfuncs.pfnCvar_DirectSet)((cvar_t*)structures::unwrapCvar(isolate, info[0]), arena::frameString(isolate, info[1]));;
 }
 
 // nodemod.eng.forceUnmodified(type: number, mins: number[], maxs: number[], filename: string);
@@ -1568,7 +1704,7 @@ void sf_eng_pfnForceUnmodified(const v8::FunctionCallbackInfo<v8::Value>& info)
   (*g_engfuncs.pfnForceUnmodified)((FORCE_TYPE)info[0]->Int32Value(context).ToChecked(),
 (const float*)utils::jsToPointer(isolate, info[1]),
 (const float*)utils::jsToPointer(isolate, info[2]),
-utils::js2string(isolate, info[3]));
+arena::frameString(isolate, info[3]));
 }
 
 // nodemod.eng.getPlayerStats(pClient: Entity, ping: number[], packet_loss: number[]);
@@ -1659,7 +1795,8 @@ void sf_eng_pfnAddServerCommand(const v8::FunctionCallbackInfo<v8::Value>& info)
   };
   
   //printf("[DEBUG] Calling pfnAddServerCommand for '%s'\n", cmdName.c_str());
-  (*g_engfuncs.pfnAddServerCommand)(cmdName.c_str(), wrapperFunction);
+  // The engine keeps the name pointer for as long as the command exists
+  (*g_engfuncs.pfnAddServerCommand)(arena::persistentString(isolate, info[0]), wrapperFunction);
   //printf("[DEBUG] pfnAddServerCommand completed for '%s'\n", cmdName.c_str());;
 }
 
@@ -1672,6 +1809,13 @@ void sf_eng_pfnVoice_GetClientListening(const v8::FunctionCallbackInfo<v8::Value
 info[1]->Int32Value(context).ToChecked())));
 }
 
+bool ff_eng_pfnVoice_GetClientListening(v8::Local<v8::Object> receiver, int32_t iReceiver, int32_t iSender)
+{
+  event::FastCallScope fastCall;
+  return (*g_engfuncs.pfnVoice_GetClientListening)(iReceiver, iSender);
+}
+static const v8::CFunction cf_eng_pfnVoice_GetClientListening = v8::CFunction::Make(ff_eng_pfnVoice_GetClientListening);
+
 // nodemod.eng.voiceSetClientListening(iReceiver: number, iSender: number, bListen: boolean);
 void sf_eng_pfnVoice_SetClientListening(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
@@ -1696,8 +1840,8 @@ void sf_eng_pfnSequenceGet(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  info.GetReturnValue().Set(v8::External::New(isolate, (*g_engfuncs.pfnSequenceGet)(utils::js2string(isolate, info[0]),
-utils::js2string(isolate, info[1]))));
+  info.GetReturnValue().Set(v8::External::New(isolate, (*g_engfuncs.pfnSequenceGet)(arena::frameString(isolate, info[0]),
+arena::frameString(isolate, info[1]))));
 }
 
 // nodemod.eng.sequencePickSentence(groupName: string, pickMethod: number, picked: number[]);
@@ -1709,7 +1853,7 @@ void sf_eng_pfnSequencePickSentence(const v8::FunctionCallbackInfo<v8::Value>& i
     //printf("Warning: pfnSequencePickSentence parameter 2 (int *) is not External, using nullptr\n");
   //}
 
-  info.GetReturnValue().Set(v8::External::New(isolate, (*g_engfuncs.pfnSequencePickSentence)(utils::js2string(isolate, info[0]),
+  info.GetReturnValue().Set(v8::External::New(isolate, (*g_engfuncs.pfnSequencePickSentence)(arena::frameString(isolate, info[0]),
 info[1]->Int32Value(context).ToChecked(),
 (int*)utils::jsToPointer(isolate, info[2]))));
 }
@@ -1719,7 +1863,7 @@ void sf_eng_pfnGetFileSize(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnGetFileSize)(utils::js2string(isolate, info[0]))));
+  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnGetFileSize)(arena::frameString(isolate, info[0]))));
 }
 
 // nodemod.eng.getApproxWavePlayLen(filepath: string);
@@ -1727,7 +1871,7 @@ void sf_eng_pfnGetApproxWavePlayLen(const v8::FunctionCallbackInfo<v8::Value>& i
 {
   V8_STUFF();
 
-  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnGetApproxWavePlayLen)(utils::js2string(isolate, info[0]))));
+  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnGetApproxWavePlayLen)(arena::frameString(isolate, info[0]))));
 }
 
 // nodemod.eng.isCareerMatch();
@@ -1738,12 +1882,19 @@ void sf_eng_pfnIsCareerMatch(const v8::FunctionCallbackInfo<v8::Value>& info)
   info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnIsCareerMatch)()));
 }
 
+int32_t ff_eng_pfnIsCareerMatch(v8::Local<v8::Object> receiver)
+{
+  event::FastCallScope fastCall;
+  return (*g_engfuncs.pfnIsCareerMatch)();
+}
+static const v8::CFunction cf_eng_pfnIsCareerMatch = v8::CFunction::Make(ff_eng_pfnIsCareerMatch);
+
 // nodemod.eng.getLocalizedStringLength(label: string);
 void sf_eng_pfnGetLocalizedStringLength(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnGetLocalizedStringLength)(utils::js2string(isolate, info[0]))));
+  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnGetLocalizedStringLength)(arena::frameString(isolate, info[0]))));
 }
 
 // nodemod.eng.registerTutorMessageShown(mid: number);
@@ -1762,6 +1913,13 @@ void sf_eng_pfnGetTimesTutorMessageShown(const v8::FunctionCallbackInfo<v8::Valu
   info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.pfnGetTimesTutorMessageShown)(info[0]->Int32Value(context).ToChecked())));
 }
 
+int32_t ff_eng_pfnGetTimesTutorMessageShown(v8::Local<v8::Object> receiver, int32_t mid)
+{
+  event::FastCallScope fastCall;
+  return (*g_engfuncs.pfnGetTimesTutorMessageShown)(mid);
+}
+static const v8::CFunction cf_eng_pfnGetTimesTutorMessageShown = v8::CFunction::Make(ff_eng_pfnGetTimesTutorMessageShown);
+
 // nodemod.eng.processTutorMessageDecayBuffer(buffer: number[]);
 void sf_eng_pfnProcessTutorMessageDecayBuffer(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
@@ -1810,7 +1968,7 @@ void sf_eng_pfnQueryClientCvarValue(const v8::FunctionCallbackInfo<v8::Value>& i
   V8_STUFF();
 
   (*g_engfuncs.pfnQueryClientCvarValue)(structures::unwrapEntity(isolate, info[0]),
-utils::js2string(isolate, info[1]));
+arena::frameString(isolate, info[1]));
 }
 
 // nodemod.eng.queryClientCvarValue2(player: Entity, cvarName: string, requestID: number);
@@ -1819,7 +1977,7 @@ void sf_eng_pfnQueryClientCvarValue2(const v8::FunctionCallbackInfo<v8::Value>&
   V8_STUFF();
 
   (*g_engfuncs.pfnQueryClientCvarValue2)(structures::unwrapEntity(isolate, info[0]),
-utils::js2string(isolate, info[1]),
+arena::frameString(isolate, info[1]),
 info[2]->Int32Value(context).ToChecked());
 }
 
@@ -1828,7 +1986,7 @@ void sf_eng_CheckParm(const v8::FunctionCallbackInfo<v8::Value>& info)
 {
   V8_STUFF();
 
-  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.CheckParm)(utils::js2string(isolate, info[0]),
+  info.GetReturnValue().Set(v8::Number::New(isolate, (*g_engfuncs.CheckParm)(arena::frameString(isolate, info[0]),
 (char**)utils::jsToPointer(isolate, info[1]))));
 }
 
@@ -1840,12 +1998,12 @@ void sf_eng_pfnPEntityOfEntIndexAllEntities(const v8::FunctionCallbackInfo<v8::V
   info.GetReturnValue().Set(structures::wrapEntity(isolate, (*g_engfuncs.pfnPEntityOfEntIndexAllEntities)(info[0]->Int32Value(context).ToChecked())));
 }
 
-static std::pair<std::string, v8::FunctionCallback> engineSpecificFunctions[] = {
+static utils::NativeFunction engineSpecificFunctions[] = {
   { "precacheModel", sf_eng_pfnPrecacheModel },
   { "precacheSound", sf_eng_pfnPrecacheSound },
   { "setModel", sf_eng_pfnSetModel },
   { "modelIndex", sf_eng_pfnModelIndex },
-  { "modelFrames", sf_eng_pfnModelFrames },
+  { "modelFrames", sf_eng_pfnModelFrames, &cf_eng_pfnModelFrames },
   { "setSize", sf_eng_pfnSetSize },
   { "changeLevel", sf_eng_pfnChangeLevel },
   { "getSpawnParms", sf_eng_pfnGetSpawnParms },
@@ -1853,10 +2011,10 @@ static std::pair<std::string, v8::FunctionCallback> engineSpecificFunctions[] =
   { "vecToYaw", sf_eng_pfnVecToYaw },
   { "vecToAngles", sf_eng_pfnVecToAngles },
   { "moveToOrigin", sf_eng_pfnMoveToOrigin },
-  { "changeYaw", sf_eng_pfnChangeYaw },
-  { "changePitch", sf_eng_pfnChangePitch },
+  { "changeYaw", sf_eng_pfnChangeYaw, &cf_eng_pfnChangeYaw },
+  { "changePitch", sf_eng_pfnChangePitch, &cf_eng_pfnChangePitch },
   { "findEntityByString", sf_eng_pfnFindEntityByString },
-  { "getEntityIllum", sf_eng_pfnGetEntityIllum },
+  { "getEntityIllum", sf_eng_pfnGetEntityIllum, &cf_eng_pfnGetEntityIllum },
   { "findEntityInSphere", sf_eng_pfnFindEntityInSphere },
   { "findClientInPVS", sf_eng_pfnFindClientInPVS },
   { "entitiesInPVS", sf_eng_pfnEntitiesInPVS },
@@ -1866,7 +2024,7 @@ static std::pair<std::string, v8::FunctionCallback> engineSpecificFunctions[] =
   { "removeEntity", sf_eng_pfnRemoveEntity },
   { "createNamedEntity", sf_eng_pfnCreateNamedEntity },
   { "makeStatic", sf_eng_pfnMakeStatic },
-  { "entIsOnFloor", sf_eng_pfnEntIsOnFloor },
+  { "entIsOnFloor", sf_eng_pfnEntIsOnFloor, &cf_eng_pfnEntIsOnFloor },
   { "dropToFloor", sf_eng_pfnDropToFloor },
   { "walkMove", sf_eng_pfnWalkMove },
   { "setOrigin", sf_eng_pfnSetOrigin },
@@ -1911,8 +2069,8 @@ static std::pair<std::string, v8::FunctionCallback> engineSpecificFunctions[] =
   { "allocString", sf_eng_pfnAllocString },
   { "getVarsOfEnt", sf_eng_pfnGetVarsOfEnt },
   { "pEntityOfEntOffset", sf_eng_pfnPEntityOfEntOffset },
-  { "entOffsetOfPEntity", sf_eng_pfnEntOffsetOfPEntity },
-  { "indexOfEdict", sf_eng_pfnIndexOfEdict },
+  { "entOffsetOfPEntity", sf_eng_pfnEntOffsetOfPEntity, &cf_eng_pfnEntOffsetOfPEntity },
+  { "indexOfEdict", sf_eng_pfnIndexOfEdict, &cf_eng_pfnIndexOfEdict },
   { "pEntityOfEntIndex", sf_eng_pfnPEntityOfEntIndex },
   { "findEntityByVars", sf_eng_pfnFindEntityByVars },
   { "getModelPtr", sf_eng_pfnGetModelPtr },
@@ -1925,12 +2083,12 @@ static std::pair<std::string, v8::FunctionCallback> engineSpecificFunctions[] =
   { "serverPrint", sf_eng_pfnServerPrint },
   { "cmdArgs", sf_eng_pfnCmd_Args },
   { "cmdArgv", sf_eng_pfnCmd_Argv },
-  { "cmdArgc", sf_eng_pfnCmd_Argc },
+  { "cmdArgc", sf_eng_pfnCmd_Argc, &cf_eng_pfnCmd_Argc },
   { "getAttachment", sf_eng_pfnGetAttachment },
-  { "randomLong", sf_eng_pfnRandomLong },
-  { "randomFloat", sf_eng_pfnRandomFloat },
+  { "randomLong", sf_eng_pfnRandomLong, &cf_eng_pfnRandomLong },
+  { "randomFloat", sf_eng_pfnRandomFloat, &cf_eng_pfnRandomFloat },
   { "setView", sf_eng_pfnSetView },
-  { "time", sf_eng_pfnTime },
+  { "time", sf_eng_pfnTime, &cf_eng_pfnTime },
   { "crosshairAngle", sf_eng_pfnCrosshairAngle },
   { "loadFileForMe", sf_eng_pfnLoadFileForMe },
   { "freeFile", sf_eng_pfnFreeFile },
@@ -1942,7 +2100,7 @@ static std::pair<std::string, v8::FunctionCallback> engineSpecificFunctions[] =
   { "setClientMaxspeed", sf_eng_pfnSetClientMaxspeed },
   { "createFakeClient", sf_eng_pfnCreateFakeClient },
   { "runPlayerMove", sf_eng_pfnRunPlayerMove },
-  { "numberOfEntities", sf_eng_pfnNumberOfEntities },
+  { "numberOfEntities", sf_eng_pfnNumberOfEntities, &cf_eng_pfnNumberOfEntities },
   { "getInfoKeyBuffer", sf_eng_pfnGetInfoKeyBuffer },
   { "infoKeyValue", sf_eng_pfnInfoKeyValue },
   { "setKeyValue", sf_eng_pfnSetKeyValue },
@@ -1950,11 +2108,11 @@ static std::pair<std::string, v8::FunctionCallback> engineSpecificFunctions[] =
   { "isMapValid", sf_eng_pfnIsMapValid },
   { "staticDecal", sf_eng_pfnStaticDecal },
   { "precacheGeneric", sf_eng_pfnPrecacheGeneric },
-  { "getPlayerUserId", sf_eng_pfnGetPlayerUserId },
+  { "getPlayerUserId", sf_eng_pfnGetPlayerUserId, &cf_eng_pfnGetPlayerUserId },
   { "buildSoundMsg", sf_eng_pfnBuildSoundMsg },
-  { "isDedicatedServer", sf_eng_pfnIsDedicatedServer },
+  { "isDedicatedServer", sf_eng_pfnIsDedicatedServer, &cf_eng_pfnIsDedicatedServer },
   { "cVarGetPointer", sf_eng_pfnCVarGetPointer },
-  { "getPlayerWONId", sf_eng_pfnGetPlayerWONId },
+  { "getPlayerWONId", sf_eng_pfnGetPlayerWONId, &cf_eng_pfnGetPlayerWONId },
   { "infoRemoveKey", sf_eng_pfnInfo_RemoveKey },
   { "getPhysicsKeyValue", sf_eng_pfnGetPhysicsKeyValue },
   { "setPhysicsKeyValue", sf_eng_pfnSetPhysicsKeyValue },
@@ -1967,8 +2125,8 @@ static std::pair<std::string, v8::FunctionCallback> engineSpecificFunctions[] =
   { "deltaSetField", sf_eng_pfnDeltaSetField },
   { "deltaUnsetField", sf_eng_pfnDeltaUnsetField },
   { "deltaAddEncoder", sf_eng_pfnDeltaAddEncoder },
-  { "getCurrentPlayer", sf_eng_pfnGetCurrentPlayer },
-  { "canSkipPlayer", sf_eng_pfnCanSkipPlayer },
+  { "getCurrentPlayer", sf_eng_pfnGetCurrentPlayer, &cf_eng_pfnGetCurrentPlayer },
+  { "canSkipPlayer", sf_eng_pfnCanSkipPlayer, &cf_eng_pfnCanSkipPlayer },
   { "deltaFindField", sf_eng_pfnDeltaFindField },
   { "deltaSetFieldByIndex", sf_eng_pfnDeltaSetFieldByIndex },
   { "deltaUnsetFieldByIndex", sf_eng_pfnDeltaUnsetFieldByIndex },
@@ -1978,17 +2136,17 @@ static std::pair<std::string, v8::FunctionCallback> engineSpecificFunctions[] =
   { "forceUnmodified", sf_eng_pfnForceUnmodified },
   { "getPlayerStats", sf_eng_pfnGetPlayerStats },
   { "addServerCommand", sf_eng_pfnAddServerCommand },
-  { "voiceGetClientListening", sf_eng_pfnVoice_GetClientListening },
+  { "voiceGetClientListening", sf_eng_pfnVoice_GetClientListening, &cf_eng_pfnVoice_GetClientListening },
   { "voiceSetClientListening", sf_eng_pfnVoice_SetClientListening },
   { "getPlayerAuthId", sf_eng_pfnGetPlayerAuthId },
   { "sequenceGet", sf_eng_pfnSequenceGet },
   { "sequencePickSentence", sf_eng_pfnSequencePickSentence },
   { "getFileSize", sf_eng_pfnGetFileSize },
   { "getApproxWavePlayLen", sf_eng_pfnGetApproxWavePlayLen },
-  { "isCareerMatch", sf_eng_pfnIsCareerMatch },
+  { "isCareerMatch", sf_eng_pfnIsCareerMatch, &cf_eng_pfnIsCareerMatch },
   { "getLocalizedStringLength", sf_eng_pfnGetLocalizedStringLength },
   { "registerTutorMessageShown", sf_eng_pfnRegisterTutorMessageShown },
-  { "getTimesTutorMessageShown", sf_eng_pfnGetTimesTutorMessageShown },
+  { "getTimesTutorMessageShown", sf_eng_pfnGetTimesTutorMessageShown, &cf_eng_pfnGetTimesTutorMessageShown },
   { "processTutorMessageDecayBuffer", sf_eng_pfnProcessTutorMessageDecayBuffer },
   { "constructTutorMessageDecayBuffer", sf_eng_pfnConstructTutorMessageDecayBuffer },
   { "resetTutorMessageDecayData", sf_eng_pfnResetTutorMessageDecayData },
@@ -2000,7 +2158,7 @@ static std::pair<std::string, v8::FunctionCallback> engineSpecificFunctions[] =
 v8::Local<v8::ObjectTemplate> registerEngineFunctions(v8::Isolate* isolate) {
   v8::Local <v8::ObjectTemplate> object = v8::ObjectTemplate::New(isolate);
   for (auto &routine : engineSpecificFunctions) {
-    object-> Set(v8::String::NewFromUtf8(isolate, routine.first.c_str(), v8::NewStringType::kNormal).ToLocalChecked(), v8::FunctionTemplate::New(isolate, routine.second));
+    object-> Set(v8::String::NewFromUtf8(isolate, routine.name.c_str(), v8::NewStringType::kNormal).ToLocalChecked(), v8::FunctionTemplate::New(isolate, routine.callback, v8::Local<v8::Value>(), v8::Local<v8::Signature>(), 0, v8::ConstructorBehavior::kAllow, v8::SideEffectType::kHasSideEffect, routine.fast));
   };
   
   return object;
@@ -0,0 +1,1277 @@
+// This file builded by: node scripts/buildEvents.js
+#pragma once
+
+enum class EventId : unsigned int
+{
+  dllGameInit,
+  dllSpawn,
+  dllThink,
+  dllUse,
+  dllTouch,
+  dllBlocked,
+  dllKeyValue,
+  dllSave,
+  dllRestore,
+  dllSetAbsBox,
+  dllSaveWriteFields,
+  dllSaveReadFields,
+  dllSaveGlobalState,
+  dllRestoreGlobalState,
+  dllResetGlobalState,
+  dllClientConnect,
+  dllClientDisconnect,
+  dllClientKill,
+  dllClientPutInServer,
+  dllClientCommand,
+  dllClientUserInfoChanged,
+  dllServerActivate,
+  dllServerDeactivate,
+  dllPlayerPreThink,
+  dllPlayerPostThink,
+  dllStartFrame,
+  dllParmsNewLevel,
+  dllParmsChangeLevel,
+  dllGetGameDescription,
+  dllPlayerCustomization,
+  dllSpectatorConnect,
+  dllSpectatorDisconnect,
+  dllSpectatorThink,
+  dllSysError,
+  dllPMMove,
+  dllPMInit,
+  dllPMFindTextureType,
+  dllSetupVisibility,
+  dllUpdateClientData,
+  dllAddToFullPack,
+  dllCreateBaseline,
+  dllRegisterEncoders,
+  dllGetWeaponData,
+  dllCmdStart,
+  dllCmdEnd,
+  dllConnectionlessPacket,
+  dllGetHullBounds,
+  dllCreateInstancedBaselines,
+  dllInconsistentFile,
+  dllAllowLagCompensation,
+  postDllGameInit,
+  postDllSpawn,
+  postDllThink,
+  postDllUse,
+  postDllTouch,
+  postDllBlocked,
+  postDllKeyValue,
+  postDllSave,
+  postDllRestore,
+  postDllSetAbsBox,
+  postDllSaveWriteFields,
+  postDllSaveReadFields,
+  postDllSaveGlobalState,
+  postDllRestoreGlobalState,
+  postDllResetGlobalState,
+  postDllClientConnect,
+  postDllClientDisconnect,
+  postDllClientKill,
+  postDllClientPutInServer,
+  postDllClientCommand,
+  postDllClientUserInfoChanged,
+  postDllServerActivate,
+  postDllServerDeactivate,
+  postDllPlayerPreThink,
+  postDllPlayerPostThink,
+  postDllStartFrame,
+  postDllParmsNewLevel,
+  postDllParmsChangeLevel,
+  postDllGetGameDescription,
+  postDllPlayerCustomization,
+  postDllSpectatorConnect,
+  postDllSpectatorDisconnect,
+  postDllSpectatorThink,
+  postDllSysError,
+  postDllPMMove,
+  postDllPMInit,
+  postDllPMFindTextureType,
+  postDllSetupVisibility,
+  postDllUpdateClientData,
+  postDllAddToFullPack,
+  postDllCreateBaseline,
+  postDllRegisterEncoders,
+  postDllGetWeaponData,
+  postDllCmdStart,
+  postDllCmdEnd,
+  postDllConnectionlessPacket,
+  postDllGetHullBounds,
+  postDllCreateInstancedBaselines,
+  postDllInconsistentFile,
+  postDllAllowLagCompensation,
+  engPrecacheModel,
+  engPrecacheSound,
+  engSetModel,
+  engModelIndex,
+  engModelFrames,
+  engSetSize,
+  engChangeLevel,
+  engGetSpawnParms,
+  engSaveSpawnParms,
+  engVecToYaw,
+  engVecToAngles,
+  engMoveToOrigin,
+  engChangeYaw,
+  engChangePitch,
+  engFindEntityByString,
+  engGetEntityIllum,
+  engFindEntityInSphere,
+  engFindClientInPVS,
+  engEntitiesInPVS,
+  engMakeVectors,
+  engAngleVectors,
+  engCreateEntity,
+  engRemoveEntity,
+  engCreateNamedEntity,
+  engMakeStatic,
+  engEntIsOnFloor,
+  engDropToFloor,
+  engWalkMove,
+  engSetOrigin,
+  engEmitSound,
+  engEmitAmbientSound,
+  engTraceLine,
+  engTraceToss,
+  engTraceMonsterHull,
+  engTraceHull,
+  engTraceModel,
+  engTraceTexture,
+  engTraceSphere,
+  engGetAimVector,
+  engServerCommand,
+  engServerExecute,
+  engClientCommand,
+  engParticleEffect,
+  engLightStyle,
+  engDecalIndex,
+  engPointContents,
+  engMessageBegin,
+  engMessageEnd,
+  engWriteByte,
+  engWriteChar,
+  engWriteShort,
+  engWriteLong,
+  engWriteAngle,
+  engWriteCoord,
+  engWriteString,
+  engWriteEntity,
+  engCVarRegister,
+  engCVarGetFloat,
+  engCVarGetString,
+  engCVarSetFloat,
+  engCVarSetString,
+  engAlertMessage,
+  engEngineFprintf,
+  engPvAllocEntPrivateData,
+  engPvEntPrivateData,
+  engFreeEntPrivateData,
+  engSzFromIndex,
+  engAllocString,
+  engGetVarsOfEnt,
+  engPEntityOfEntOffset,
+  engEntOffsetOfPEntity,
+  engIndexOfEdict,
+  engPEntityOfEntIndex,
+  engFindEntityByVars,
+  engGetModelPtr,
+  engRegUserMsg,
+  engAnimationAutomove,
+  engGetBonePosition,
+  engFunctionFromName,
+  engNameForFunction,
+  engClientPrintf,
+  engServerPrint,
+  engCmdArgs,
+  engCmdArgv,
+  engCmdArgc,
+  engGetAttachment,
+  engCRC32Init,
+  engCRC32ProcessBuffer,
+  engCRC32ProcessByte,
+  engCRC32Final,
+  engRandomLong,
+  engRandomFloat,
+  engSetView,
+  engTime,
+  engCrosshairAngle,
+  engLoadFileForMe,
+  engFreeFile,
+  engEndSection,
+  engCompareFileTime,
+  engGetGameDir,
+  engCvarRegisterVariable,
+  engFadeClientVolume,
+  engSetClientMaxspeed,
+  engCreateFakeClient,
+  engRunPlayerMove,
+  engNumberOfEntities,
+  engGetInfoKeyBuffer,
+  engInfoKeyValue,
+  engSetKeyValue,
+  engSetClientKeyValue,
+  engIsMapValid,
+  engStaticDecal,
+  engPrecacheGeneric,
+  engGetPlayerUserId,
+  engBuildSoundMsg,
+  engIsDedicatedServer,
+  engCVarGetPointer,
+  engGetPlayerWONId,
+  engInfoRemoveKey,
+  engGetPhysicsKeyValue,
+  engSetPhysicsKeyValue,
+  engGetPhysicsInfoString,
+  engPrecacheEvent,
+  engPlaybackEvent,
+  engSetFatPVS,
+  engSetFatPAS,
+  engCheckVisibility,
+  engDeltaSetField,
+  engDeltaUnsetField,
+  engDeltaAddEncoder,
+  engGetCurrentPlayer,
+  engCanSkipPlayer,
+  engDeltaFindField,
+  engDeltaSetFieldByIndex,
+  engDeltaUnsetFieldByIndex,
+  engSetGroupMask,
+  engCreateInstancedBaseline,
+  engCvarDirectSet,
+  engForceUnmodified,
+  engGetPlayerStats,
+  engAddServerCommand,
+  engVoiceGetClientListening,
+  engVoiceSetClientListening,
+  engGetPlayerAuthId,
+  engSequenceGet,
+  engSequencePickSentence,
+  engGetFileSize,
+  engGetApproxWavePlayLen,
+  engIsCareerMatch,
+  engGetLocalizedStringLength,
+  engRegisterTutorMessageShown,
+  engGetTimesTutorMessageShown,
+  engProcessTutorMessageDecayBuffer,
+  engConstructTutorMessageDecayBuffer,
+  engResetTutorMessageDecayData,
+  engQueryClientCvarValue,
+  engQueryClientCvarValue2,
+  engCheckParm,
+  engPEntityOfEntIndexAllEntities,
+  postEngPrecacheModel,
+  postEngPrecacheSound,
+  postEngSetModel,
+  postEngModelIndex,
+  postEngModelFrames,
+  postEngSetSize,
+  postEngChangeLevel,
+  postEngGetSpawnParms,
+  postEngSaveSpawnParms,
+  postEngVecToYaw,
+  postEngVecToAngles,
+  postEngMoveToOrigin,
+  postEngChangeYaw,
+  postEngChangePitch,
+  postEngFindEntityByString,
+  postEngGetEntityIllum,
+  postEngFindEntityInSphere,
+  postEngFindClientInPVS,
+  postEngEntitiesInPVS,
+  postEngMakeVectors,
+  postEngAngleVectors,
+  postEngCreateEntity,
+  postEngRemoveEntity,
+  postEngCreateNamedEntity,
+  postEngMakeStatic,
+  postEngEntIsOnFloor,
+  postEngDropToFloor,
+  postEngWalkMove,
+  postEngSetOrigin,
+  postEngEmitSound,
+  postEngEmitAmbientSound,
+  postEngTraceLine,
+  postEngTraceToss,
+  postEngTraceMonsterHull,
+  postEngTraceHull,
+  postEngTraceModel,
+  postEngTraceTexture,
+  postEngTraceSphere,
+  postEngGetAimVector,
+  postEngServerCommand,
+  postEngServerExecute,
+  postEngClientCommand,
+  postEngParticleEffect,
+  postEngLightStyle,
+  postEngDecalIndex,
+  postEngPointContents,
+  postEngMessageBegin,
+  postEngMessageEnd,
+  postEngWriteByte,
+  postEngWriteChar,
+  postEngWriteShort,
+  postEngWriteLong,
+  postEngWriteAngle,
+  postEngWriteCoord,
+  postEngWriteString,
+  postEngWriteEntity,
+  postEngCVarRegister,
+  postEngCVarGetFloat,
+  postEngCVarGetString,
+  postEngCVarSetFloat,
+  postEngCVarSetString,
+  postEngAlertMessage,
+  postEngEngineFprintf,
+  postEngPvAllocEntPrivateData,
+  postEngPvEntPrivateData,
+  postEngFreeEntPrivateData,
+  postEngSzFromIndex,
+  postEngAllocString,
+  postEngGetVarsOfEnt,
+  postEngPEntityOfEntOffset,
+  postEngEntOffsetOfPEntity,
+  postEngIndexOfEdict,
+  postEngPEntityOfEntIndex,
+  postEngFindEntityByVars,
+  postEngGetModelPtr,
+  postEngRegUserMsg,
+  postEngAnimationAutomove,
+  postEngGetBonePosition,
+  postEngFunctionFromName,
+  postEngNameForFunction,
+  postEngClientPrintf,
+  postEngServerPrint,
+  postEngCmdArgs,
+  postEngCmdArgv,
+  postEngCmdArgc,
+  postEngGetAttachment,
+  postEngCRC32Init,
+  postEngCRC32ProcessBuffer,
+  postEngCRC32ProcessByte,
+  postEngCRC32Final,
+  postEngRandomLong,
+  postEngRandomFloat,
+  postEngSetView,
+  postEngTime,
+  postEngCrosshairAngle,
+  postEngLoadFileForMe,
+  postEngFreeFile,
+  postEngEndSection,
+  postEngCompareFileTime,
+  postEngGetGameDir,
+  postEngCvarRegisterVariable,
+  postEngFadeClientVolume,
+  postEngSetClientMaxspeed,
+  postEngCreateFakeClient,
+  postEngRunPlayerMove,
+  postEngNumberOfEntities,
+  postEngGetInfoKeyBuffer,
+  postEngInfoKeyValue,
+  postEngSetKeyValue,
+  postEngSetClientKeyValue,
+  postEngIsMapValid,
+  postEngStaticDecal,
+  postEngPrecacheGeneric,
+  postEngGetPlayerUserId,
+  postEngBuildSoundMsg,
+  postEngIsDedicatedServer,
+  postEngCVarGetPointer,
+  postEngGetPlayerWONId,
+  postEngInfoRemoveKey,
+  postEngGetPhysicsKeyValue,
+  postEngSetPhysicsKeyValue,
+  postEngGetPhysicsInfoString,
+  postEngPrecacheEvent,
+  postEngPlaybackEvent,
+  postEngSetFatPVS,
+  postEngSetFatPAS,
+  postEngCheckVisibility,
+  postEngDeltaSetField,
+  postEngDeltaUnsetField,
+  postEngDeltaAddEncoder,
+  postEngGetCurrentPlayer,
+  postEngCanSkipPlayer,
+  postEngDeltaFindField,
+  postEngDeltaSetFieldByIndex,
+  postEngDeltaUnsetFieldByIndex,
+  postEngSetGroupMask,
+  postEngCreateInstancedBaseline,
+  postEngCvarDirectSet,
+  postEngForceUnmodified,
+  postEngGetPlayerStats,
+  postEngAddServerCommand,
+  postEngVoiceGetClientListening,
+  postEngVoiceSetClientListening,
+  postEngGetPlayerAuthId,
+  postEngSequenceGet,
+  postEngSequencePickSentence,
+  postEngGetFileSize,
+  postEngGetApproxWavePlayLen,
+  postEngIsCareerMatch,
+  postEngGetLocalizedStringLength,
+  postEngRegisterTutorMessageShown,
+  postEngGetTimesTutorMessageShown,
+  postEngProcessTutorMessageDecayBuffer,
+  postEngConstructTutorMessageDecayBuffer,
+  postEngResetTutorMessageDecayData,
+  postEngQueryClientCvarValue,
+  postEngQueryClientCvarValue2,
+  postEngCheckParm,
+  postEngPEntityOfEntIndexAllEntities,
+  engMessage,
+  cvarChanged,
+  Count
+};
+
+// Ids below this are engine/DLL table slots, the rest are fired by nodemod itself
+inline constexpr unsigned int eventTableCount = 418;
+
+inline constexpr const char* eventIdNames[] = {
+  "dllGameInit",
+  "dllSpawn",
+  "dllThink",
+  "dllUse",
+  "dllTouch",
+  "dllBlocked",
+  "dllKeyValue",
+  "dllSave",
+  "dllRestore",
+  "dllSetAbsBox",
+  "dllSaveWriteFields",
+  "dllSaveReadFields",
+  "dllSaveGlobalState",
+  "dllRestoreGlobalState",
+  "dllResetGlobalState",
+  "dllClientConnect",
+  "dllClientDisconnect",
+  "dllClientKill",
+  "dllClientPutInServer",
+  "dllClientCommand",
+  "dllClientUserInfoChanged",
+  "dllServerActivate",
+  "dllServerDeactivate",
+  "dllPlayerPreThink",
+  "dllPlayerPostThink",
+  "dllStartFrame",
+  "dllParmsNewLevel",
+  "dllParmsChangeLevel",
+  "dllGetGameDescription",
+  "dllPlayerCustomization",
+  "dllSpectatorConnect",
+  "dllSpectatorDisconnect",
+  "dllSpectatorThink",
+  "dllSysError",
+  "dllPMMove",
+  "dllPMInit",
+  "dllPMFindTextureType",
+  "dllSetupVisibility",
+  "dllUpdateClientData",
+  "dllAddToFullPack",
+  "dllCreateBaseline",
+  "dllRegisterEncoders",
+  "dllGetWeaponData",
+  "dllCmdStart",
+  "dllCmdEnd",
+  "dllConnectionlessPacket",
+  "dllGetHullBounds",
+  "dllCreateInstancedBaselines",
+  "dllInconsistentFile",
+  "dllAllowLagCompensation",
+  "postDllGameInit",
+  "postDllSpawn",
+  "postDllThink",
+  "postDllUse",
+  "postDllTouch",
+  "postDllBlocked",
+  "postDllKeyValue",
+  "postDllSave",
+  "postDllRestore",
+  "postDllSetAbsBox",
+  "postDllSaveWriteFields",
+  "postDllSaveReadFields",
+  "postDllSaveGlobalState",
+  "postDllRestoreGlobalState",
+  "postDllResetGlobalState",
+  "postDllClientConnect",
+  "postDllClientDisconnect",
+  "postDllClientKill",
+  "postDllClientPutInServer",
+  "postDllClientCommand",
+  "postDllClientUserInfoChanged",
+  "postDllServerActivate",
+  "postDllServerDeactivate",
+  "postDllPlayerPreThink",
+  "postDllPlayerPostThink",
+  "postDllStartFrame",
+  "postDllParmsNewLevel",
+  "postDllParmsChangeLevel",
+  "postDllGetGameDescription",
+  "postDllPlayerCustomization",
+  "postDllSpectatorConnect",
+  "postDllSpectatorDisconnect",
+  "postDllSpectatorThink",
+  "postDllSysError",
+  "postDllPMMove",
+  "postDllPMInit",
+  "postDllPMFindTextureType",
+  "postDllSetupVisibility",
+  "postDllUpdateClientData",
+  "postDllAddToFullPack",
+  "postDllCreateBaseline",
+  "postDllRegisterEncoders",
+  "postDllGetWeaponData",
+  "postDllCmdStart",
+  "postDllCmdEnd",
+  "postDllConnectionlessPacket",
+  "postDllGetHullBounds",
+  "postDllCreateInstancedBaselines",
+  "postDllInconsistentFile",
+  "postDllAllowLagCompensation",
+  "engPrecacheModel",
+  "engPrecacheSound",
+  "engSetModel",
+  "engModelIndex",
+  "engModelFrames",
+  "engSetSize",
+  "engChangeLevel",
+  "engGetSpawnParms",
+  "engSaveSpawnParms",
+  "engVecToYaw",
+  "engVecToAngles",
+  "engMoveToOrigin",
+  "engChangeYaw",
+  "engChangePitch",
+  "engFindEntityByString",
+  "engGetEntityIllum",
+  "engFindEntityInSphere",
+  "engFindClientInPVS",
+  "engEntitiesInPVS",
+  "engMakeVectors",
+  "engAngleVectors",
+  "engCreateEntity",
+  "engRemoveEntity",
+  "engCreateNamedEntity",
+  "engMakeStatic",
+  "engEntIsOnFloor",
+  "engDropToFloor",
+  "engWalkMove",
+  "engSetOrigin",
+  "engEmitSound",
+  "engEmitAmbientSound",
+  "engTraceLine",
+  "engTraceToss",
+  "engTraceMonsterHull",
+  "engTraceHull",
+  "engTraceModel",
+  "engTraceTexture",
+  "engTraceSphere",
+  "engGetAimVector",
+  "engServerCommand",
+  "engServerExecute",
+  "engClientCommand",
+  "engParticleEffect",
+  "engLightStyle",
+  "engDecalIndex",
+  "engPointContents",
+  "engMessageBegin",
+  "engMessageEnd",
+  "engWriteByte",
+  "engWriteChar",
+  "engWriteShort",
+  "engWriteLong",
+  "engWriteAngle",
+  "engWriteCoord",
+  "engWriteString",
+  "engWriteEntity",
+  "engCVarRegister",
+  "engCVarGetFloat",
+  "engCVarGetString",
+  "engCVarSetFloat",
+  "engCVarSetString",
+  "engAlertMessage",
+  "engEngineFprintf",
+  "engPvAllocEntPrivateData",
+  "engPvEntPrivateData",
+  "engFreeEntPrivateData",
+  "engSzFromIndex",
+  "engAllocString",
+  "engGetVarsOfEnt",
+  "engPEntityOfEntOffset",
+  "engEntOffsetOfPEntity",
+  "engIndexOfEdict",
+  "engPEntityOfEntIndex",
+  "engFindEntityByVars",
+  "engGetModelPtr",
+  "engRegUserMsg",
+  "engAnimationAutomove",
+  "engGetBonePosition",
+  "engFunctionFromName",
+  "engNameForFunction",
+  "engClientPrintf",
+  "engServerPrint",
+  "engCmdArgs",
+  "engCmdArgv",
+  "engCmdArgc",
+  "engGetAttachment",
+  "engCRC32Init",
+  "engCRC32ProcessBuffer",
+  "engCRC32ProcessByte",
+  "engCRC32Final",
+  "engRandomLong",
+  "engRandomFloat",
+  "engSetView",
+  "engTime",
+  "engCrosshairAngle",
+  "engLoadFileForMe",
+  "engFreeFile",
+  "engEndSection",
+  "engCompareFileTime",
+  "engGetGameDir",
+  "engCvarRegisterVariable",
+  "engFadeClientVolume",
+  "engSetClientMaxspeed",
+  "engCreateFakeClient",
+  "engRunPlayerMove",
+  "engNumberOfEntities",
+  "engGetInfoKeyBuffer",
+  "engInfoKeyValue",
+  "engSetKeyValue",
+  "engSetClientKeyValue",
+  "engIsMapValid",
+  "engStaticDecal",
+  "engPrecacheGeneric",
+  "engGetPlayerUserId",
+  "engBuildSoundMsg",
+  "engIsDedicatedServer",
+  "engCVarGetPointer",
+  "engGetPlayerWONId",
+  "engInfoRemoveKey",
+  "engGetPhysicsKeyValue",
+  "engSetPhysicsKeyValue",
+  "engGetPhysicsInfoString",
+  "engPrecacheEvent",
+  "engPlaybackEvent",
+  "engSetFatPVS",
+  "engSetFatPAS",
+  "engCheckVisibility",
+  "engDeltaSetField",
+  "engDeltaUnsetField",
+  "engDeltaAddEncoder",
+  "engGetCurrentPlayer",
+  "engCanSkipPlayer",
+  "engDeltaFindField",
+  "engDeltaSetFieldByIndex",
+  "engDeltaUnsetFieldByIndex",
+  "engSetGroupMask",
+  "engCreateInstancedBaseline",
+  "engCvarDirectSet",
+  "engForceUnmodified",
+  "engGetPlayerStats",
+  "engAddServerCommand",
+  "engVoiceGetClientListening",
+  "engVoiceSetClientListening",
+  "engGetPlayerAuthId",
+  "engSequenceGet",
+  "engSequencePickSentence",
+  "engGetFileSize",
+  "engGetApproxWavePlayLen",
+  "engIsCareerMatch",
+  "engGetLocalizedStringLength",
+  "engRegisterTutorMessageShown",
+  "engGetTimesTutorMessageShown",
+  "engProcessTutorMessageDecayBuffer",
+  "engConstructTutorMessageDecayBuffer",
+  "engResetTutorMessageDecayData",
+  "engQueryClientCvarValue",
+  "engQueryClientCvarValue2",
+  "engCheckParm",
+  "engPEntityOfEntIndexAllEntities",
+  "postEngPrecacheModel",
+  "postEngPrecacheSound",
+  "postEngSetModel",
+  "postEngModelIndex",
+  "postEngModelFrames",
+  "postEngSetSize",
+  "postEngChangeLevel",
+  "postEngGetSpawnParms",
+  "postEngSaveSpawnParms",
+  "postEngVecToYaw",
+  "postEngVecToAngles",
+  "postEngMoveToOrigin",
+  "postEngChangeYaw",
+  "postEngChangePitch",
+  "postEngFindEntityByString",
+  "postEngGetEntityIllum",
+  "postEngFindEntityInSphere",
+  "postEngFindClientInPVS",
+  "postEngEntitiesInPVS",
+  "postEngMakeVectors",
+  "postEngAngleVectors",
+  "postEngCreateEntity",
+  "postEngRemoveEntity",
+  "postEngCreateNamedEntity",
+  "postEngMakeStatic",
+  "postEngEntIsOnFloor",
+  "postEngDropToFloor",
+  "postEngWalkMove",
+  "postEngSetOrigin",
+  "postEngEmitSound",
+  "postEngEmitAmbientSound",
+  "postEngTraceLine",
+  "postEngTraceToss",
+  "postEngTraceMonsterHull",
+  "postEngTraceHull",
+  "postEngTraceModel",
+  "postEngTraceTexture",
+  "postEngTraceSphere",
+  "postEngGetAimVector",
+  "postEngServerCommand",
+  "postEngServerExecute",
+  "postEngClientCommand",
+  "postEngParticleEffect",
+  "postEngLightStyle",
+  "postEngDecalIndex",
+  "postEngPointContents",
+  "postEngMessageBegin",
+  "postEngMessageEnd",
+  "postEngWriteByte",
+  "postEngWriteChar",
+  "postEngWriteShort",
+  "postEngWriteLong",
+  "postEngWriteAngle",
+  "postEngWriteCoord",
+  "postEngWriteString",
+  "postEngWriteEntity",
+  "postEngCVarRegister",
+  "postEngCVarGetFloat",
+  "postEngCVarGetString",
+  "postEngCVarSetFloat",
+  "postEngCVarSetString",
+  "postEngAlertMessage",
+  "postEngEngineFprintf",
+  "postEngPvAllocEntPrivateData",
+  "postEngPvEntPrivateData",
+  "postEngFreeEntPrivateData",
+  "postEngSzFromIndex",
+  "postEngAllocString",
+  "postEngGetVarsOfEnt",
+  "postEngPEntityOfEntOffset",
+  "postEngEntOffsetOfPEntity",
+  "postEngIndexOfEdict",
+  "postEngPEntityOfEntIndex",
+  "postEngFindEntityByVars",
+  "postEngGetModelPtr",
+  "postEngRegUserMsg",
+  "postEngAnimationAutomove",
+  "postEngGetBonePosition",
+  "postEngFunctionFromName",
+  "postEngNameForFunction",
+  "postEngClientPrintf",
+  "postEngServerPrint",
+  "postEngCmdArgs",
+  "postEngCmdArgv",
+  "postEngCmdArgc",
+  "postEngGetAttachment",
+  "postEngCRC32Init",
+  "postEngCRC32ProcessBuffer",
+  "postEngCRC32ProcessByte",
+  "postEngCRC32Final",
+  "postEngRandomLong",
+  "postEngRandomFloat",
+  "postEngSetView",
+  "postEngTime",
+  "postEngCrosshairAngle",
+  "postEngLoadFileForMe",
+  "postEngFreeFile",
+  "postEngEndSection",
+  "postEngCompareFileTime",
+  "postEngGetGameDir",
+  "postEngCvarRegisterVariable",
+  "postEngFadeClientVolume",
+  "postEngSetClientMaxspeed",
+  "postEngCreateFakeClient",
+  "postEngRunPlayerMove",
+  "postEngNumberOfEntities",
+  "postEngGetInfoKeyBuffer",
+  "postEngInfoKeyValue",
+  "postEngSetKeyValue",
+  "postEngSetClientKeyValue",
+  "postEngIsMapValid",
+  "postEngStaticDecal",
+  "postEngPrecacheGeneric",
+  "postEngGetPlayerUserId",
+  "postEngBuildSoundMsg",
+  "postEngIsDedicatedServer",
+  "postEngCVarGetPointer",
+  "postEngGetPlayerWONId",
+  "postEngInfoRemoveKey",
+  "postEngGetPhysicsKeyValue",
+  "postEngSetPhysicsKeyValue",
+  "postEngGetPhysicsInfoString",
+  "postEngPrecacheEvent",
+  "postEngPlaybackEvent",
+  "postEngSetFatPVS",
+  "postEngSetFatPAS",
+  "postEngCheckVisibility",
+  "postEngDeltaSetField",
+  "postEngDeltaUnsetField",
+  "postEngDeltaAddEncoder",
+  "postEngGetCurrentPlayer",
+  "postEngCanSkipPlayer",
+  "postEngDeltaFindField",
+  "postEngDeltaSetFieldByIndex",
+  "postEngDeltaUnsetFieldByIndex",
+  "postEngSetGroupMask",
+  "postEngCreateInstancedBaseline",
+  "postEngCvarDirectSet",
+  "postEngForceUnmodified",
+  "postEngGetPlayerStats",
+  "postEngAddServerCommand",
+  "postEngVoiceGetClientListening",
+  "postEngVoiceSetClientListening",
+  "postEngGetPlayerAuthId",
+  "postEngSequenceGet",
+  "postEngSequencePickSentence",
+  "postEngGetFileSize",
+  "postEngGetApproxWavePlayLen",
+  "postEngIsCareerMatch",
+  "postEngGetLocalizedStringLength",
+  "postEngRegisterTutorMessageShown",
+  "postEngGetTimesTutorMessageShown",
+  "postEngProcessTutorMessageDecayBuffer",
+  "postEngConstructTutorMessageDecayBuffer",
+  "postEngResetTutorMessageDecayData",
+  "postEngQueryClientCvarValue",
+  "postEngQueryClientCvarValue2",
+  "postEngCheckParm",
+  "postEngPEntityOfEntIndexAllEntities",
+  "engMessage",
+  "cvarChanged"
+};
+
+// Events whose hooks feed nodemod.onBatched
+inline constexpr bool eventBatchable[] = {
+  false,
+  false,
+  true,
+  true,
+  true,
+  true,
+  false,
+  false,
+  false,
+  true,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  true,
+  true,
+  true,
+  true,
+  true,
+  true,
+  false,
+  true,
+  true,
+  false,
+  false,
+  false,
+  false,
+  false,
+  true,
+  true,
+  true,
+  true,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  true,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  true,
+  true,
+  true,
+  true,
+  false,
+  false,
+  false,
+  true,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  true,
+  true,
+  true,
+  true,
+  true,
+  true,
+  false,
+  true,
+  true,
+  false,
+  false,
+  false,
+  false,
+  false,
+  true,
+  true,
+  true,
+  true,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  true,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  true,
+  false,
+  false,
+  true,
+  true,
+  true,
+  true,
+  false,
+  false,
+  true,
+  true,
+  true,
+  false,
+  false,
+  false,
+  false,
+  false,
+  true,
+  false,
+  false,
+  true,
+  false,
+  true,
+  false,
+  false,
+  false,
+  true,
+  true,
+  true,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  true,
+  false,
+  false,
+  true,
+  true,
+  false,
+  false,
+  true,
+  false,
+  true,
+  true,
+  true,
+  true,
+  true,
+  true,
+  true,
+  true,
+  false,
+  false,
+  false,
+  true,
+  true,
+  false,
+  false,
+  false,
+  false,
+  true,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  true,
+  false,
+  false,
+  false,
+  true,
+  true,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  true,
+  false,
+  true,
+  false,
+  false,
+  true,
+  false,
+  true,
+  false,
+  true,
+  true,
+  false,
+  true,
+  false,
+  false,
+  false,
+  true,
+  true,
+  false,
+  true,
+  false,
+  false,
+  true,
+  false,
+  false,
+  false,
+  true,
+  false,
+  true,
+  false,
+  false,
+  true,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  true,
+  false,
+  false,
+  true,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  true,
+  false,
+  false,
+  false,
+  false,
+  true,
+  true,
+  false,
+  false,
+  false,
+  false,
+  true,
+  false,
+  false,
+  true,
+  true,
+  true,
+  true,
+  false,
+  false,
+  true,
+  true,
+  true,
+  false,
+  false,
+  false,
+  false,
+  false,
+  true,
+  false,
+  false,
+  true,
+  false,
+  true,
+  false,
+  false,
+  false,
+  true,
+  true,
+  true,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  true,
+  false,
+  false,
+  true,
+  true,
+  false,
+  false,
+  true,
+  false,
+  true,
+  true,
+  true,
+  true,
+  true,
+  true,
+  true,
+  true,
+  false,
+  false,
+  false,
+  true,
+  true,
+  false,
+  false,
+  false,
+  false,
+  true,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  true,
+  false,
+  false,
+  false,
+  true,
+  true,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  true,
+  false,
+  true,
+  false,
+  false,
+  true,
+  false,
+  true,
+  false,
+  true,
+  true,
+  false,
+  true,
+  false,
+  false,
+  false,
+  true,
+  true,
+  false,
+  true,
+  false,
+  false,
+  true,
+  false,
+  false,
+  false,
+  true,
+  false,
+  true,
+  false,
+  false,
+  true,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  true,
+  false,
+  false,
+  true,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  false,
+  true,
+  false,
+  false,
+  false,
+  false,
+  true,
+  true,
+  false,
+  false,
+  false,
+  false
+};
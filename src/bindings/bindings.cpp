@@ -1,7 +1,12 @@
 #include "bindings.hpp"
 #include "util/convert.hpp"
+#include "node/utils.hpp"
 #include "structures/structures.hpp"
 #include "ham/ham_bindings.h"
+#include "node/snapshot.hpp"
+#include "node/spatial.hpp"
+#include "node/commandbuffer.hpp"
+#include "node/traces.hpp"
 #include <v8.h>
 #include <string>
 #include <vector>
@@ -24,7 +29,7 @@ namespace bindings
 {
   void init(v8::Isolate *isolate, v8::Local<v8::ObjectTemplate> &global)
   {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     v8::Local<v8::ObjectTemplate> nodemodObject = v8::ObjectTemplate::New(isolate);
 
     // add base functions
@@ -35,10 +40,21 @@ namespace bindings
           v8::FunctionTemplate::New(isolate, routine.second));
     }
 
-    // add engine functions
+    // add engine functions, plus the batched calls that run many of them at once
+    v8::Local<v8::ObjectTemplate> engineObject = registerEngineFunctions(isolate);
+    engineObject->Set(
+        convert::str2js(isolate, "batch"),
+        v8::FunctionTemplate::New(isolate, commandbuffer::run));
+    engineObject->Set(
+        convert::str2js(isolate, "traceLines"),
+        v8::FunctionTemplate::New(isolate, traces::lines));
+    engineObject->Set(
+        convert::str2js(isolate, "traceHulls"),
+        v8::FunctionTemplate::New(isolate, traces::hulls));
+
     nodemodObject->Set(
         convert::str2js(isolate, "eng"),
-        registerEngineFunctions(isolate));
+        engineObject);
 
     // add dll functions
     nodemodObject->Set(
@@ -50,6 +66,11 @@ namespace bindings
         convert::str2js(isolate, "ham"),
         Ham::createHamBindings(isolate));
 
+    // add spatial queries
+    nodemodObject->Set(
+        convert::str2js(isolate, "spatial"),
+        spatial::createBindings(isolate));
+
     auto cwd = std::filesystem::current_path();
 
     nodemodObject->Set(
@@ -62,7 +83,7 @@ namespace bindings
         [](v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value> &info)
         {
           v8::Isolate* isolate = info.GetIsolate();
-          v8::Locker locker(isolate);
+          V8_ASSERT_LOCKED(isolate);
           v8::HandleScope scope(isolate);
 
           char gameDir[256];
@@ -73,12 +94,16 @@ namespace bindings
         convert::str2js(isolate, "players"),
         players::getPlayers);
 
+    nodemodObject->SetNativeDataProperty(
+        convert::str2js(isolate, "snapshot"),
+        snapshot::get);
+
     nodemodObject->SetNativeDataProperty(
         convert::str2js(isolate, "mapname"),
         [](v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value> &info)
         {
           v8::Isolate* isolate = info.GetIsolate();
-          v8::Locker locker(isolate);
+          V8_ASSERT_LOCKED(isolate);
           v8::HandleScope scope(isolate);
 
           info.GetReturnValue().Set(convert::strid2js(isolate, gpGlobals->mapname));
@@ -89,7 +114,7 @@ namespace bindings
         [](v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value> &info)
         {
           v8::Isolate* isolate = info.GetIsolate();
-          v8::Locker locker(isolate);
+          V8_ASSERT_LOCKED(isolate);
           v8::HandleScope scope(isolate);
 
           info.GetReturnValue().Set(v8::Number::New(isolate, gpGlobals->time));
@@ -100,7 +125,7 @@ namespace bindings
         [](v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value> &info)
         {
           v8::Isolate* isolate = info.GetIsolate();
-          v8::Locker locker(isolate);
+          V8_ASSERT_LOCKED(isolate);
           v8::HandleScope scope(isolate);
 
           info.GetReturnValue().Set(v8::Number::New(isolate, gpGlobals->frametime));
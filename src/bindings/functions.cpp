@@ -3,6 +3,10 @@
 #include <vector>
 #include "v8.h"
 #include "node/events.hpp"
+#include "node/batch.hpp"
+#include "node/stats.hpp"
+#include "node/query.hpp"
+#include "node/cvars.hpp"
 
 extern void getUserMsgId(const v8::FunctionCallbackInfo<v8::Value>& info);
 extern void getUserMsgName(const v8::FunctionCallbackInfo<v8::Value>& info);
@@ -19,6 +23,11 @@ std::vector<std::pair<std::string, v8::FunctionCallback>> nodemodFunctions =
 	{ "removeListener", event::remove_listener },
 	{ "removeEventListener", event::remove_listener },
 	{ "fire", event::fire },
+	{ "onBatched", batch::onBatched },
+	{ "offBatched", batch::offBatched },
+	{ "stats", stats::get },
+	{ "query", query::run },
+	{ "cvar", cvars::get },
 	{ "getUserMsgId", getUserMsgId },
 	{ "getUserMsgName", getUserMsgName },
 	{ "setMetaResult", setMetaResult },
@@ -1,4 +1,5 @@
 #include "structures/structures.hpp"
+#include "node/utils.hpp"
 #include "extdll.h"
 #include <v8.h>
 #include <vector>
@@ -10,7 +11,7 @@ namespace players
 {
   void getPlayers(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& info) {
     auto isolate = info.GetIsolate();
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     v8::HandleScope scope(isolate);
     std::vector<edict_t*> ents;
 
@@ -676,6 +676,7 @@ Hook* HamManager::findOrCreateHook(HamType function, const char* entityClass, ed
     }
 
     auto hook = std::make_unique<Hook>(vtable, vtableIndex, callback, info->paramCount, entityClass);
+    hook->setFunctionName(info->name);
     Hook* hookPtr = hook.get();
     m_hooks[key] = std::move(hook);
 
@@ -742,6 +743,7 @@ int HamManager::registerHook(
         }
 
         auto newHook = std::make_unique<Hook>(vtable, vtableIndex, hookCallback, info->paramCount, entityClass);
+        newHook->setFunctionName(info->name);
         hook = newHook.get();
         m_hooks[key] = std::move(newHook);
     }
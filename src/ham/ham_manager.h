@@ -69,6 +69,8 @@ public:
 
     int getBaseOffset() const { return m_baseOffset; }
 
+    const std::map<std::string, std::unique_ptr<Hook>>& getHooks() const { return m_hooks; }
+
 private:
     HamManager() = default;
     ~HamManager();
@@ -3,6 +3,8 @@
 
 #include "ham_const.h"
 #include "trampoline.h"
+#include "../node/stats.hpp"
+#include "../node/trace.hpp"
 #include <v8.h>
 #include <vector>
 #include <string>
@@ -22,6 +24,10 @@ struct HamCallback {
     v8::Global<v8::Context> context;
     bool isPre;
     int id;
+    stats::Counter counter;
+    uint32_t traceName = 0;
+    // Budget overruns, see watchdog.hpp
+    unsigned int overruns = 0;
 };
 
 class Hook {
@@ -38,6 +44,11 @@ public:
     void** getVTable() const { return m_vtable; }
     int getEntry() const { return m_entry; }
     const std::string& getEntityName() const { return m_entityName; }
+    const char* getFunctionName() const { return m_functionName; }
+    void setFunctionName(const char* name) { m_functionName = name; }
+
+    stats::Counter& getCounter(bool isPre) { return isPre ? m_preCounter : m_postCounter; }
+    uint32_t& getTraceName(bool isPre) { return m_traceNames[isPre ? 0 : 1]; }
 
     std::vector<HamCallback>& getPreCallbacks() { return m_preCallbacks; }
     std::vector<HamCallback>& getPostCallbacks() { return m_postCallbacks; }
@@ -57,9 +68,13 @@ private:
     void* m_trampoline;
     size_t m_trampolineSize;
     std::string m_entityName;
+    const char* m_functionName = "";
 
     std::vector<HamCallback> m_preCallbacks;
     std::vector<HamCallback> m_postCallbacks;
+    stats::Counter m_preCounter;
+    stats::Counter m_postCounter;
+    uint32_t m_traceNames[2] = {};
 
     bool m_executing = false;
     bool m_pendingDelete = false;
@@ -3,6 +3,8 @@
 #include "ham_manager.h"
 #include "../structures/structures.hpp"
 #include "../node/utils.hpp"
+#include "../node/watchdog.hpp"
+#include "../common/logger.hpp"
 #include "extdll.h"
 #include <v8.h>
 #include <cstring>
@@ -49,17 +51,53 @@ static edict_t* getEdictFromThis(void* pthis) {
     return pev->pContainingEntity;
 }
 
+// Trace span names, interned on the first traced call
+static uint32_t hookTraceName(Hook* hook, bool isPre) {
+    uint32_t& traceName = hook->getTraceName(isPre);
+    if (!traceName && trace::active) {
+        traceName = trace::name(std::string("ham ") + hook->getEntityName() + " " + hook->getFunctionName() + (isPre ? "" : " post"));
+    }
+    return traceName;
+}
+
+static uint32_t callbackTraceName(v8::Isolate* isolate, HamCallback& cb) {
+    if (!cb.traceName) {
+        stats::FunctionInfo info = stats::describe(isolate, cb.callback.Get(isolate));
+        cb.traceName = trace::name(info.name + " " + info.script + ":" + std::to_string(info.line));
+    }
+    return cb.traceName;
+}
+
+// Logs a callback the watchdog terminated and clears the termination; after
+// nodemod_budget_strikes overruns the callback is dropped, like event listeners
+static void reportOverrun(Hook* hook, v8::Isolate* isolate, HamCallback& cb, v8::Local<v8::Function> func) {
+    stats::FunctionInfo info = stats::describe(isolate, func);
+    L_ERROR << "Ham callback " << info.name << " (" << info.script << ":" << info.line << ") for " << hook->getEntityName()
+        << " " << hook->getFunctionName() << " exceeded its time budget and was terminated\nstack:\n" << watchdog::stack();
+
+    unsigned int strikes = watchdog::strikes();
+    if (strikes && ++cb.overruns >= strikes) {
+        L_ERROR << "Ham callback " << info.name << " disabled after " << strikes << " overruns\n";
+        cb.callback.Reset();
+    }
+
+    isolate->CancelTerminateExecution();
+}
+
 // Base executeCallbacks - only passes this_ (entity)
 static void executeCallbacks(Hook* hook, void* pthis, bool isPre) {
     HamManager& mgr = HamManager::instance();
     v8::Isolate* isolate = mgr.getIsolate();
-    if (!isolate) return;
+    // Nothing runs inside a listener the watchdog is terminating
+    if (!isolate || watchdog::terminating()) return;
 
     v8::Locker locker(isolate);
     v8::Isolate::Scope isolateScope(isolate);
     v8::HandleScope handleScope(isolate);
 
     auto& callbacks = isPre ? hook->getPreCallbacks() : hook->getPostCallbacks();
+    stats::Timer timer(hook->getCounter(isPre));
+    trace::Scope traceScope(hookTraceName(hook, isPre), trace::Category::Ham);
 
     for (auto& cb : callbacks) {
         if (cb.callback.IsEmpty() || cb.context.IsEmpty()) continue;
@@ -76,7 +114,24 @@ static void executeCallbacks(Hook* hook, void* pthis, bool isPre) {
         };
 
         v8::TryCatch tryCatch(isolate);
+        uint64_t start = stats::now();
+        watchdog::enter(isolate);
         v8::MaybeLocal<v8::Value> result = func->Call(context, context->Global(), 1, argv);
+        bool overran = watchdog::leave();
+        uint64_t end = stats::now();
+        cb.counter.add(end - start);
+        if (trace::active) trace::record(callbackTraceName(isolate, cb), trace::Category::Ham, start, end);
+
+        if (!overran && watchdog::terminating()) {
+            // Terminated on behalf of an outer listener, let it unwind there
+            tryCatch.ReThrow();
+            break;
+        }
+
+        if (overran) {
+            reportOverrun(hook, isolate, cb, func);
+            continue;
+        }
 
         if (tryCatch.HasCaught()) {
             continue;
@@ -99,8 +154,11 @@ static void executeCallbacks(Hook* hook, void* pthis, bool isPre) {
 template<size_t N>
 static void executeCallbacksWithArgs(Hook* hook, void* pthis, bool isPre, v8::Isolate* isolate, v8::Local<v8::Value> (&extraArgs)[N]) {
     HamManager& mgr = HamManager::instance();
+    if (watchdog::terminating()) return;
 
     auto& callbacks = isPre ? hook->getPreCallbacks() : hook->getPostCallbacks();
+    stats::Timer timer(hook->getCounter(isPre));
+    trace::Scope traceScope(hookTraceName(hook, isPre), trace::Category::Ham);
 
     for (auto& cb : callbacks) {
         if (cb.callback.IsEmpty() || cb.context.IsEmpty()) continue;
@@ -119,7 +177,24 @@ static void executeCallbacksWithArgs(Hook* hook, void* pthis, bool isPre, v8::Is
         }
 
         v8::TryCatch tryCatch(isolate);
+        uint64_t start = stats::now();
+        watchdog::enter(isolate);
         v8::MaybeLocal<v8::Value> result = func->Call(context, context->Global(), 1 + N, argv);
+        bool overran = watchdog::leave();
+        uint64_t end = stats::now();
+        cb.counter.add(end - start);
+        if (trace::active) trace::record(callbackTraceName(isolate, cb), trace::Category::Ham, start, end);
+
+        if (!overran && watchdog::terminating()) {
+            // Terminated on behalf of an outer listener, let it unwind there
+            tryCatch.ReThrow();
+            break;
+        }
+
+        if (overran) {
+            reportOverrun(hook, isolate, cb, func);
+            continue;
+        }
 
         if (tryCatch.HasCaught()) {
             continue;
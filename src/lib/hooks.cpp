@@ -0,0 +1,127 @@
+#include <extdll.h>
+#include <meta_api.h>
+#include "lib/hooks.hpp"
+
+namespace hooks
+{
+	bool enabled[eventTableCount] = {};
+
+	// Hooks that do native work besides firing the event
+	static const EventId pinned[] = {
+		EventId::dllStartFrame,              // drives the uv loop
+		EventId::dllServerActivate,          // resets the entity wrapper cache
+		EventId::dllServerDeactivate,        // clears the string_t intern table
+		EventId::postDllPlayerCustomization, // stores customizations
+		EventId::postDllClientDisconnect     // clears them
+	};
+
+	// Native events are built from table hooks; a listener keeps these active
+	static const EventId messageHooks[] = {
+		EventId::engMessageBegin,
+		EventId::engMessageEnd,
+		EventId::engWriteByte,
+		EventId::engWriteChar,
+		EventId::engWriteShort,
+		EventId::engWriteLong,
+		EventId::engWriteAngle,
+		EventId::engWriteCoord,
+		EventId::engWriteString,
+		EventId::engWriteEntity
+	};
+
+	struct Dependency
+	{
+		EventId id;
+		const EventId* hooks;
+		unsigned int count;
+	};
+
+	static const Dependency dependencies[] = {
+		{ EventId::engMessage, messageHooks, sizeof(messageHooks) / sizeof(messageHooks[0]) }
+	};
+
+	static unsigned int refs[eventTableCount] = {};
+	static bool lazy = true;
+
+	static cvar_t cvarLazyHooks = { const_cast<char*>("nodemod_lazyhooks"), const_cast<char*>("1"), 0, 1.0f, nullptr };
+	// The registered cvar, read directly every frame instead of by name
+	static cvar_t* lazyCvar = &cvarLazyHooks;
+
+	static bool isPinned(unsigned int index)
+	{
+		for (EventId id : pinned)
+		{
+			if (static_cast<unsigned int>(id) == index) return true;
+		}
+		return false;
+	}
+
+	static void update(unsigned int index)
+	{
+		enabled[index] = !lazy || refs[index] > 0 || isPinned(index);
+	}
+
+	static const Dependency* findDependency(EventId id)
+	{
+		for (const Dependency& dependency : dependencies)
+		{
+			if (dependency.id == id) return &dependency;
+		}
+		return nullptr;
+	}
+
+	void acquire(EventId id)
+	{
+		if (id >= EventId::Count) return;
+
+		if (static_cast<unsigned int>(id) >= eventTableCount)
+		{
+			const Dependency* dependency = findDependency(id);
+			if (!dependency) return;
+			for (unsigned int i = 0; i < dependency->count; i++) acquire(dependency->hooks[i]);
+			return;
+		}
+
+		if (refs[static_cast<unsigned int>(id)]++ == 0) update(static_cast<unsigned int>(id));
+	}
+
+	void release(EventId id)
+	{
+		if (id >= EventId::Count) return;
+
+		if (static_cast<unsigned int>(id) >= eventTableCount)
+		{
+			const Dependency* dependency = findDependency(id);
+			if (!dependency) return;
+			for (unsigned int i = 0; i < dependency->count; i++) release(dependency->hooks[i]);
+			return;
+		}
+
+		unsigned int& count = refs[static_cast<unsigned int>(id)];
+		if (count == 0) return;
+		if (--count == 0) update(static_cast<unsigned int>(id));
+	}
+
+	void sync()
+	{
+		lazy = lazyCvar->value != 0.0f;
+		for (unsigned int index = 0; index < eventTableCount; index++)
+		{
+			update(index);
+		}
+	}
+
+	void frame()
+	{
+		// server.cfg runs after Meta_Attach, so changes are picked up here
+		if ((lazyCvar->value != 0.0f) != lazy) sync();
+	}
+
+	void registerCvars()
+	{
+		CVAR_REGISTER(&cvarLazyHooks);
+
+		// The engine may link a copy, use whatever it hands back
+		if (cvar_t* registered = CVAR_GET_POINTER(cvarLazyHooks.name)) lazyCvar = registered;
+	}
+}
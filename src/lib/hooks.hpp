@@ -0,0 +1,30 @@
+#pragma once
+#include "auto/event_ids.hpp"
+
+// Hook gating.
+//
+// Every hook stays in the tables handed to metamod: Metamod-R copies them
+// and builds its call chains when the plugin loads, so a slot changed later
+// is never seen. Instead each generated hook starts with active() and
+// returns straight away while nothing needs it. With lazy hooks on, a hook
+// is active while a JS listener exists, a native module holds a reference
+// from acquire(), or it is pinned for native work of its own.
+namespace hooks
+{
+	extern bool enabled[eventTableCount];
+
+	inline bool active(EventId id)
+	{
+		return enabled[static_cast<unsigned int>(id)];
+	}
+
+	void acquire(EventId id);
+	void release(EventId id);
+
+	// Re-read nodemod_lazyhooks and recompute every flag
+	void sync();
+	// Once per server frame: sync() when nodemod_lazyhooks changed
+	void frame();
+
+	void registerCvars();
+}
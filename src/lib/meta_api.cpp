@@ -3,6 +3,11 @@
 #include "node/nodeimpl.hpp"
 #include "v8.h"
 #include "node/utils.hpp"
+#include "node/arena.hpp"
+#include "lib/hooks.hpp"
+#include "node/stats.hpp"
+#include "node/trace.hpp"
+#include "node/watchdog.hpp"
 
 #define NODEMOD_VERSION "0.1.0"
 
@@ -45,6 +50,7 @@ META_FUNCTIONS gMetaFunctionTable =
 
 void nodemod_reload_cmd() {
 	g_engfuncs.pfnServerPrint("NodeMod: Manual reload command triggered\n");
+	hooks::sync();
 	if (nodeImpl.reload()) {
 		g_engfuncs.pfnServerPrint("NodeMod: JavaScript environment reloaded successfully!\n");
 	} else {
@@ -52,18 +58,33 @@ void nodemod_reload_cmd() {
 	}
 }
 
+void nodemod_stats_cmd() {
+	if (!strcmp(CMD_ARGV(1), "reset")) {
+		stats::reset();
+		g_engfuncs.pfnServerPrint("NodeMod: Event stats reset\n");
+		return;
+	}
+	stats::print();
+}
+
 C_DLLEXPORT int Meta_Attach(PLUG_LOADTIME now, META_FUNCTIONS *pFunctionTable, meta_globals_t *pMGlobals, gamedll_funcs_t *pGamedllFuncs)
 {
 	gpMetaGlobals = pMGlobals;
 	gpGamedllFuncs = pGamedllFuncs;
 
 	g_engfuncs.pfnServerPrint("\n################\n# Hello World i am NODEMOD! #\n################\n\n");
+	hooks::registerCvars();
+	hooks::sync();
+	watchdog::registerCvars();
 	nodeImpl.Initialize();
 	nodeImpl.loadScript();
+	watchdog::start();
 	
 	// Register the reload command
 	REG_SVR_COMMAND("nodemod_reload", nodemod_reload_cmd);
 	g_engfuncs.pfnServerPrint("NodeMod: Registered 'nodemod_reload' command\n");
+	REG_SVR_COMMAND("nodemod_stats", nodemod_stats_cmd);
+	REG_SVR_COMMAND("nodemod_trace", trace::command);
 
 	memcpy(pFunctionTable, &gMetaFunctionTable, sizeof(META_FUNCTIONS));
 	return TRUE;
@@ -72,22 +93,23 @@ C_DLLEXPORT int Meta_Attach(PLUG_LOADTIME now, META_FUNCTIONS *pFunctionTable, m
 C_DLLEXPORT int Meta_Detach(PLUG_LOADTIME now, PL_UNLOAD_REASON reason)
 {
 	g_engfuncs.pfnServerPrint("Stopping nodemod...\n");
+	watchdog::stop();
 	nodeImpl.Stop();
 	return TRUE;
 }
 
 void getUserMsgId(const v8::FunctionCallbackInfo<v8::Value>& info) {
-	v8::Locker locker(info.GetIsolate());
+	V8_ASSERT_LOCKED(info.GetIsolate());
 	v8::HandleScope scope(info.GetIsolate());
 	auto context = info.GetIsolate()->GetCurrentContext();
 
   info.GetReturnValue().Set(
-  v8::Number::New(info.GetIsolate(), GET_USER_MSG_ID(&Plugin_info, utils::js2string(info.GetIsolate(), info[0]), NULL))
+  v8::Number::New(info.GetIsolate(), GET_USER_MSG_ID(&Plugin_info, arena::frameString(info.GetIsolate(), info[0]), NULL))
 	);
 }
 
 void getUserMsgName(const v8::FunctionCallbackInfo<v8::Value>& info) {
-	v8::Locker locker(info.GetIsolate());
+	V8_ASSERT_LOCKED(info.GetIsolate());
 	v8::HandleScope scope(info.GetIsolate());
 	auto context = info.GetIsolate()->GetCurrentContext();
 
@@ -102,7 +124,7 @@ void getUserMsgName(const v8::FunctionCallbackInfo<v8::Value>& info) {
 }
 
 void setMetaResult(const v8::FunctionCallbackInfo<v8::Value>& info) {
-	v8::Locker locker(info.GetIsolate());
+	V8_ASSERT_LOCKED(info.GetIsolate());
 	v8::HandleScope scope(info.GetIsolate());
 	auto context = info.GetIsolate()->GetCurrentContext();
 
@@ -110,7 +132,7 @@ void setMetaResult(const v8::FunctionCallbackInfo<v8::Value>& info) {
 }
 
 void getMetaResult(const v8::FunctionCallbackInfo<v8::Value>& info) {
-	v8::Locker locker(info.GetIsolate());
+	V8_ASSERT_LOCKED(info.GetIsolate());
 	v8::HandleScope scope(info.GetIsolate());
 
 	info.GetReturnValue().Set(v8::Integer::New(info.GetIsolate(), (int)gpMetaGlobals->mres));
@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+#include "arena.hpp"
+
+namespace arena
+{
+	struct Chunk
+	{
+		std::unique_ptr<char[]> data;
+		size_t size;
+	};
+
+	static std::vector<Chunk> chunks;
+	static size_t chunk = 0;
+	static size_t used = 0;
+
+	// Lookups by string_view, no std::string is built for a hit
+	struct InternHash
+	{
+		using is_transparent = void;
+		size_t operator()(std::string_view text) const { return std::hash<std::string_view>{}(text); }
+	};
+
+	// Node based: the strings never move, so their c_str() can be handed out
+	static std::unordered_set<std::string, InternHash, std::equal_to<>> interned;
+
+	static char* allocate(size_t size)
+	{
+		while (chunk < chunks.size())
+		{
+			if (chunks[chunk].size - used >= size)
+			{
+				char* result = chunks[chunk].data.get() + used;
+				used += size;
+				return result;
+			}
+			chunk++;
+			used = 0;
+		}
+
+		size_t chunkBytes = size > chunkSize ? size : chunkSize;
+		chunks.push_back({ std::unique_ptr<char[]>(new char[chunkBytes]), chunkBytes });
+		chunk = chunks.size() - 1;
+		used = size;
+		return chunks[chunk].data.get();
+	}
+
+	// Hands back the tail of the last allocation
+	static void release(size_t size)
+	{
+		used -= size;
+	}
+
+	static bool toString(v8::Isolate* isolate, v8::Local<v8::Value> value, v8::Local<v8::String>& string)
+	{
+		if (value.IsEmpty() || value->IsNullOrUndefined()) return false;
+		return value->ToString(isolate->GetCurrentContext()).ToLocal(&string);
+	}
+
+	static char* copy(v8::Isolate* isolate, v8::Local<v8::String> string, size_t minimum)
+	{
+		int units = string->Length();
+
+		// Reserve the worst case of 3 bytes per UTF-16 unit and give back what was not written
+		if (units <= smallString)
+		{
+			size_t reserved = std::max(static_cast<size_t>(units) * 3 + 1, minimum);
+			char* result = allocate(reserved);
+			int written = string->WriteUtf8(isolate, result, static_cast<int>(reserved), nullptr, v8::String::NO_NULL_TERMINATION);
+			result[written] = '\0';
+			release(reserved - std::max(static_cast<size_t>(written) + 1, minimum));
+			return result;
+		}
+
+		size_t length = string->Utf8Length(isolate);
+		char* result = allocate(std::max(length + 1, minimum));
+		string->WriteUtf8(isolate, result, static_cast<int>(length + 1));
+		result[length] = '\0';
+		return result;
+	}
+
+	const char* frameString(v8::Isolate* isolate, v8::Local<v8::Value> value)
+	{
+		v8::HandleScope scope(isolate);
+		v8::Local<v8::String> string;
+		if (!toString(isolate, value, string)) return "";
+
+		return copy(isolate, string, 0);
+	}
+
+	char* frameBuffer(v8::Isolate* isolate, v8::Local<v8::Value> value, size_t minimum)
+	{
+		v8::HandleScope scope(isolate);
+		v8::Local<v8::String> string;
+		if (!toString(isolate, value, string))
+		{
+			char* result = allocate(minimum);
+			result[0] = '\0';
+			return result;
+		}
+
+		return copy(isolate, string, minimum);
+	}
+
+	const char* persistentString(v8::Isolate* isolate, v8::Local<v8::Value> value)
+	{
+		const char* text = frameString(isolate, value);
+		if (!*text) return "";
+
+		auto found = interned.find(std::string_view(text));
+		if (found == interned.end()) found = interned.emplace(text).first;
+
+		// The frame copy was the last allocation and is exactly this long
+		release(strlen(text) + 1);
+		return found->c_str();
+	}
+
+	void resetFrame()
+	{
+		chunk = 0;
+		used = 0;
+	}
+}
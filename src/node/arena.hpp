@@ -0,0 +1,31 @@
+#pragma once
+#include <cstddef>
+#include "v8.h"
+
+// String storage for values handed to the engine.
+//
+// frameString() copies a JS value into chunked memory that stays valid until
+// the next server frame (resetFrame() on StartFrame). Chunks are kept across
+// frames, so a warmed up arena does not allocate. This is what bindings use
+// for string arguments the engine only reads during the call.
+//
+// persistentString() is for the few arguments the engine keeps a pointer to
+// (precache names, models, light styles, command names): the copy is interned
+// for the life of the process, so repeating a name costs a lookup.
+namespace arena
+{
+	constexpr size_t chunkSize = 64 * 1024;
+	// Strings up to this many UTF-16 units skip the separate UTF-8 length pass
+	constexpr int smallString = 128;
+	// Minimum size of writable char* arguments, callees fill them with messages
+	constexpr size_t bufferSize = 256;
+	// Info key buffers handed to the engine, which writes up to MAX_SERVERINFO_STRING into them
+	constexpr size_t infoBufferSize = 512;
+
+	// UTF-8 copy of a JS value, never null. null and undefined give ""
+	const char* frameString(v8::Isolate* isolate, v8::Local<v8::Value> value);
+	// frameString() with room for at least `minimum` bytes
+	char* frameBuffer(v8::Isolate* isolate, v8::Local<v8::Value> value, size_t minimum = bufferSize);
+	const char* persistentString(v8::Isolate* isolate, v8::Local<v8::Value> value);
+	void resetFrame();
+}
@@ -0,0 +1,222 @@
+#include <algorithm>
+#include "batch.hpp"
+#include "events.hpp"
+#include "common/logger.hpp"
+#include "utils.hpp"
+#include "lib/hooks.hpp"
+#include "watchdog.hpp"
+
+namespace batch
+{
+	Channel* channels[static_cast<unsigned int>(EventId::Count)] = {};
+	static std::vector<Channel*> activeChannels;
+
+	static v8::Local<v8::Object> makeBatch(v8::Isolate* isolate, v8::Local<v8::Context> context, const Channel& channel)
+	{
+		auto ints = v8::ArrayBuffer::New(isolate, channel.ints.size() * sizeof(int32_t));
+		auto floats = v8::ArrayBuffer::New(isolate, channel.floats.size() * sizeof(float));
+		if (!channel.ints.empty()) memcpy(ints->Data(), channel.ints.data(), channel.ints.size() * sizeof(int32_t));
+		if (!channel.floats.empty()) memcpy(floats->Data(), channel.floats.data(), channel.floats.size() * sizeof(float));
+
+		v8::Local<v8::Array> strings = v8::Array::New(isolate, channel.strings.size());
+		for (unsigned int i = 0; i < channel.strings.size(); i++)
+		{
+			strings->Set(context, i, v8::String::NewFromUtf8(isolate, channel.strings[i].c_str()).ToLocalChecked()).Check();
+		}
+
+		v8::Local<v8::Object> batch = v8::Object::New(isolate);
+		batch->Set(context, v8::String::NewFromUtf8Literal(isolate, "event"),
+			v8::String::NewFromUtf8(isolate, eventIdNames[static_cast<unsigned int>(channel.id)]).ToLocalChecked()).Check();
+		batch->Set(context, v8::String::NewFromUtf8Literal(isolate, "count"), v8::Integer::NewFromUnsigned(isolate, channel.count)).Check();
+		batch->Set(context, v8::String::NewFromUtf8Literal(isolate, "ints"), v8::Int32Array::New(ints, 0, channel.ints.size())).Check();
+		batch->Set(context, v8::String::NewFromUtf8Literal(isolate, "floats"), v8::Float32Array::New(floats, 0, channel.floats.size())).Check();
+		batch->Set(context, v8::String::NewFromUtf8Literal(isolate, "strings"), strings).Check();
+		batch->Set(context, v8::String::NewFromUtf8Literal(isolate, "intStride"), v8::Integer::NewFromUnsigned(isolate, channel.intStride)).Check();
+		batch->Set(context, v8::String::NewFromUtf8Literal(isolate, "floatStride"), v8::Integer::NewFromUnsigned(isolate, channel.floatStride)).Check();
+		return batch;
+	}
+
+	void deliver(Channel& channel)
+	{
+		// Gated like event::call: inside a fast API call or a listener the watchdog
+		// is terminating, the channel keeps growing until flush()
+		if (channel.count == 0 || channel.delivering || event::fastCallDepth > 0 || watchdog::terminating()) return;
+		if (std::all_of(channel.listeners.begin(), channel.listeners.end(), [](const Listener& listener) { return listener.function.IsEmpty(); }))
+		{
+			channel.count = 0;
+			channel.ints.clear();
+			channel.floats.clear();
+			channel.strings.clear();
+			return;
+		}
+
+		v8::Isolate* isolate = channel.listeners.front().isolate;
+		v8::Locker locker(isolate);
+		v8::Isolate::Scope isolateScope(isolate);
+		v8::HandleScope scope(isolate);
+
+		v8::Local<v8::Context> firstContext = channel.listeners.front().context.Get(isolate);
+		v8::Local<v8::Object> batch;
+		{
+			v8::Context::Scope contextScope(firstContext);
+			batch = makeBatch(isolate, firstContext, channel);
+		}
+
+		// Calls made by the listeners are recorded into the next batch
+		channel.count = 0;
+		channel.ints.clear();
+		channel.floats.clear();
+		channel.strings.clear();
+
+		channel.delivering = true;
+		v8::Local<v8::Value> argv[] = { batch };
+		for (size_t i = 0; i < channel.listeners.size(); i++)
+		{
+			if (channel.listeners[i].function.IsEmpty()) continue;
+
+			v8::Local<v8::Context> context = channel.listeners[i].context.Get(isolate);
+			v8::Local<v8::Function> function = channel.listeners[i].function.Get(isolate);
+			v8::Context::Scope contextScope(context);
+			v8::TryCatch eh(isolate);
+
+			watchdog::enter(isolate);
+			v8::MaybeLocal<v8::Value> result = function->Call(context, context->Global(), 1, argv);
+			bool overran = watchdog::leave();
+
+			if (!overran && watchdog::terminating())
+			{
+				// Delivered early inside a listener the watchdog is terminating, let it unwind there
+				eh.ReThrow();
+				break;
+			}
+
+			if (overran)
+			{
+				stats::FunctionInfo info = stats::describe(isolate, function);
+				L_ERROR << "Batched listener " << info.name << " (" << info.script << ":" << info.line << ") for "
+					<< eventIdNames[static_cast<unsigned int>(channel.id)] << " exceeded its time budget and was terminated\nstack:\n" << watchdog::stack();
+
+				unsigned int strikes = watchdog::strikes();
+				if (strikes && ++channel.listeners[i].overruns >= strikes)
+				{
+					L_ERROR << "Batched listener " << info.name << " disabled after " << strikes << " overruns\n";
+					channel.listeners[i].function.Reset();
+				}
+
+				isolate->CancelTerminateExecution();
+			}
+			else if (eh.HasCaught())
+			{
+				v8::String::Utf8Value str(isolate, eh.Exception());
+				L_ERROR << "Batched event handler (" << eventIdNames[static_cast<unsigned int>(channel.id)] << "): " << *str << "\n";
+				if (eh.HasTerminated()) isolate->CancelTerminateExecution();
+			}
+		}
+		channel.delivering = false;
+	}
+
+	static void destroy(Channel* channel)
+	{
+		hooks::release(channel->id);
+		channels[static_cast<unsigned int>(channel->id)] = nullptr;
+		activeChannels.erase(std::remove(activeChannels.begin(), activeChannels.end(), channel), activeChannels.end());
+		delete channel;
+	}
+
+	void flush()
+	{
+		for (size_t i = activeChannels.size(); i-- > 0;)
+		{
+			Channel* channel = activeChannels[i];
+			deliver(*channel);
+
+			// offBatched() only empties the slot, channels are dropped here
+			channel->listeners.erase(
+				std::remove_if(channel->listeners.begin(), channel->listeners.end(), [](const Listener& listener) { return listener.function.IsEmpty(); }),
+				channel->listeners.end()
+			);
+			if (channel->listeners.empty()) destroy(channel);
+		}
+	}
+
+	void clear()
+	{
+		while (!activeChannels.empty())
+		{
+			destroy(activeChannels.back());
+		}
+	}
+
+	static bool findEvent(v8::Isolate* isolate, v8::Local<v8::Value> name, EventId& id)
+	{
+		if (!name->IsString()) return false;
+
+		auto iter = events.find(utils::js_to_string(isolate, name));
+		if (iter == events.end() || iter->second->id >= EventId::Count) return false;
+		if (!eventBatchable[static_cast<unsigned int>(iter->second->id)]) return false;
+
+		id = iter->second->id;
+		return true;
+	}
+
+	void onBatched(const v8::FunctionCallbackInfo<v8::Value>& info)
+	{
+		auto isolate = info.GetIsolate();
+		V8_ASSERT_LOCKED(isolate);
+		v8::HandleScope scope(isolate);
+		v8::Local<v8::Context> context = isolate->GetCurrentContext();
+
+		EventId id;
+		if (info.Length() < 2 || !info[1]->IsFunction() || !findEvent(isolate, info[0], id))
+		{
+			info.GetReturnValue().Set(false);
+			return;
+		}
+
+		Channel*& channel = channels[static_cast<unsigned int>(id)];
+		if (!channel)
+		{
+			channel = new Channel();
+			channel->id = id;
+			activeChannels.push_back(channel);
+			hooks::acquire(id);
+		}
+
+		v8::Local<v8::Function> function = info[1].As<v8::Function>();
+		for (auto& listener : channel->listeners)
+		{
+			if (listener.function == function)
+			{
+				info.GetReturnValue().Set(true);
+				return;
+			}
+		}
+
+		Listener listener{ isolate };
+		listener.context.Reset(isolate, context);
+		listener.function.Reset(isolate, function);
+		channel->listeners.push_back(std::move(listener));
+		info.GetReturnValue().Set(true);
+	}
+
+	void offBatched(const v8::FunctionCallbackInfo<v8::Value>& info)
+	{
+		auto isolate = info.GetIsolate();
+		V8_ASSERT_LOCKED(isolate);
+		v8::HandleScope scope(isolate);
+
+		EventId id;
+		if (info.Length() < 1 || !findEvent(isolate, info[0], id)) return;
+
+		Channel* channel = channels[static_cast<unsigned int>(id)];
+		if (!channel) return;
+
+		for (auto& listener : channel->listeners)
+		{
+			if (info.Length() < 2 || listener.function == info[1])
+			{
+				listener.function.Reset();
+			}
+		}
+	}
+}
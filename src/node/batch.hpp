@@ -0,0 +1,130 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <type_traits>
+#include "v8.h"
+#include "extdll.h"
+#include "enginecallback.h"
+#include "auto/event_ids.hpp"
+
+// Frame-batched delivery for fire-and-forget events (nodemod.onBatched).
+//
+// Hooks of batchable events call batch::record() with their raw arguments.
+// Nothing happens unless a batched listener exists; otherwise the call is
+// appended to the event's channel as one record and the listeners receive
+// every record of the frame at once on StartFrame:
+//
+//   { event, count, ints: Int32Array, floats: Float32Array, strings, intStride, floatStride }
+//
+// Integers, entities (as index, -1 for null) and string indices go to `ints`,
+// floats and vectors (3 floats) go to `floats`, in argument order.
+namespace batch
+{
+	// A full channel is delivered early instead of growing, except where
+	// event::call would not run listeners either (fast API calls, watchdog
+	// termination)
+	constexpr unsigned int channelCapacity = 4096;
+
+	struct Listener
+	{
+		v8::Isolate* isolate;
+		v8::Global<v8::Context> context;
+		v8::Global<v8::Function> function;
+		// Budget overruns, see watchdog.hpp
+		unsigned int overruns = 0;
+	};
+
+	struct Channel
+	{
+		EventId id;
+		unsigned int count = 0;
+		unsigned int intStride = 0;
+		unsigned int floatStride = 0;
+		std::vector<int32_t> ints;
+		std::vector<float> floats;
+		std::vector<std::string> strings;
+		std::vector<Listener> listeners;
+		bool delivering = false;
+	};
+
+	extern Channel* channels[static_cast<unsigned int>(EventId::Count)];
+
+	void deliver(Channel& channel);
+	void flush();
+	void clear();
+
+	void onBatched(const v8::FunctionCallbackInfo<v8::Value>& info);
+	void offBatched(const v8::FunctionCallbackInfo<v8::Value>& info);
+
+	template<typename T>
+	constexpr bool isFloatSlot = std::is_floating_point_v<T>;
+
+	template<typename T>
+	constexpr bool isVectorSlot = std::is_same_v<T, const float*>;
+
+	template<typename T>
+	constexpr unsigned int intSlots = (isFloatSlot<T> || isVectorSlot<T>) ? 0 : 1;
+
+	template<typename T>
+	constexpr unsigned int floatSlots = isFloatSlot<T> ? 1 : (isVectorSlot<T> ? 3 : 0);
+
+	struct Writer
+	{
+		Channel& channel;
+		int32_t* ints;
+		float* floats;
+	};
+
+	inline void put(Writer& writer, int value) { *writer.ints++ = value; }
+	inline void put(Writer& writer, unsigned int value) { *writer.ints++ = static_cast<int32_t>(value); }
+	inline void put(Writer& writer, float value) { *writer.floats++ = value; }
+	inline void put(Writer& writer, double value) { *writer.floats++ = static_cast<float>(value); }
+
+	inline void put(Writer& writer, const float* value)
+	{
+		*writer.floats++ = value ? value[0] : 0.0f;
+		*writer.floats++ = value ? value[1] : 0.0f;
+		*writer.floats++ = value ? value[2] : 0.0f;
+	}
+
+	inline void put(Writer& writer, const char* value)
+	{
+		*writer.ints++ = static_cast<int32_t>(writer.channel.strings.size());
+		writer.channel.strings.emplace_back(value ? value : "");
+	}
+
+	inline void put(Writer& writer, const edict_t* value)
+	{
+		*writer.ints++ = value ? (*g_engfuncs.pfnIndexOfEdict)(value) : -1;
+	}
+
+	template<typename... Args>
+	inline void record(EventId id, Args... args)
+	{
+		Channel* channel = channels[static_cast<unsigned int>(id)];
+		if (!channel) return;
+
+		constexpr unsigned int ints = (0 + ... + intSlots<std::decay_t<Args>>);
+		constexpr unsigned int floats = (0 + ... + floatSlots<std::decay_t<Args>>);
+
+		if (channel->count >= channelCapacity) deliver(*channel);
+		if (channel->count == 0 && channel->ints.capacity() == 0)
+		{
+			channel->ints.reserve(channelCapacity * ints);
+			channel->floats.reserve(channelCapacity * floats);
+		}
+
+		channel->intStride = ints;
+		channel->floatStride = floats;
+
+		size_t intBase = channel->ints.size();
+		size_t floatBase = channel->floats.size();
+		channel->ints.resize(intBase + ints);
+		channel->floats.resize(floatBase + floats);
+
+		Writer writer{ *channel, channel->ints.data() + intBase, channel->floats.data() + floatBase };
+		(put(writer, args), ...);
+		channel->count++;
+	}
+}
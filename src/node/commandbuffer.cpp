@@ -0,0 +1,264 @@
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include "commandbuffer.hpp"
+#include "arena.hpp"
+#include "utils.hpp"
+#include "util/convert.hpp"
+#include "extdll.h"
+
+extern globalvars_t* gpGlobals;
+extern enginefuncs_t g_engfuncs;
+
+namespace commandbuffer
+{
+	// Operand words of each opcode, in Op order
+	static const size_t operandCount[] = { 3, 6, 0, 1, 1, 1, 1, 1, 1, 1, 1, 4, 7, 2, 7, 9 };
+	static_assert(sizeof(operandCount) / sizeof(operandCount[0]) == static_cast<size_t>(Op::Count), "operandCount must cover every opcode");
+
+	static bool fail(v8::Isolate* isolate, size_t command, const std::string& message)
+	{
+		std::string text = "nodemod.eng.batch: command " + std::to_string(command) + ": " + message;
+		isolate->ThrowException(v8::Exception::TypeError(convert::str2js(isolate, text.c_str())));
+		return false;
+	}
+
+	static inline float toFloat(int32_t word)
+	{
+		float value;
+		memcpy(&value, &word, sizeof(value));
+		return value;
+	}
+
+	// Operand holding the entity / string of each opcode, -1 for none
+	static const int entityOperand[] = { 2, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0 };
+	static const int stringOperand[] = { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, 1, 2, 4 };
+	static_assert(sizeof(entityOperand) / sizeof(entityOperand[0]) == static_cast<size_t>(Op::Count), "entityOperand must cover every opcode");
+	static_assert(sizeof(stringOperand) / sizeof(stringOperand[0]) == static_cast<size_t>(Op::Count), "stringOperand must cover every opcode");
+
+	static inline bool isMessageBegin(Op op) { return op == Op::MessageBegin || op == Op::MessageBeginOrigin; }
+	static inline bool isMessageBody(Op op) { return op >= Op::MessageEnd && op <= Op::WriteString; }
+
+	// -1 is null where the engine takes one, any other index must be a live edict
+	static bool toEntity(int32_t index, bool nullable, edict_t*& result)
+	{
+		result = nullptr;
+		if (index == -1) return nullable;
+		if (index < 0 || !gpGlobals || index >= gpGlobals->maxEntities) return false;
+
+		edict_t* edicts = (*g_engfuncs.pfnPEntityOfEntIndex)(0);
+		if (!edicts || edicts[index].free) return false;
+
+		result = edicts + index;
+		return true;
+	}
+
+	// Copied into the frame arena, which outlives the engine call, or interned for
+	// arguments the engine keeps (see PERSISTENT_STRING_FUNCTIONS in scripts/generator.js)
+	static bool toString(v8::Isolate* isolate, v8::Local<v8::Value> strings, int32_t index, bool persistent, const char*& result)
+	{
+		if (!strings->IsArray() || index < 0 || static_cast<uint32_t>(index) >= strings.As<v8::Array>()->Length()) return false;
+
+		v8::Local<v8::Value> value;
+		if (!strings.As<v8::Array>()->Get(isolate->GetCurrentContext(), index).ToLocal(&value) || !value->IsString()) return false;
+
+		result = persistent ? arena::persistentString(isolate, value) : arena::frameString(isolate, value);
+		return true;
+	}
+
+	// First pass: checks every command and resolves its string before anything runs, so a
+	// bad command can never leave the engine halfway through a batch or a message
+	static bool validate(v8::Isolate* isolate, const int32_t* words, size_t count, v8::Local<v8::Value> strings, std::vector<const char*>& texts)
+	{
+		bool inMessage = false;
+		size_t command = 0;
+		for (size_t at = 0; at < count; command++)
+		{
+			int32_t op = words[at];
+			if (op < 0 || op >= static_cast<int32_t>(Op::Count)) return fail(isolate, command, "unknown opcode " + std::to_string(op));
+			if (count - at - 1 < operandCount[op]) return fail(isolate, command, "missing operands");
+
+			const int32_t* arg = words + at + 1;
+			at += 1 + operandCount[op];
+
+			if (isMessageBegin(static_cast<Op>(op)))
+			{
+				if (inMessage) return fail(isolate, command, "message started before the previous MessageEnd");
+				inMessage = true;
+			}
+			else if (isMessageBody(static_cast<Op>(op)))
+			{
+				if (!inMessage) return fail(isolate, command, "message write outside MessageBegin / MessageEnd");
+				if (static_cast<Op>(op) == Op::MessageEnd) inMessage = false;
+			}
+			else if (inMessage) return fail(isolate, command, "engine call inside a message");
+
+			edict_t* entity;
+			if (entityOperand[op] >= 0 && !toEntity(arg[entityOperand[op]], isMessageBegin(static_cast<Op>(op)), entity))
+				return fail(isolate, command, "invalid entity " + std::to_string(arg[entityOperand[op]]));
+
+			const char* text = nullptr;
+			if (stringOperand[op] >= 0 && !toString(isolate, strings, arg[stringOperand[op]], static_cast<Op>(op) == Op::SetModel, text))
+				return fail(isolate, command, "invalid string index " + std::to_string(arg[stringOperand[op]]));
+			texts.push_back(text);
+		}
+
+		if (inMessage) return fail(isolate, command, "missing MessageEnd");
+		return true;
+	}
+
+	void run(const v8::FunctionCallbackInfo<v8::Value>& info)
+	{
+		v8::Isolate* isolate = info.GetIsolate();
+		V8_ASSERT_LOCKED(isolate);
+		v8::HandleScope scope(isolate);
+
+		std::shared_ptr<v8::BackingStore> store;
+		size_t offset = 0;
+		size_t length = 0;
+		if (info[0]->IsArrayBuffer())
+		{
+			store = info[0].As<v8::ArrayBuffer>()->GetBackingStore();
+			length = info[0].As<v8::ArrayBuffer>()->ByteLength();
+		}
+		else if (info[0]->IsArrayBufferView())
+		{
+			v8::Local<v8::ArrayBufferView> view = info[0].As<v8::ArrayBufferView>();
+			store = view->Buffer()->GetBackingStore();
+			offset = view->ByteOffset();
+			length = view->ByteLength();
+		}
+		else
+		{
+			isolate->ThrowException(v8::Exception::TypeError(convert::str2js(isolate, "nodemod.eng.batch expects an ArrayBuffer or a typed array")));
+			return;
+		}
+
+		if (offset % sizeof(int32_t) || length % sizeof(int32_t))
+		{
+			isolate->ThrowException(v8::Exception::TypeError(convert::str2js(isolate, "nodemod.eng.batch: commands must be 4 byte aligned 32-bit words")));
+			return;
+		}
+
+		// Copied so that hooks run by the batch cannot rewrite or detach commands that were already validated
+		const int32_t* data = reinterpret_cast<const int32_t*>(static_cast<const char*>(store->Data()) + offset);
+		std::vector<int32_t> copy(data, data + length / sizeof(int32_t));
+		const int32_t* words = copy.data();
+		size_t count = copy.size();
+		v8::Local<v8::Value> strings = info[1];
+
+		std::vector<const char*> texts;
+		if (!validate(isolate, words, count, strings, texts)) return;
+
+		// Second pass: only entities can go stale here, when a hook removes one mid-batch.
+		// Their commands are skipped, a message aimed at one is dropped up to its MessageEnd
+		bool skipping = false;
+		size_t command = 0;
+		for (size_t at = 0; at < count; command++)
+		{
+			int32_t op = words[at];
+			const int32_t* arg = words + at + 1;
+			at += 1 + operandCount[op];
+
+			if (skipping)
+			{
+				if (static_cast<Op>(op) == Op::MessageEnd) skipping = false;
+				continue;
+			}
+
+			edict_t* entity = nullptr;
+			if (entityOperand[op] >= 0 && !toEntity(arg[entityOperand[op]], isMessageBegin(static_cast<Op>(op)), entity))
+			{
+				skipping = isMessageBegin(static_cast<Op>(op));
+				continue;
+			}
+
+			const char* text = texts[command];
+			switch (static_cast<Op>(op))
+			{
+			case Op::MessageBegin:
+				(*g_engfuncs.pfnMessageBegin)(arg[0], arg[1], nullptr, entity);
+				break;
+
+			case Op::MessageBeginOrigin:
+			{
+				float origin[3] = { toFloat(arg[2]), toFloat(arg[3]), toFloat(arg[4]) };
+				(*g_engfuncs.pfnMessageBegin)(arg[0], arg[1], origin, entity);
+				break;
+			}
+
+			case Op::MessageEnd:
+				(*g_engfuncs.pfnMessageEnd)();
+				break;
+
+			case Op::WriteByte:
+				(*g_engfuncs.pfnWriteByte)(arg[0]);
+				break;
+
+			case Op::WriteChar:
+				(*g_engfuncs.pfnWriteChar)(arg[0]);
+				break;
+
+			case Op::WriteShort:
+				(*g_engfuncs.pfnWriteShort)(arg[0]);
+				break;
+
+			case Op::WriteLong:
+				(*g_engfuncs.pfnWriteLong)(arg[0]);
+				break;
+
+			case Op::WriteEntity:
+				(*g_engfuncs.pfnWriteEntity)(arg[0]);
+				break;
+
+			case Op::WriteAngle:
+				(*g_engfuncs.pfnWriteAngle)(toFloat(arg[0]));
+				break;
+
+			case Op::WriteCoord:
+				(*g_engfuncs.pfnWriteCoord)(toFloat(arg[0]));
+				break;
+
+			case Op::WriteString:
+				(*g_engfuncs.pfnWriteString)(text);
+				break;
+
+			case Op::SetOrigin:
+			{
+				float origin[3] = { toFloat(arg[1]), toFloat(arg[2]), toFloat(arg[3]) };
+				(*g_engfuncs.pfnSetOrigin)(entity, origin);
+				break;
+			}
+
+			case Op::SetSize:
+			{
+				float mins[3] = { toFloat(arg[1]), toFloat(arg[2]), toFloat(arg[3]) };
+				float maxs[3] = { toFloat(arg[4]), toFloat(arg[5]), toFloat(arg[6]) };
+				(*g_engfuncs.pfnSetSize)(entity, mins, maxs);
+				break;
+			}
+
+			case Op::SetModel:
+				(*g_engfuncs.pfnSetModel)(entity, text);
+				break;
+
+			case Op::EmitSound:
+				(*g_engfuncs.pfnEmitSound)(entity, arg[1], text, toFloat(arg[3]), toFloat(arg[4]), arg[5], arg[6]);
+				break;
+
+			case Op::EmitAmbientSound:
+			{
+				float origin[3] = { toFloat(arg[1]), toFloat(arg[2]), toFloat(arg[3]) };
+				(*g_engfuncs.pfnEmitAmbientSound)(entity, origin, text, toFloat(arg[5]), toFloat(arg[6]), arg[7], arg[8]);
+				break;
+			}
+
+			case Op::Count:
+				break;
+			}
+		}
+
+		info.GetReturnValue().Set(v8::Integer::NewFromUnsigned(isolate, static_cast<uint32_t>(command)));
+	}
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstdint>
+#include "v8.h"
+
+// nodemod.eng.batch(commands, strings?): many engine calls in one native call.
+//
+// `commands` is an ArrayBuffer, or a view over one, read as 32-bit words: an
+// opcode followed by its operands. Integers and entity indices (-1 for null)
+// are int32 words, floats are float32 words (write them through a Float32Array
+// over the same buffer) and strings are indices into `strings`. Commands go
+// through g_engfuncs, so metamod and nodemod hooks see them as usual.
+//
+// The whole buffer is checked before anything runs: a bad opcode, operand,
+// entity or string index, or a MessageBegin / MessageEnd pair that is unbalanced
+// or has other calls inside it, throws with nothing executed. An entity that a
+// hook removes mid-batch skips its command, or its whole message. Returns the
+// number of commands in the buffer.
+namespace commandbuffer
+{
+	enum class Op : int32_t
+	{
+		MessageBegin,       // dest, type, entity
+		MessageBeginOrigin, // dest, type, x, y, z, entity
+		MessageEnd,
+		WriteByte,          // value
+		WriteChar,          // value
+		WriteShort,         // value
+		WriteLong,          // value
+		WriteEntity,        // value
+		WriteAngle,         // float
+		WriteCoord,         // float
+		WriteString,        // string
+		SetOrigin,          // entity, x, y, z
+		SetSize,            // entity, mins x, y, z, maxs x, y, z
+		SetModel,           // entity, model string
+		EmitSound,          // entity, channel, sample string, volume, attenuation, flags, pitch
+		EmitAmbientSound,   // entity, x, y, z, sample string, volume, attenuation, flags, pitch
+		Count
+	};
+
+	void run(const v8::FunctionCallbackInfo<v8::Value>& info);
+}
@@ -0,0 +1,139 @@
+#include <string>
+#include <vector>
+#include "cvars.hpp"
+#include "events.hpp"
+#include "utils.hpp"
+#include "util/convert.hpp"
+#include "extdll.h"
+
+extern enginefuncs_t g_engfuncs;
+
+namespace cvars
+{
+	struct Watched
+	{
+		cvar_t* cvar;
+		// Value seen on the last frame, compared against cvar->string
+		std::string last;
+		v8::Global<v8::Object> handle;
+	};
+
+	// Handles are few and never dropped before reload, a linear search is fine
+	static std::vector<Watched> watched;
+	static v8::Eternal<v8::ObjectTemplate> handleTemplate;
+
+	static inline const char* valueOf(const cvar_t* cvar)
+	{
+		return cvar->string ? cvar->string : "";
+	}
+
+	static inline cvar_t* unwrap(v8::Local<v8::Object> holder)
+	{
+		return static_cast<cvar_t*>(holder->GetAlignedPointerFromInternalField(0));
+	}
+
+	static v8::Local<v8::ObjectTemplate> createTemplate(v8::Isolate* isolate)
+	{
+		v8::Local<v8::ObjectTemplate> templ = v8::ObjectTemplate::New(isolate);
+		templ->SetInternalFieldCount(1);
+
+		templ->SetNativeDataProperty(convert::str2js(isolate, "name"),
+			[](v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& info) {
+				info.GetReturnValue().Set(convert::str2js(info.GetIsolate(), unwrap(info.Holder())->name));
+			});
+
+		templ->SetNativeDataProperty(convert::str2js(isolate, "float"),
+			[](v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& info) {
+				info.GetReturnValue().Set(v8::Number::New(info.GetIsolate(), unwrap(info.Holder())->value));
+			},
+			[](v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& info) {
+				double number = value->NumberValue(info.GetIsolate()->GetCurrentContext()).FromMaybe(0);
+				(*g_engfuncs.pfnCVarSetFloat)(unwrap(info.Holder())->name, static_cast<float>(number));
+			});
+
+		templ->SetNativeDataProperty(convert::str2js(isolate, "string"),
+			[](v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& info) {
+				info.GetReturnValue().Set(convert::str2js(info.GetIsolate(), valueOf(unwrap(info.Holder()))));
+			},
+			[](v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void>& info) {
+				// The engine copies the new value
+				std::string text = utils::js_to_string(info.GetIsolate(), value);
+				(*g_engfuncs.pfnCVarSetString)(unwrap(info.Holder())->name, text.c_str());
+			});
+
+		templ->SetNativeDataProperty(convert::str2js(isolate, "flags"),
+			[](v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& info) {
+				info.GetReturnValue().Set(v8::Integer::New(info.GetIsolate(), unwrap(info.Holder())->flags));
+			});
+
+		return templ;
+	}
+
+	void get(const v8::FunctionCallbackInfo<v8::Value>& info)
+	{
+		v8::Isolate* isolate = info.GetIsolate();
+		V8_ASSERT_LOCKED(isolate);
+		v8::HandleScope scope(isolate);
+
+		if (!info[0]->IsString())
+		{
+			isolate->ThrowException(v8::Exception::TypeError(convert::str2js(isolate, "nodemod.cvar expects a cvar name")));
+			return;
+		}
+
+		std::string name = utils::js_to_string(isolate, info[0]);
+		cvar_t* cvar = (*g_engfuncs.pfnCVarGetPointer)(name.c_str());
+		if (!cvar)
+		{
+			info.GetReturnValue().SetNull();
+			return;
+		}
+
+		for (const Watched& entry : watched)
+		{
+			if (entry.cvar == cvar)
+			{
+				info.GetReturnValue().Set(entry.handle.Get(isolate));
+				return;
+			}
+		}
+
+		if (handleTemplate.IsEmpty()) handleTemplate.Set(isolate, createTemplate(isolate));
+
+		v8::Local<v8::Object> handle = handleTemplate.Get(isolate)->NewInstance(isolate->GetCurrentContext()).ToLocalChecked();
+		handle->SetAlignedPointerInInternalField(0, cvar);
+		watched.push_back({ cvar, valueOf(cvar), v8::Global<v8::Object>(isolate, handle) });
+
+		info.GetReturnValue().Set(handle);
+	}
+
+	void frame()
+	{
+		// By index: a listener may ask for a new handle and grow the list
+		for (size_t i = 0; i < watched.size(); i++)
+		{
+			const char* current = valueOf(watched[i].cvar);
+			if (watched[i].last == current) continue;
+
+			std::string previous = std::move(watched[i].last);
+			watched[i].last = current;
+
+			std::string value = current;
+			const char* name = watched[i].cvar->name;
+			event::findAndCall<3>(EventId::cvarChanged, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
+				v8_args[0] = convert::str2js(isolate, name);
+				v8_args[1] = convert::str2js(isolate, value.c_str());
+				v8_args[2] = convert::str2js(isolate, previous.c_str());
+			});
+		}
+	}
+
+	void clear()
+	{
+		for (Watched& entry : watched)
+		{
+			entry.handle.Reset();
+		}
+		watched.clear();
+	}
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include "v8.h"
+
+// nodemod.cvar(name): a handle over the engine's cvar_t.
+//
+// The cvar is looked up once through pfnCVarGetPointer; `float`, `string`
+// and `flags` then read its memory directly, and assignments go through
+// pfnCVarSetFloat / pfnCVarSetString. Returns null for unknown cvars and the
+// same handle for repeated lookups.
+//
+// Every cvar with a handle is compared against its last value on StartFrame,
+// and a change fires cvarChanged(name, value, previous).
+namespace cvars
+{
+	void get(const v8::FunctionCallbackInfo<v8::Value>& info);
+
+	void frame();
+	void clear();
+}
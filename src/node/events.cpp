@@ -5,6 +5,8 @@
 #include "events.hpp"
 #include "common/logger.hpp"
 #include "utils.hpp"
+#include "lib/hooks.hpp"
+#include "watchdog.hpp"
 #include <extdll.h>
 #include <meta_api.h>
 
@@ -14,10 +16,12 @@
 #undef LOG_ERROR
 #endif
 
-// Include metamod globals for override_ret access
+// Include metamod globals for the SUPERCEDE check
 extern meta_globals_t *gpMetaGlobals;
 
 	eventsContainer events = eventsContainer();
+	event* event::slots[static_cast<unsigned int>(EventId::Count)] = {};
+	unsigned int event::fastCallDepth = 0;
 
 	bool event::register_event(const std::string& eventName, const std::string& param_types)
 	{
@@ -26,12 +30,34 @@ extern meta_globals_t *gpMetaGlobals;
 		return true;
 	}
 
+	bool event::register_event(EventId id, const std::string& param_types)
+	{
+		const char* eventName = eventIdNames[static_cast<unsigned int>(id)];
+		if (events.find(eventName) != events.end()) return false;
+
+		event* _event = new event(eventName, param_types);
+		_event->id = id;
+		events.insert({ eventName, _event });
+		slots[static_cast<unsigned int>(id)] = _event;
+		return true;
+	}
+
+	void event::clear_all()
+	{
+		for (auto& pair : events)
+		{
+			pair.second->remove_all();
+		}
+		events.clear();
+		std::fill(std::begin(slots), std::end(slots), nullptr);
+	}
+
 	void event::register_event(const v8::FunctionCallbackInfo<v8::Value>& info)
 	{
 		if (info.Length() > 1)
 		{
 			auto isolate = info.GetIsolate();
-			v8::Locker locker(isolate);
+			V8_ASSERT_LOCKED(isolate);
 			v8::Isolate::Scope isolateScope(isolate);
 			v8::HandleScope scope(isolate);
 
@@ -63,7 +89,7 @@ extern meta_globals_t *gpMetaGlobals;
 		if (info.Length() > 0)
 		{
 			auto isolate = info.GetIsolate();
-			v8::Locker locker(isolate);
+			V8_ASSERT_LOCKED(isolate);
 			v8::Isolate::Scope isolateScope(isolate);
 			v8::HandleScope scope(isolate);
 
@@ -81,8 +107,12 @@ extern meta_globals_t *gpMetaGlobals;
 
 			if ((funcArgIndex >= 0) && (info[funcArgIndex]->IsFunction()))
 			{
+				// nodemod.on(event, filter, callback)
+				filters::FilterList eventFilters;
+				if (funcArgIndex >= 2 && !filters::parse(isolate, info[1], eventFilters)) return;
+
 				v8::Local<v8::Function> function = info[funcArgIndex].As<v8::Function>();
-				_event->append(context, function);
+				_event->append(context, function, std::move(eventFilters));
 			}
 		}
 	}
@@ -90,7 +120,7 @@ extern meta_globals_t *gpMetaGlobals;
 	void event::clearListeners(const v8::FunctionCallbackInfo<v8::Value>& info)
 	{
 			/*auto isolate = info.GetIsolate();
-			v8::Locker locker(isolate);
+			V8_ASSERT_LOCKED(isolate);
 			v8::Isolate::Scope isolateScope(isolate);
 			v8::HandleScope scope(isolate);
 
@@ -98,7 +128,7 @@ extern meta_globals_t *gpMetaGlobals;
 
 			v8::Context::Scope contextScope(_context);*/
 
-			events.clear();
+			clear_all();
 	}
 
 	void event::remove_listener(const v8::FunctionCallbackInfo<v8::Value>& info)
@@ -106,7 +136,7 @@ extern meta_globals_t *gpMetaGlobals;
 		if (info.Length() > 0)
 		{
 			auto isolate = info.GetIsolate();
-			v8::Locker locker(isolate);
+			V8_ASSERT_LOCKED(isolate);
 			v8::Isolate::Scope isolateScope(isolate);
 			v8::HandleScope scope(isolate);
 
@@ -130,40 +160,18 @@ extern meta_globals_t *gpMetaGlobals;
 					v8::Local<v8::Array> funcArray = v8::Local<v8::Array>::Cast(info[1]);
 					for (unsigned int i = 0; i < funcArray->Length(); i++)
 					{
-						const v8::Local<v8::Function>& function = funcArray->Get(_context, i).ToLocalChecked().As<v8::Function>();
-						for (auto& element : _event->functionList)
-						{
-							if (element.context == _context && element.function.Get(isolate) == function)
-							{
-								_event->remove(element);
-								break;
-							}
-						}
-
+						v8::Local<v8::Value> function = funcArray->Get(_context, i).ToLocalChecked();
+						if (function->IsFunction()) _event->remove(isolate, _context, function.As<v8::Function>());
 					}
 				}
-				else
+				else if (info[1]->IsFunction())
 				{
-					v8::Local<v8::Function> function = v8::Local<v8::Function>::Cast(info[1]);
-					for (auto& element : _event->functionList) {
-						if (element.context == _context && element.function.Get(isolate) == function)
-						{
-							_event->remove(element);
-							break;
-						}
-					}
+					_event->remove(isolate, _context, info[1].As<v8::Function>());
 				}
 			}
 			else if (info.Length() == 1)
 			{
-				auto copiedFunctionList = _event->functionList;
-
-				for (auto& element : copiedFunctionList) {
-					if (element.context == _context)
-					{
-						_event->remove(element);
-					}
-				}
+				_event->remove(isolate, _context, v8::Local<v8::Function>());
 			}
 		}
 	}
@@ -173,7 +181,7 @@ extern meta_globals_t *gpMetaGlobals;
 		if (info.Length() > 0)
 		{
 			auto isolate = info.GetIsolate();
-			v8::Locker locker(isolate);
+			V8_ASSERT_LOCKED(isolate);
 			v8::Isolate::Scope isolateScope(isolate);
 			v8::HandleScope scope(isolate);
 
@@ -185,16 +193,15 @@ extern meta_globals_t *gpMetaGlobals;
 			if (events.find(eventName) == events.end()) return;
 			event* _event = events[eventName];
 
-			v8::Local<v8::Value>* argv = NULL;
 			unsigned int argc = info.Length() - 1;
-			argv = new v8::Local<v8::Value>[argc];
+			std::vector<v8::Local<v8::Value>> argv(argc);
 
-			for (int i = 0; i < argc; i++)
+			for (unsigned int i = 0; i < argc; i++)
 			{
 				argv[i] = info[i + 1];
 			}
 
-			_event->call(argv, argc);
+			_event->call(argv.data(), argc);
 		}
 	}
 
@@ -204,16 +211,9 @@ extern meta_globals_t *gpMetaGlobals;
 			iter->second->call(args, argCount);
 	}
 
-	void event::findAndCall(const std::string& eventName, argument_collector_t collectArguments) {
-		auto iter = events.find(eventName);
-		if (iter != events.end())
-			iter->second->call(collectArguments);
-	}
-
 	event::event(const std::string& eventName, const std::string& param_types)
 		: name(eventName),
-		paramTypes(param_types),
-		functionList(std::vector<EventListener_t>())
+		paramTypes(param_types)
 	{
 	}
 
@@ -227,14 +227,14 @@ extern meta_globals_t *gpMetaGlobals;
 
 	}
 
-	void event::append(const v8::Local<v8::Context>& context, const v8::Local<v8::Function>& function)
+	void event::append(const v8::Local<v8::Context>& context, const v8::Local<v8::Function>& function, filters::FilterList filters)
 	{
 		v8::Isolate* isolate = function->GetIsolate();
 
 		bool result = std::any_of(functionList.cbegin(), functionList.cend(),
-			[&function, &isolate](const EventListener_t& listener)
+			[&function](const EventListener_t& listener)
 			{
-				return listener.function.Get(isolate) == function;
+				return !listener.removed && listener.function == function;
 			});
 
 		if (result)
@@ -242,147 +242,203 @@ extern meta_globals_t *gpMetaGlobals;
 			return;
 		}
 
-		functionList.push_back(
-			EventListener_t(
-				isolate,
-				context,
-				function
-			)
-		);
-	}
+		if (liveCount++ == 0) hooks::acquire(id);
 
-	void event::remove(const EventListener_t& eventListener)
-	{
-		functionList.erase(std::remove(functionList.begin(), functionList.end(), eventListener), functionList.end());
-	}
+		// Keep listeners of one context together so call() enters each context once.
+		// Inserting would shift the range a running dispatch walks, so append then.
+		auto position = functionList.end();
+		if (dispatchDepth == 0)
+		{
+			auto last = std::find_if(functionList.rbegin(), functionList.rend(),
+				[&context](const EventListener_t& listener) { return listener.context == context; });
+			if (last != functionList.rend()) position = last.base();
+		}
 
-	void event::remove_all()
-	{
-		functionList.clear();
+		auto listener = functionList.emplace(position, isolate, context, function);
+		if (!filters.empty())
+		{
+			listener->filters = std::move(filters);
+			filteredCount++;
+		}
 	}
 
-	void event::call(v8::Local<v8::Value>* args, int argCount)
+	void event::remove(v8::Isolate* isolate, const v8::Local<v8::Context>& context, const v8::Local<v8::Function>& function)
 	{
-		std::vector<EventListener_t> copiedFunctionList = functionList;
-
-		for (auto& listener : copiedFunctionList)
+		for (size_t i = 0; i < functionList.size(); i++)
 		{
-			if (std::find(functionList.begin(), functionList.end(), listener) == functionList.end()) {
-				continue;
+			EventListener_t& listener = functionList[i];
+			if (listener.removed || listener.context != context) continue;
+			if (function.IsEmpty())
+			{
+				remove_at(i);
 			}
-
-			v8::Isolate* isolate = listener.isolate;
-			v8::Locker v8Locker(isolate);
-			v8::Isolate::Scope isolateScope(isolate);
-			v8::HandleScope hs(isolate);
-			v8::Local<v8::Context> ctx = listener.context.Get(isolate);
-			v8::Context::Scope cs(ctx);
-
-			isolate->CancelTerminateExecution();
-
-			v8::TryCatch eh(isolate);
-
-			v8::Local<v8::Function> function = listener.function.Get(isolate);
-			v8::MaybeLocal<v8::Value> maybeResult = function->Call(ctx, ctx->Global(), argCount, args);
-			v8::Local<v8::Value> result;
-			if (maybeResult.ToLocal(&result)) {
-				if (result->IsNumber()) {
-					double num = result->NumberValue(ctx).ToChecked();
-					printf("JS returned number: %f\n", num);
-				} else if (result->IsBoolean()) {
-					bool val = result->BooleanValue(isolate);
-					printf("JS returned boolean: %s\n", val ? "true" : "false");
-				} else if (result->IsString()) {
-					v8::String::Utf8Value str(isolate, result);
-					printf("JS returned string: %s\n", *str);
-				}
-
-				// Capture return value for metamod override_ret if gpMetaGlobals is available
-				if (gpMetaGlobals && !result.IsEmpty()) {
-					gpMetaGlobals->override_ret = utils::jsToPointer(isolate, result);
-					if (gpMetaGlobals->override_ret) printf("override_ret = %p, override_ret (char*) = %s\n", (void*)gpMetaGlobals->override_ret, (char *) gpMetaGlobals->override_ret);
-				}
+			else if (listener.function == function)
+			{
+				remove_at(i);
+				break;
 			}
+		}
 
+		if (dispatchDepth == 0) compact();
+	}
 
-			if (eh.HasCaught())
-			{
-				v8::String::Utf8Value str(isolate, eh.Exception());
-				v8::String::Utf8Value stack(isolate, eh.StackTrace(listener.context.Get(isolate)).ToLocalChecked());
+	void event::remove_at(size_t index)
+	{
+		functionList[index].removed = true;
+		if (!functionList[index].filters.empty()) filteredCount--;
+		if (--liveCount == 0) hooks::release(id);
+	}
 
-				L_ERROR << "Event handling function in resource: " << *str << "\nstack:\n" << *stack << "\n";
-			}
+	void event::remove_all()
+	{
+		for (size_t i = 0; i < functionList.size(); i++)
+		{
+			if (!functionList[i].removed) remove_at(i);
+		}
 
-			// If listener set SUPERCEDE, stop processing further listeners
-			if (gpMetaGlobals && gpMetaGlobals->mres == MRES_SUPERCEDE) {
-				break;
-			}
+		if (dispatchDepth == 0) compact();
+	}
+
+	void event::reset_counters()
+	{
+		counter = stats::Counter();
+		for (auto& listener : functionList)
+		{
+			listener.counter = stats::Counter();
 		}
+	}
 
-		if (argCount > 0) delete[] args;
+	void event::compact()
+	{
+		functionList.erase(
+			std::remove_if(functionList.begin(), functionList.end(), [](const EventListener_t& listener) { return listener.removed; }),
+			functionList.end()
+		);
 	}
 
-void event::call(argument_collector_t collectArguments)
+	static uint32_t listenerTraceName(v8::Isolate* isolate, event::EventListener_t& listener)
 	{
-		std::vector<EventListener_t> copiedFunctionList = functionList;
+		if (!listener.traceName)
+		{
+			stats::FunctionInfo info = stats::describe(isolate, listener.function.Get(isolate));
+			listener.traceName = trace::name(info.name + " " + info.script + ":" + std::to_string(info.line));
+		}
+		return listener.traceName;
+	}
 
-		for (auto& listener : copiedFunctionList)
+	void event::call(v8::Local<v8::Value>* args, int argCount, argument_filler_t fillArguments, void* state,
+		result_handler_t handleResult, void* resultState, const filters::Value* nativeArgs, unsigned int nativeArgCount)
+	{
+		// Nothing runs inside a listener the watchdog is terminating or a fast API call
+		if (liveCount == 0 || fastCallDepth > 0 || watchdog::terminating()) return;
+
+		stats::Timer timer(counter);
+		if (trace::active && !traceName) traceName = trace::name(name);
+		trace::Scope traceScope(traceName, trace::Category::Event);
+		v8::Isolate* isolate = functionList.front().isolate;
+		v8::Locker v8Locker(isolate);
+		v8::Isolate::Scope isolateScope(isolate);
+		v8::HandleScope hs(isolate);
+
+		isolate->CancelTerminateExecution();
+
+		// Listeners appended by a handler start with the next dispatch. Index access
+		// only: a handler may grow the vector and move the elements.
+		dispatchDepth++;
+		const size_t count = functionList.size();
+		size_t i = 0;
+		bool superceded = false;
+		bool unwinding = false;
+
+		while (i < count && !superceded && !unwinding)
 		{
-			if (std::find(functionList.begin(), functionList.end(), listener) == functionList.end()) {
+			if (functionList[i].removed)
+			{
+				i++;
 				continue;
 			}
 
-			v8::Isolate* isolate = listener.isolate;
-			v8::Locker v8Locker(isolate);
-			v8::Isolate::Scope isolateScope(isolate);
-			v8::HandleScope hs(isolate);
-			v8::Local<v8::Context> ctx = listener.context.Get(isolate);
+			// Listeners of one context are stored next to each other: enter it and
+			// build the arguments once for the whole run, on the first listener
+			// whose filters match
+			v8::Local<v8::Context> ctx = functionList[i].context.Get(isolate);
 			v8::Context::Scope cs(ctx);
-
-			isolate->CancelTerminateExecution();
-
 			v8::TryCatch eh(isolate);
+			bool filled = false;
 
+			for (; i < count; i++)
+			{
+				if (functionList[i].removed) continue;
+				if (functionList[i].context != ctx) break;
+				if (!functionList[i].filters.empty() && !filters::matches(functionList[i].filters, nativeArgs, nativeArgCount)) continue;
 
-			//	L_DEBUG << "PreCollected: " << "\n";
-			std::pair<unsigned int, v8::Local<v8::Value>*> arguments = collectArguments(isolate);
-			unsigned int argCount = arguments.first;
-			v8::Local<v8::Value>* args = arguments.second;
-			//	L_DEBUG << "Collected: " << argCount << "\n";
-
-			v8::Local<v8::Function> function = listener.function.Get(isolate);
-			v8::MaybeLocal<v8::Value> maybeResult = function->Call(ctx, ctx->Global(), argCount, args);
-			v8::Local<v8::Value> result;
-			if (maybeResult.ToLocal(&result)) {
-				// Capture return value for metamod override_ret if gpMetaGlobals is available
-				if (gpMetaGlobals && !result.IsEmpty()) {
-					// if (result->IsNumber()) {
-					// 	double num = result->NumberValue(ctx).ToChecked();
-					// 	printf("JS returned number: %f\n", num);
-					// } else if (result->IsBoolean()) {
-					// 	bool val = result->BooleanValue(isolate);
-					// 	printf("JS returned boolean: %s\n", val ? "true" : "false");
-					// } else if (result->IsString()) {
-					// 	v8::String::Utf8Value str(isolate, result);
-					// 	printf("JS returned string: %s\n", *str);
-					// }
-					gpMetaGlobals->override_ret = utils::jsToPointer(isolate, result);
-					//if (gpMetaGlobals->override_ret) printf("override_ret = %p, override_ret (char*) = %s\n", (void*)gpMetaGlobals->override_ret, (char *) gpMetaGlobals->override_ret);
+				if (!filled)
+				{
+					if (fillArguments) fillArguments(state, isolate, args);
+					filled = true;
 				}
-			}
 
+				v8::Local<v8::Function> function = functionList[i].function.Get(isolate);
+				uint64_t start = stats::now();
+				watchdog::enter(isolate);
+				v8::MaybeLocal<v8::Value> maybeResult = function->Call(ctx, ctx->Global(), argCount, args);
+				bool overran = watchdog::leave();
+				uint64_t end = stats::now();
+				functionList[i].counter.add(end - start);
+				if (trace::active) trace::record(listenerTraceName(isolate, functionList[i]), trace::Category::Listener, start, end);
+				// Hooks with a return value convert it through handleResult, see returns.hpp
+				v8::Local<v8::Value> result;
+				if (handleResult && maybeResult.ToLocal(&result) && !result->IsUndefined()) handleResult(resultState, isolate, result);
+
+				if (!overran && watchdog::terminating())
+				{
+					// Terminated on behalf of an outer listener, let it unwind there
+					eh.ReThrow();
+					unwinding = true;
+					break;
+				}
 
-			if (eh.HasCaught())
-			{
-				v8::String::Utf8Value str(isolate, eh.Exception());
-				v8::String::Utf8Value stack(isolate, eh.StackTrace(listener.context.Get(isolate)).ToLocalChecked());
+				if (overran)
+				{
+					stats::FunctionInfo info = stats::describe(isolate, function);
+					L_ERROR << "Event listener " << info.name << " (" << info.script << ":" << info.line << ") for " << name
+						<< " exceeded its time budget and was terminated\nstack:\n" << watchdog::stack();
 
-				L_ERROR << "Event handling function in resource: " << *str << "\nstack:\n" << *stack << "\n";
-			}
+					unsigned int strikes = watchdog::strikes();
+					if (strikes && ++functionList[i].overruns >= strikes)
+					{
+						L_ERROR << "Event listener " << info.name << " disabled after " << strikes << " overruns\n";
+						remove_at(i);
+					}
 
-			// If listener set SUPERCEDE, stop processing further listeners
-			if (gpMetaGlobals && gpMetaGlobals->mres == MRES_SUPERCEDE) {
-				break;
+					isolate->CancelTerminateExecution();
+					eh.Reset();
+				}
+				else if (eh.HasCaught())
+				{
+					v8::String::Utf8Value str(isolate, eh.Exception());
+					v8::Local<v8::Value> stackTrace;
+					if (eh.StackTrace(ctx).ToLocal(&stackTrace))
+					{
+						v8::String::Utf8Value stack(isolate, stackTrace);
+						L_ERROR << "Event handling function in resource: " << *str << "\nstack:\n" << *stack << "\n";
+					}
+					else
+					{
+						L_ERROR << "Event handling function in resource: " << *str << "\n";
+					}
+
+					if (eh.HasTerminated()) isolate->CancelTerminateExecution();
+					eh.Reset();
+				}
+
+				// If listener set SUPERCEDE, stop processing further listeners
+				if (gpMetaGlobals && gpMetaGlobals->mres == MRES_SUPERCEDE) {
+					superceded = true;
+					break;
+				}
 			}
 		}
-	}
\ No newline at end of file
+
+		if (--dispatchDepth == 0 && liveCount != functionList.size()) compact();
+	}
@@ -1,13 +1,21 @@
 #pragma once
 #include <unordered_map>
 #include <map>
+#include <type_traits>
+#include <tuple>
 #include "node.h"
 #include "v8.h"
 #include "uv.h"
+#include "auto/event_ids.hpp"
+#include "filters.hpp"
+#include "stats.hpp"
+#include "trace.hpp"
+#include "returns.hpp"
 
-using argument_collector_t = std::function<
-	std::pair<unsigned int, v8::Local<v8::Value>*>(v8::Isolate* isolate)
->;
+// Fills a caller-owned argument array once the isolate is locked and a context is entered
+using argument_filler_t = void (*)(void* state, v8::Isolate* isolate, v8::Local<v8::Value>* args);
+// Receives every value a listener returned, other than undefined
+using result_handler_t = void (*)(void* state, v8::Isolate* isolate, v8::Local<v8::Value> result);
 
 	class event
 	{
@@ -17,24 +25,15 @@ using argument_collector_t = std::function<
 			v8::Isolate* isolate;
 			v8::Global<v8::Context> context;
 			v8::Global<v8::Function> function;
-
-			EventListener_t(const EventListener_t &listener) {
-				isolate = listener.isolate;
-				context.Reset(isolate, listener.context);
-				function.Reset(isolate, listener.function);
-			}
-
-			EventListener_t(
-				v8::Isolate* _isolate,
-				const v8::Global<v8::Context>& _context,
-				const v8::Global<v8::Function>& _function
-			)
-			{
-				isolate = _isolate;
-				v8::Locker locker(isolate);
-				context.Reset(_isolate, _context);
-				function.Reset(_isolate, _function);
-			}
+			// Checked against the raw hook arguments before the function is called
+			filters::FilterList filters;
+			stats::Counter counter;
+			// Interned "name script:line", resolved on the first traced call
+			uint32_t traceName = 0;
+			// Budget overruns, see watchdog.hpp
+			unsigned int overruns = 0;
+			// Removed while a dispatch was walking the list; dropped when it finishes
+			bool removed = false;
 
 			EventListener_t(
 				v8::Isolate* _isolate,
@@ -43,39 +42,14 @@ using argument_collector_t = std::function<
 			)
 			{
 				isolate = _isolate;
-				v8::Locker locker(isolate);
 				context.Reset(_isolate, _context);
 				function.Reset(_isolate, _function);
 			}
 
-			~EventListener_t() {
-				context.Reset();
-				function.Reset();
-			}
-			
-			EventListener_t& operator=(const EventListener_t& other) {
-				if (this != &other) {
-					isolate = other.isolate;
-					context.Reset(isolate, other.context);
-					function.Reset(isolate, other.function);
-				}
-				return *this;
-			}
-
-			EventListener_t& operator=(EventListener_t&& other) noexcept {
-				if (this != &other) {
-					isolate = other.isolate;
-					context = std::move(other.context);
-					function = std::move(other.function);
-					other.isolate = nullptr;
-				}
-				return *this;
-			}
-
-			bool operator==(const EventListener_t& a) const {
-				return (this->function == a.function && this->context == a.context);
-			}
-
+			EventListener_t(const EventListener_t&) = delete;
+			EventListener_t& operator=(const EventListener_t&) = delete;
+			EventListener_t(EventListener_t&& other) noexcept = default;
+			EventListener_t& operator=(EventListener_t&& other) noexcept = default;
 		};
 
 		static void on(const v8::FunctionCallbackInfo<v8::Value>& info);
@@ -83,30 +57,188 @@ using argument_collector_t = std::function<
 		static void fire(const v8::FunctionCallbackInfo<v8::Value>& info);
 		static void register_event(const v8::FunctionCallbackInfo<v8::Value>& info);
 		static bool register_event(const std::string& eventName, const std::string& param_types);
+		static bool register_event(EventId id, const std::string& param_types);
 		static void findAndCall(const std::string& eventName, v8::Local<v8::Value>* args, int argCount);
-		static void findAndCall(const std::string& eventName, argument_collector_t collectArguments);
 		static void clearListeners(const v8::FunctionCallbackInfo<v8::Value>& info);
+		static void clear_all();
+
+		// Native hooks dispatch by id: one indexed load instead of a string hash per call
+		static event* slots[static_cast<unsigned int>(EventId::Count)];
+
+		// Depth of running V8 fast API calls. V8 forbids entering JS from them,
+		// so hooks reached by their engine calls dispatch to no listener and
+		// batch channels grow instead of being delivered early
+		static unsigned int fastCallDepth;
+
+		struct FastCallScope
+		{
+			FastCallScope() { fastCallDepth++; }
+			~FastCallScope() { fastCallDepth--; }
+		};
+
+		static inline void findAndCall(EventId id, v8::Local<v8::Value>* args, int argCount)
+		{
+			event* _event = slots[static_cast<unsigned int>(id)];
+			if (_event) _event->call(args, argCount);
+		}
+
+		// Arguments live in a stack array and are built once per dispatch, only if someone listens:
+		// event::findAndCall<2>(EventId::x, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) { ... });
+		//
+		// Optional trailing arguments:
+		// - event::native(a, b): the raw hook arguments for listener filters, only
+		//   converted when a filtered listener exists
+		// - a handler receiving every non-undefined listener result, such as
+		//   event::returnInto(returnValue) for typed hook return values
+		template<unsigned int N, typename Collector>
+		static inline void findAndCall(EventId id, Collector&& collectArguments)
+		{
+			dispatch<N>(id, collectArguments, NativeArgs<>{}, nullptr);
+		}
+
+		template<unsigned int N, typename Collector, typename ResultHandler>
+		static inline void findAndCall(EventId id, Collector&& collectArguments, ResultHandler&& handleResult)
+		{
+			dispatch<N>(id, collectArguments, NativeArgs<>{}, &handleResult);
+		}
+
+		template<typename... Args>
+		struct NativeArgs
+		{
+			std::tuple<const Args&...> values;
+		};
+
+		template<typename... Args>
+		static inline NativeArgs<Args...> native(const Args&... args)
+		{
+			return { std::tie(args...) };
+		}
+
+		template<unsigned int N, typename Collector, typename... Args>
+		static inline void findAndCall(EventId id, Collector&& collectArguments, NativeArgs<Args...> nativeArgs)
+		{
+			dispatch<N>(id, collectArguments, nativeArgs, nullptr);
+		}
+
+		template<unsigned int N, typename Collector, typename... Args, typename ResultHandler>
+		static inline void findAndCall(EventId id, Collector&& collectArguments, NativeArgs<Args...> nativeArgs, ResultHandler&& handleResult)
+		{
+			dispatch<N>(id, collectArguments, nativeArgs, &handleResult);
+		}
+
+		// Events without arguments that return a value
+		template<typename ResultHandler>
+		static inline void findAndCall(EventId id, v8::Local<v8::Value>* args, int argCount, ResultHandler&& handleResult)
+		{
+			event* _event = slots[static_cast<unsigned int>(id)];
+			if (!_event || _event->liveCount == 0) return;
+
+			_event->call(args, argCount, nullptr, nullptr, resultThunk<std::remove_reference_t<ResultHandler>>, &handleResult);
+		}
+
+		template<typename T>
+		static inline returns::Slot<T> returnInto(T& target)
+		{
+			return { target };
+		}
+
+		static inline bool hasListeners(EventId id)
+		{
+			event* _event = slots[static_cast<unsigned int>(id)];
+			return _event && _event->liveCount > 0;
+		}
 
 		event(const std::string& eventName, const std::string& param_types);
 		event();
 		~event();
 
-		void append(const v8::Local<v8::Context>& context, const v8::Local<v8::Function>& function);
-		void remove(const EventListener_t& eventListener);
+		void append(const v8::Local<v8::Context>& context, const v8::Local<v8::Function>& function, filters::FilterList filters = {});
+		// Removes the listeners of a context, or only the given function when it is not empty
+		void remove(v8::Isolate* isolate, const v8::Local<v8::Context>& context, const v8::Local<v8::Function>& function);
 		void remove_all();
-		void call(v8::Local<v8::Value>* args, int argCount);
-		void call(argument_collector_t collectArguments);
+		// nativeArgs, when given, are matched against listener filters before V8 is entered
+		void call(v8::Local<v8::Value>* args, int argCount, argument_filler_t fillArguments = nullptr, void* state = nullptr,
+			result_handler_t handleResult = nullptr, void* resultState = nullptr,
+			const filters::Value* nativeArgs = nullptr, unsigned int nativeArgCount = 0);
 
 		std::string get_param_types()
 		{
 			return paramTypes;
 		}
 
+		const std::string& get_name() const
+		{
+			return name;
+		}
+
+		const std::vector<EventListener_t>& get_listeners() const
+		{
+			return functionList;
+		}
+
+		void reset_counters();
+
+		EventId id = EventId::Count;
+		// Whole dispatches, listeners are counted separately
+		stats::Counter counter;
+		uint32_t traceName = 0;
+
 	private:
+		template<typename ResultHandler>
+		static void resultThunk(void* state, v8::Isolate* isolate, v8::Local<v8::Value> result)
+		{
+			(*static_cast<ResultHandler*>(state))(isolate, result);
+		}
+
+		template<unsigned int N, typename Collector, typename HandlerPointer, typename... Args>
+		static inline void dispatch(EventId id, Collector& collectArguments, const NativeArgs<Args...>& nativeArgs, HandlerPointer handleResult)
+		{
+			static_assert(N > 0, "use findAndCall(id, nullptr, 0) for events without arguments");
+
+			event* _event = slots[static_cast<unsigned int>(id)];
+			if (!_event || _event->liveCount == 0) return;
+
+			filters::Value values[sizeof...(Args) > 0 ? sizeof...(Args) : 1];
+			const filters::Value* nativeValues = nullptr;
+			if constexpr (sizeof...(Args) > 0)
+			{
+				if (_event->filteredCount > 0)
+				{
+					std::apply([&values](const Args&... raw) {
+						unsigned int index = 0;
+						((values[index++] = filters::Value::from(raw)), ...);
+					}, nativeArgs.values);
+					nativeValues = values;
+				}
+			}
+
+			result_handler_t resultHandler = nullptr;
+			void* resultState = nullptr;
+			if constexpr (!std::is_same_v<HandlerPointer, std::nullptr_t>)
+			{
+				resultHandler = resultThunk<std::remove_pointer_t<HandlerPointer>>;
+				resultState = handleResult;
+			}
+
+			v8::Local<v8::Value> args[N];
+			_event->call(args, N, [](void* state, v8::Isolate* isolate, v8::Local<v8::Value>* args) {
+				(*static_cast<Collector*>(state))(isolate, args);
+			}, &collectArguments, resultHandler, resultState, nativeValues, sizeof...(Args));
+		}
+
+		void remove_at(size_t index);
+		void compact();
+
 		std::string name;
 		std::string paramTypes;
+		// Listeners are never copied for a dispatch: removals during a call only set
+		// `removed`, appends land past the dispatched range, and the list is
+		// compacted once the outermost call() returns
 		std::vector<EventListener_t> functionList;
-		v8::Global<v8::Function> listener;
+		unsigned int liveCount = 0;
+		// Live listeners with filters; raw arguments are ignored while this is 0
+		unsigned int filteredCount = 0;
+		unsigned int dispatchDepth = 0;
 	};
 
 	typedef std::unordered_map<std::string, event*> eventsContainer;
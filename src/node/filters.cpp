@@ -0,0 +1,134 @@
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include "filters.hpp"
+#include "utils.hpp"
+#include "util/convert.hpp"
+
+extern globalvars_t* gpGlobals;
+
+namespace filters
+{
+	static bool fail(v8::Isolate* isolate, const char* message)
+	{
+		isolate->ThrowException(v8::Exception::TypeError(convert::str2js(isolate, message)));
+		return false;
+	}
+
+	static bool parseOne(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value, Filter& filter)
+	{
+		if (!value->IsObject()) return fail(isolate, "Event filter must be an object or an array of objects");
+
+		v8::Local<v8::Object> object = value.As<v8::Object>();
+		v8::Local<v8::Value> arg = object->Get(context, convert::str2js(isolate, "arg")).ToLocalChecked();
+		if (!arg->IsUint32()) return fail(isolate, "Event filter needs a numeric 'arg' (listener argument index)");
+		filter.arg = arg.As<v8::Uint32>()->Value();
+
+		struct { const char* key; Filter::Op op; } ops[] = {
+			{ "equals", Filter::Op::Equals },
+			{ "prefix", Filter::Op::Prefix },
+			{ "mask", Filter::Op::Mask },
+			{ "classname", Filter::Op::Classname }
+		};
+
+		for (auto& candidate : ops)
+		{
+			v8::Local<v8::Value> operand = object->Get(context, convert::str2js(isolate, candidate.key)).ToLocalChecked();
+			if (operand->IsUndefined()) continue;
+
+			filter.op = candidate.op;
+			if (operand->IsNumber())
+			{
+				filter.isNumber = true;
+				filter.number = operand.As<v8::Number>()->Value();
+			}
+			else if (operand->IsString())
+			{
+				filter.text = utils::js_to_string(isolate, operand);
+			}
+			else
+			{
+				return fail(isolate, "Event filter operand must be a number or a string");
+			}
+
+			if (filter.op == Filter::Op::Mask)
+			{
+				// Signed or unsigned 32-bit, so FL_* high bits can be written either way
+				if (!filter.isNumber || std::trunc(filter.number) != filter.number || filter.number < INT32_MIN || filter.number > UINT32_MAX)
+				{
+					return fail(isolate, "Event filter 'mask' must be a 32-bit integer");
+				}
+				filter.mask = static_cast<uint32_t>(static_cast<int64_t>(filter.number));
+			}
+			if ((filter.op == Filter::Op::Prefix || filter.op == Filter::Op::Classname) && filter.isNumber)
+			{
+				return fail(isolate, "Event filter 'prefix' and 'classname' must be strings");
+			}
+			return true;
+		}
+
+		return fail(isolate, "Event filter needs one of: equals, prefix, mask, classname");
+	}
+
+	bool parse(v8::Isolate* isolate, v8::Local<v8::Value> value, FilterList& filters)
+	{
+		v8::Local<v8::Context> context = isolate->GetCurrentContext();
+
+		if (!value->IsArray())
+		{
+			filters.emplace_back();
+			return parseOne(isolate, context, value, filters.back());
+		}
+
+		v8::Local<v8::Array> list = value.As<v8::Array>();
+		for (uint32_t i = 0; i < list->Length(); i++)
+		{
+			filters.emplace_back();
+			if (!parseOne(isolate, context, list->Get(context, i).ToLocalChecked(), filters.back())) return false;
+		}
+		return true;
+	}
+
+	static const char* classnameOf(const edict_t* entity)
+	{
+		if (!entity || entity->free || !entity->v.classname) return "";
+		return gpGlobals->pStringBase + entity->v.classname;
+	}
+
+	static bool matchOne(const Filter& filter, const Value& value)
+	{
+		switch (filter.op)
+		{
+		case Filter::Op::Equals:
+			if (filter.isNumber)
+			{
+				if (value.type == Value::Type::Int) return value.i == filter.number;
+				if (value.type == Value::Type::Float) return value.f == static_cast<float>(filter.number);
+				if (value.type == Value::Type::Entity) return value.e && (*g_engfuncs.pfnIndexOfEdict)(value.e) == filter.number;
+				return false;
+			}
+			return value.type == Value::Type::String && value.s && filter.text == value.s;
+
+		case Filter::Op::Prefix:
+			return value.type == Value::Type::String && value.s && strncmp(value.s, filter.text.c_str(), filter.text.size()) == 0;
+
+		case Filter::Op::Mask:
+			return value.type == Value::Type::Int && (static_cast<uint32_t>(value.i) & filter.mask) != 0;
+
+		case Filter::Op::Classname:
+			return value.type == Value::Type::Entity && filter.text == classnameOf(value.e);
+		}
+		return false;
+	}
+
+	bool matches(const FilterList& filters, const Value* values, unsigned int valueCount)
+	{
+		if (!values) return true;
+
+		for (const Filter& filter : filters)
+		{
+			if (filter.arg >= valueCount || !matchOne(filter, values[filter.arg])) return false;
+		}
+		return true;
+	}
+}
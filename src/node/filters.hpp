@@ -0,0 +1,105 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <type_traits>
+#include "v8.h"
+#include "extdll.h"
+
+// Native listener predicates: nodemod.on(event, filter, callback).
+//
+// A filter is checked against the raw hook arguments before V8 is entered,
+// so a listener that would ignore the call costs no JS invocation:
+//
+//   { arg: 2, prefix: "weapons/" }    string argument starts with
+//   { arg: 1, equals: 5 }             number, string or entity index equals
+//   { arg: 3, mask: 0x4 }             (value & mask) != 0
+//   { arg: 0, classname: "player" }   entity argument classname equals
+//
+// An array of filters must all match. `arg` is the listener argument index.
+// Events fired without raw arguments (nodemod.fire, custom hooks) always match.
+namespace filters
+{
+	struct Value
+	{
+		enum class Type : uint8_t
+		{
+			None,
+			Int,
+			Float,
+			String,
+			Entity,
+			Vector
+		};
+
+		Type type = Type::None;
+		union
+		{
+			int32_t i;
+			float f;
+			const char* s;
+			const edict_t* e;
+			const float* v;
+		};
+
+		Value() : i(0) {}
+
+		template<typename T>
+		static Value from(const T& value)
+		{
+			using U = std::decay_t<T>;
+			Value result;
+			if constexpr (std::is_floating_point_v<U>)
+			{
+				result.type = Type::Float;
+				result.f = static_cast<float>(value);
+			}
+			else if constexpr (std::is_integral_v<U> || std::is_enum_v<U>)
+			{
+				result.type = Type::Int;
+				result.i = static_cast<int32_t>(value);
+			}
+			else if constexpr (std::is_same_v<U, const char*> || std::is_same_v<U, char*>)
+			{
+				result.type = Type::String;
+				result.s = value;
+			}
+			else if constexpr (std::is_same_v<U, const edict_t*> || std::is_same_v<U, edict_t*>)
+			{
+				result.type = Type::Entity;
+				result.e = value;
+			}
+			else if constexpr (std::is_same_v<U, const float*> || std::is_same_v<U, float*>)
+			{
+				result.type = Type::Vector;
+				result.v = value;
+			}
+			return result;
+		}
+	};
+
+	struct Filter
+	{
+		enum class Op : uint8_t
+		{
+			Equals,
+			Prefix,
+			Mask,
+			Classname
+		};
+
+		unsigned int arg = 0;
+		Op op = Op::Equals;
+		bool isNumber = false;
+		double number = 0;
+		// Op::Mask operand, the 32 bits of `number`
+		uint32_t mask = 0;
+		std::string text;
+	};
+
+	using FilterList = std::vector<Filter>;
+
+	// Throws a JS TypeError and returns false for a malformed filter
+	bool parse(v8::Isolate* isolate, v8::Local<v8::Value> value, FilterList& filters);
+	bool matches(const FilterList& filters, const Value* values, unsigned int valueCount);
+}
@@ -0,0 +1,228 @@
+#include <cstring>
+#include <vector>
+#include "messages.hpp"
+#include "events.hpp"
+#include "utils.hpp"
+#include "common/logger.hpp"
+#include "structures/structures.hpp"
+#include "lib/hooks.hpp"
+#include "enginecallback.h"
+
+namespace messages
+{
+	bool replaying = false;
+
+	static bool recording = false;
+	static bool dispatching = false;
+
+	static int dest;
+	static int type;
+	static bool hasOrigin;
+	static float origin[3];
+	static edict_t* entity;
+	static unsigned int fieldCount;
+	static std::vector<uint8_t> buffer;
+	static std::vector<uint8_t> rewritten;
+
+	static void put(const void* data, size_t size)
+	{
+		const uint8_t* bytes = static_cast<const uint8_t*>(data);
+		buffer.insert(buffer.end(), bytes, bytes + size);
+	}
+
+	bool begin(int msg_dest, int msg_type, const float* pOrigin, edict_t* ed)
+	{
+		// Messages sent by engMessage listeners go straight through
+		if (dispatching || !event::hasListeners(EventId::engMessage)) return false;
+
+		// Removing the last listener mid-message must not turn off the Write*
+		// and MessageEnd hooks, or the superceded MessageBegin is never replayed
+		if (!recording) hooks::acquire(EventId::engMessage);
+		recording = true;
+		dest = msg_dest;
+		type = msg_type;
+		hasOrigin = pOrigin != nullptr;
+		if (hasOrigin) memcpy(origin, pOrigin, sizeof(origin));
+		entity = ed;
+		fieldCount = 0;
+		buffer.clear();
+		return true;
+	}
+
+	bool writeInt(Field field, int value)
+	{
+		if (!recording) return false;
+
+		int32_t data = value;
+		buffer.push_back(static_cast<uint8_t>(field));
+		put(&data, sizeof(data));
+		fieldCount++;
+		return true;
+	}
+
+	bool writeFloat(Field field, float value)
+	{
+		if (!recording) return false;
+
+		buffer.push_back(static_cast<uint8_t>(field));
+		put(&value, sizeof(value));
+		fieldCount++;
+		return true;
+	}
+
+	bool writeString(const char* value)
+	{
+		if (!recording) return false;
+
+		if (!value) value = "";
+		buffer.push_back(static_cast<uint8_t>(Field::String));
+		put(value, strlen(value) + 1);
+		fieldCount++;
+		return true;
+	}
+
+	// Checks the whole buffer first so a bad rewrite never leaves a half sent message
+	static bool validate(const uint8_t* data, size_t size)
+	{
+		size_t offset = 0;
+		while (offset < size)
+		{
+			Field field = static_cast<Field>(data[offset++]);
+			switch (field)
+			{
+			case Field::Byte:
+			case Field::Char:
+			case Field::Short:
+			case Field::Long:
+			case Field::Entity:
+			case Field::Angle:
+			case Field::Coord:
+				if (size - offset < 4) return false;
+				offset += 4;
+				break;
+			case Field::String:
+			{
+				const void* terminator = memchr(data + offset, 0, size - offset);
+				if (!terminator) return false;
+				offset = static_cast<const uint8_t*>(terminator) - data + 1;
+				break;
+			}
+			default:
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static void send(const uint8_t* data, size_t size)
+	{
+		replaying = true;
+		MESSAGE_BEGIN(dest, type, hasOrigin ? origin : nullptr, entity);
+
+		size_t offset = 0;
+		while (offset < size)
+		{
+			Field field = static_cast<Field>(data[offset++]);
+			if (field == Field::String)
+			{
+				const char* value = reinterpret_cast<const char*>(data + offset);
+				WRITE_STRING(value);
+				offset += strlen(value) + 1;
+				continue;
+			}
+
+			int32_t intValue;
+			float floatValue;
+			memcpy(&intValue, data + offset, sizeof(intValue));
+			memcpy(&floatValue, data + offset, sizeof(floatValue));
+			offset += 4;
+
+			switch (field)
+			{
+			case Field::Byte: WRITE_BYTE(intValue); break;
+			case Field::Char: WRITE_CHAR(intValue); break;
+			case Field::Short: WRITE_SHORT(intValue); break;
+			case Field::Long: WRITE_LONG(intValue); break;
+			case Field::Entity: WRITE_ENTITY(intValue); break;
+			case Field::Angle: WRITE_ANGLE(floatValue); break;
+			case Field::Coord: WRITE_COORD(floatValue); break;
+			default: break;
+			}
+		}
+
+		MESSAGE_END();
+		replaying = false;
+	}
+
+	bool end()
+	{
+		if (!recording) return false;
+		recording = false;
+		hooks::release(EventId::engMessage);
+
+		bool block = false;
+		bool rewrite = false;
+		std::vector<v8::Global<v8::ArrayBuffer>> views;
+		v8::Isolate* viewIsolate = nullptr;
+
+		dispatching = true;
+		event::findAndCall<6>(EventId::engMessage, [&](v8::Isolate* isolate, v8::Local<v8::Value>* v8_args) {
+			auto store = v8::ArrayBuffer::NewBackingStore(buffer.data(), buffer.size(), v8::BackingStore::EmptyDeleter, nullptr);
+			v8::Local<v8::ArrayBuffer> view = v8::ArrayBuffer::New(isolate, std::move(store));
+			views.emplace_back(isolate, view);
+			viewIsolate = isolate;
+
+			v8_args[0] = v8::Integer::New(isolate, dest);
+			v8_args[1] = v8::Integer::New(isolate, type);
+			if (hasOrigin) v8_args[2] = utils::floatArrayToJS(isolate, origin, 3);
+			else v8_args[2] = v8::Null(isolate);
+			v8_args[3] = structures::wrapEntity(isolate, entity);
+			v8_args[4] = view;
+			v8_args[5] = v8::Integer::NewFromUnsigned(isolate, fieldCount);
+		}, [&](v8::Isolate* isolate, v8::Local<v8::Value> result) {
+			if (result->IsFalse())
+			{
+				block = true;
+			}
+			else if (result->IsArrayBufferView())
+			{
+				v8::Local<v8::ArrayBufferView> view = result.As<v8::ArrayBufferView>();
+				rewritten.resize(view->ByteLength());
+				view->CopyContents(rewritten.data(), rewritten.size());
+				rewrite = true;
+			}
+			else if (result->IsArrayBuffer())
+			{
+				v8::Local<v8::ArrayBuffer> view = result.As<v8::ArrayBuffer>();
+				rewritten.resize(view->ByteLength());
+				if (view->Data()) memcpy(rewritten.data(), view->Data(), rewritten.size());
+				rewrite = true;
+			}
+		});
+		dispatching = false;
+
+		// The views point into the reusable buffer, JS must not keep them
+		if (viewIsolate)
+		{
+			v8::Locker locker(viewIsolate);
+			v8::HandleScope scope(viewIsolate);
+			for (auto& view : views)
+			{
+				view.Get(viewIsolate)->Detach(v8::Local<v8::Value>()).Check();
+				view.Reset();
+			}
+		}
+
+		if (block) return true;
+
+		if (rewrite && !validate(rewritten.data(), rewritten.size()))
+		{
+			L_ERROR << "engMessage: malformed buffer returned for message " << type << ", sending the original\n";
+			rewrite = false;
+		}
+
+		if (rewrite) send(rewritten.data(), rewritten.size());
+		else send(buffer.data(), buffer.size());
+		return true;
+	}
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <cstdint>
+#include "extdll.h"
+
+// Native user message assembler.
+//
+// While `engMessage` has listeners, MessageBegin/Write*/MessageEnd are kept
+// from the engine and recorded into one reusable buffer. MessageEnd fires a
+// single engMessage(dest, type, origin, entity, buffer, fieldCount) with a
+// zero-copy ArrayBuffer over that buffer (detached after the event) and then
+// sends the message for real. A listener returning false blocks it;
+// returning an ArrayBuffer or view in the same encoding sends that instead.
+//
+// Encoding: a field tag byte followed by int32 (Byte, Char, Short, Long,
+// Entity), float32 (Angle, Coord) or a NUL terminated string, little endian.
+//
+// The replay goes through g_engfuncs, the only engine table a plugin gets, so
+// nodemod's own pre and post hooks skip it via `replaying`. Other metamod
+// plugins hooking these functions are not covered: while engMessage has
+// listeners they see each message twice, first as the superceded calls that
+// were recorded and then as the replay that reaches the engine.
+namespace messages
+{
+	enum class Field : uint8_t
+	{
+		Byte = 1,
+		Char,
+		Short,
+		Long,
+		Angle,
+		Coord,
+		String,
+		Entity
+	};
+
+	// Set while the assembled message is sent to the engine
+	extern bool replaying;
+
+	// These return true when the call was recorded and must be kept from the engine
+	bool begin(int msg_dest, int msg_type, const float* pOrigin, edict_t* ed);
+	bool writeInt(Field field, int value);
+	bool writeFloat(Field field, float value);
+	bool writeString(const char* value);
+	bool end();
+}
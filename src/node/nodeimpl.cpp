@@ -5,7 +5,16 @@
 #include "nodeimpl.hpp"
 #include "resource.hpp"
 #include "events.hpp"
+#include "utils.hpp"
+#include "batch.hpp"
+#include "trace.hpp"
+#include "snapshot.hpp"
+#include "spatial.hpp"
+#include "cvars.hpp"
+#include "watchdog.hpp"
+#include "common/logger.hpp"
 #include "structures/structures.hpp"
+#include "structures/pool.hpp"
 #include <hlsdk/engine/custom.h>
 
 #include <sstream>
@@ -45,7 +54,7 @@ bool isRun = false;
 
 void continueHandler(const v8::FunctionCallbackInfo<v8::Value> &info)
 {
-	v8::Locker locker(info.GetIsolate());
+	V8_ASSERT_LOCKED(info.GetIsolate());
 	v8::HandleScope scope(info.GetIsolate());
 	auto context = info.GetIsolate()->GetCurrentContext();
 
@@ -88,18 +97,42 @@ NodeImpl::~NodeImpl()
 {
 }
 
+// Leaves the watchdog around a Tick phase; an overrun is logged and its termination cleared
+void NodeImpl::leaveWatchdog(const char* phase)
+{
+	if (!watchdog::leave()) return;
+
+	L_ERROR << "A " << phase << " exceeded its time budget and was terminated\nstack:\n" << watchdog::stack();
+	v8Isolate->CancelTerminateExecution();
+}
+
 void NodeImpl::Tick()
 {
+	trace::Scope tickScope(trace::Tick, trace::Category::Frame);
 	v8::Locker locker(v8Isolate);
 	v8::Isolate::Scope isolateScope(v8Isolate);
 	v8::HandleScope hs(v8Isolate);
 
+	structures::resetWrapperPools(v8Isolate);
+	structures::sweepVectorViews(v8Isolate);
+
 	{
 		v8::Local<v8::Context> _context = resource->GetContext().Get(v8Isolate);
 		v8::Context::Scope contextScope(_context);
 
-		uv_run(nodeLoop->GetLoop(), UV_RUN_NOWAIT);
-		v8Isolate->PerformMicrotaskCheckpoint();
+		// Timers, I/O callbacks and microtasks run under the same budget as listeners
+		{
+			trace::Scope uvScope(trace::UvRun, trace::Category::Frame);
+			watchdog::enter(v8Isolate);
+			uv_run(nodeLoop->GetLoop(), UV_RUN_NOWAIT);
+			leaveWatchdog("uv loop callback");
+		}
+		{
+			trace::Scope microtaskScope(trace::Microtasks, trace::Category::Frame);
+			watchdog::enter(v8Isolate);
+			v8Isolate->PerformMicrotaskCheckpoint();
+			leaveWatchdog("microtask");
+		}
 	}
 }
 
@@ -153,6 +186,31 @@ void NodeImpl::Initialize()
 	nodeData.reset(isolateData);
 }
 
+void NodeImpl::ServerActivate(edict_t* edictList, int edictCount, int clientMax)
+{
+	v8::Locker locker(v8Isolate);
+	v8::Isolate::Scope isolateScope(v8Isolate);
+	v8::HandleScope hs(v8Isolate);
+	v8::Local<v8::Context> _context = resource->GetContext().Get(v8Isolate);
+	v8::Context::Scope contextScope(_context);
+
+	structures::activateEntityCache(v8Isolate, edictList, edictCount, clientMax);
+}
+
+// Wrappers made while the next map spawns must survive its ServerActivate,
+// so everything tied to the old map's edicts goes here
+void NodeImpl::ServerDeactivate()
+{
+	v8::Locker locker(v8Isolate);
+	v8::Isolate::Scope isolateScope(v8Isolate);
+	v8::HandleScope hs(v8Isolate);
+	v8::Local<v8::Context> _context = resource->GetContext().Get(v8Isolate);
+	v8::Context::Scope contextScope(_context);
+
+	structures::clearEntityCache(v8Isolate);
+	spatial::clear();
+}
+
 bool NodeImpl::loadScript()
 {
 	resource = new Resource("main", ".");
@@ -183,6 +241,10 @@ bool NodeImpl::reload()
 			v8::Locker locker(v8Isolate);
 			v8::Isolate::Scope isolateScope(v8Isolate);
 			resource->Stop();
+			structures::clearEntityCache(v8Isolate);
+			structures::clearWrapperPools();
+			snapshot::clear();
+			cvars::clear();
 		}
 		delete resource;
 		resource = nullptr;
@@ -194,7 +256,8 @@ bool NodeImpl::reload()
 				pair.second->remove_all();
 			}
 		}
-		events.clear();
+		event::clear_all();
+		batch::clear();
 		
 		// Clear Ham hooks to restore vtables and free trampolines
 		{
@@ -247,12 +310,12 @@ bool NodeImpl::reload()
 		int edictCount = gpGlobals->maxEntities;
 		int clientMax = gpGlobals->maxClients;
 
-		event::findAndCall("dllServerActivate", [=](v8::Isolate* isolate) {
-			v8::Local<v8::Value>* args = new v8::Local<v8::Value>[3];
+		ServerActivate(worldspawn, edictCount, clientMax);
+
+		event::findAndCall<3>(EventId::dllServerActivate, [&](v8::Isolate* isolate, v8::Local<v8::Value>* args) {
 			args[0] = structures::wrapEntity(isolate, worldspawn);
 			args[1] = v8::Number::New(isolate, edictCount);
 			args[2] = v8::Number::New(isolate, clientMax);
-			return std::pair<unsigned int, v8::Local<v8::Value>*>(3, args);
 		});
 
 		// Fire dllClientConnect + dllClientPutInServer for each connected player
@@ -269,10 +332,8 @@ bool NodeImpl::reload()
 				if (isSpectator) {
 					spectatorCount++;
 					// Fire dllSpectatorConnect for spectators
-					event::findAndCall("dllSpectatorConnect", [=](v8::Isolate* isolate) {
-						v8::Local<v8::Value>* args = new v8::Local<v8::Value>[1];
+					event::findAndCall<1>(EventId::dllSpectatorConnect, [&](v8::Isolate* isolate, v8::Local<v8::Value>* args) {
 						args[0] = structures::wrapEntity(isolate, player);
-						return std::pair<unsigned int, v8::Local<v8::Value>*>(1, args);
 					});
 				} else {
 					playerCount++;
@@ -284,29 +345,23 @@ bool NodeImpl::reload()
 					const char* playerAddress = "reload";
 
 					// Fire dllClientConnect (already connected, so this is informational)
-					event::findAndCall("dllClientConnect", [=](v8::Isolate* isolate) {
-						v8::Local<v8::Value>* args = new v8::Local<v8::Value>[4];
+					event::findAndCall<4>(EventId::dllClientConnect, [&](v8::Isolate* isolate, v8::Local<v8::Value>* args) {
 						args[0] = structures::wrapEntity(isolate, player);
 						args[1] = v8::String::NewFromUtf8(isolate, playerName ? playerName : "").ToLocalChecked();
 						args[2] = v8::String::NewFromUtf8(isolate, playerAddress).ToLocalChecked();
 						args[3] = v8::String::NewFromUtf8(isolate, "").ToLocalChecked(); // rejectReason
-						return std::pair<unsigned int, v8::Local<v8::Value>*>(4, args);
 					});
 
 					// Fire dllClientUserInfoChanged (player info like name, model, etc.)
 					char* infobuffer = (*g_engfuncs.pfnGetInfoKeyBuffer)(player);
-					event::findAndCall("dllClientUserInfoChanged", [=](v8::Isolate* isolate) {
-						v8::Local<v8::Value>* args = new v8::Local<v8::Value>[2];
+					event::findAndCall<2>(EventId::dllClientUserInfoChanged, [&](v8::Isolate* isolate, v8::Local<v8::Value>* args) {
 						args[0] = structures::wrapEntity(isolate, player);
 						args[1] = v8::String::NewFromUtf8(isolate, infobuffer ? infobuffer : "").ToLocalChecked();
-						return std::pair<unsigned int, v8::Local<v8::Value>*>(2, args);
 					});
 
 					// Fire dllClientPutInServer
-					event::findAndCall("dllClientPutInServer", [=](v8::Isolate* isolate) {
-						v8::Local<v8::Value>* args = new v8::Local<v8::Value>[1];
+					event::findAndCall<1>(EventId::dllClientPutInServer, [&](v8::Isolate* isolate, v8::Local<v8::Value>* args) {
 						args[0] = structures::wrapEntity(isolate, player);
-						return std::pair<unsigned int, v8::Local<v8::Value>*>(1, args);
 					});
 				}
 			}
@@ -323,11 +378,9 @@ bool NodeImpl::reload()
 				customizationCount++;
 				// Create a non-const copy for the event
 				customization_t customCopy = custom;
-				event::findAndCall("dllPlayerCustomization", [=](v8::Isolate* isolate) mutable {
-					v8::Local<v8::Value>* args = new v8::Local<v8::Value>[2];
+				event::findAndCall<2>(EventId::dllPlayerCustomization, [&](v8::Isolate* isolate, v8::Local<v8::Value>* args) {
 					args[0] = structures::wrapEntity(isolate, player);
 					args[1] = structures::wrapCustomization(isolate, &customCopy);
-					return std::pair<unsigned int, v8::Local<v8::Value>*>(2, args);
 				});
 			}
 		}
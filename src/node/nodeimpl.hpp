@@ -46,11 +46,15 @@ public:
 	}
 
 	void Tick();
+	void ServerActivate(edict_t* edictList, int edictCount, int clientMax);
+	void ServerDeactivate();
 	void Stop();
 	bool loadScript();
 	bool reload();
 
 private:
+	void leaveWatchdog(const char* phase);
+
 	struct IsolateDataDeleter
 	{
 		using pointer = node::IsolateData*;
@@ -0,0 +1,190 @@
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "query.hpp"
+#include "utils.hpp"
+#include "util/convert.hpp"
+#include "extdll.h"
+#include "structures/structures.hpp"
+
+extern globalvars_t* gpGlobals;
+extern enginefuncs_t g_engfuncs;
+
+namespace query
+{
+	struct Criteria
+	{
+		bool hasClassname = false;
+		std::string classname;
+		bool hasFlags = false;
+		int flagsMask = 0;
+		bool hasMovetype = false;
+		int movetype = 0;
+		bool hasSolid = false;
+		int solid = 0;
+		bool hasOwner = false;
+		const edict_t* owner = nullptr;
+		bool hasBox = false;
+		vec3_t mins;
+		vec3_t maxs;
+		bool countOnly = false;
+	};
+
+	// Reused between calls, the result is copied out
+	static std::vector<int32_t> matches;
+
+	static bool fail(v8::Isolate* isolate, const char* message)
+	{
+		isolate->ThrowException(v8::Exception::TypeError(convert::str2js(isolate, message)));
+		return false;
+	}
+
+	// False with the exception pending when a getter or Proxy trap throws
+	static bool field(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Object> object, const char* name, v8::Local<v8::Value>& value)
+	{
+		return object->Get(context, convert::str2js(isolate, name)).ToLocal(&value);
+	}
+
+	static bool readInt(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Object> object, const char* name, bool& present, int& target)
+	{
+		v8::Local<v8::Value> value;
+		if (!field(isolate, context, object, name, value)) return false;
+		if (value->IsUndefined()) return true;
+		if (!value->IsNumber()) return fail(isolate, "nodemod.query: flagsMask, movetype and solid must be numbers");
+
+		present = true;
+		target = value->Int32Value(context).FromMaybe(0);
+		return true;
+	}
+
+	static bool isVector(v8::Local<v8::Value> value)
+	{
+		return value->IsFloat32Array() || value->IsArray();
+	}
+
+	static bool parse(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value, Criteria& criteria)
+	{
+		if (!value->IsObject()) return fail(isolate, "nodemod.query expects a criteria object");
+		v8::Local<v8::Object> object = value.As<v8::Object>();
+
+		v8::Local<v8::Value> classname;
+		if (!field(isolate, context, object, "classname", classname)) return false;
+		if (!classname->IsUndefined())
+		{
+			if (!classname->IsString()) return fail(isolate, "nodemod.query: classname must be a string");
+			criteria.hasClassname = true;
+			criteria.classname = utils::js_to_string(isolate, classname);
+		}
+
+		if (!readInt(isolate, context, object, "flagsMask", criteria.hasFlags, criteria.flagsMask)) return false;
+		if (!readInt(isolate, context, object, "movetype", criteria.hasMovetype, criteria.movetype)) return false;
+		if (!readInt(isolate, context, object, "solid", criteria.hasSolid, criteria.solid)) return false;
+
+		v8::Local<v8::Value> owner;
+		if (!field(isolate, context, object, "owner", owner)) return false;
+		if (!owner->IsUndefined())
+		{
+			criteria.hasOwner = true;
+			if (owner->IsNumber())
+			{
+				// 0 is ownerless like null; any other index must be a live entity, a
+				// null owner here would silently match every ownerless entity
+				double index = owner.As<v8::Number>()->Value();
+				if (index != 0)
+				{
+					const edict_t* edicts = (*g_engfuncs.pfnPEntityOfEntIndex)(0);
+					if (!edicts || !gpGlobals || std::trunc(index) != index || index < 1 || index >= gpGlobals->maxEntities || edicts[static_cast<int>(index)].free)
+					{
+						return fail(isolate, "nodemod.query: owner index is not a live entity");
+					}
+					criteria.owner = edicts + static_cast<int>(index);
+				}
+			}
+			else if (!owner->IsNull())
+			{
+				criteria.owner = structures::unwrapEntity(isolate, owner);
+				if (!criteria.owner) return fail(isolate, "nodemod.query: owner must be an entity, an index or null");
+			}
+		}
+
+		v8::Local<v8::Value> box;
+		if (!field(isolate, context, object, "bbox", box)) return false;
+		if (!box->IsUndefined())
+		{
+			if (!box->IsObject()) return fail(isolate, "nodemod.query: bbox must be { mins, maxs }");
+			v8::Local<v8::Value> mins;
+			v8::Local<v8::Value> maxs;
+			if (!field(isolate, context, box.As<v8::Object>(), "mins", mins) || !field(isolate, context, box.As<v8::Object>(), "maxs", maxs)) return false;
+			if (!isVector(mins) || !isVector(maxs)) return fail(isolate, "nodemod.query: bbox mins and maxs must be 3 element arrays");
+
+			criteria.hasBox = true;
+			structures::writeVector(isolate, mins, criteria.mins);
+			structures::writeVector(isolate, maxs, criteria.maxs);
+		}
+
+		v8::Local<v8::Value> count;
+		if (!field(isolate, context, object, "count", count)) return false;
+		criteria.countOnly = count->BooleanValue(isolate);
+		return true;
+	}
+
+	static inline bool overlaps(const entvars_t& vars, const Criteria& criteria)
+	{
+		// No early outs, the six compares are cheaper than the branches
+		return (vars.absmin[0] <= criteria.maxs[0]) & (vars.absmax[0] >= criteria.mins[0]) &
+			(vars.absmin[1] <= criteria.maxs[1]) & (vars.absmax[1] >= criteria.mins[1]) &
+			(vars.absmin[2] <= criteria.maxs[2]) & (vars.absmax[2] >= criteria.mins[2]);
+	}
+
+	static void collect(const Criteria& criteria)
+	{
+		matches.clear();
+		if (!gpGlobals || gpGlobals->maxEntities <= 0) return;
+
+		const edict_t* edicts = (*g_engfuncs.pfnPEntityOfEntIndex)(0);
+		if (!edicts) return;
+
+		const char* classname = criteria.classname.c_str();
+		for (int i = 1; i < gpGlobals->maxEntities; i++)
+		{
+			const edict_t* entity = edicts + i;
+
+			// Slots past the last allocated edict are zeroed and have no private data
+			if (entity->free || !entity->pvPrivateData) continue;
+
+			const entvars_t& vars = entity->v;
+			if (criteria.hasMovetype && vars.movetype != criteria.movetype) continue;
+			if (criteria.hasSolid && vars.solid != criteria.solid) continue;
+			if (criteria.hasFlags && !(vars.flags & criteria.flagsMask)) continue;
+			if (criteria.hasOwner && vars.owner != criteria.owner) continue;
+			if (criteria.hasBox && !overlaps(vars, criteria)) continue;
+			if (criteria.hasClassname && strcmp(gpGlobals->pStringBase + vars.classname, classname) != 0) continue;
+
+			matches.push_back(i);
+		}
+	}
+
+	void run(const v8::FunctionCallbackInfo<v8::Value>& info)
+	{
+		v8::Isolate* isolate = info.GetIsolate();
+		V8_ASSERT_LOCKED(isolate);
+		v8::HandleScope scope(isolate);
+		v8::Local<v8::Context> context = isolate->GetCurrentContext();
+
+		Criteria criteria;
+		if (!parse(isolate, context, info[0], criteria)) return;
+
+		collect(criteria);
+
+		if (criteria.countOnly)
+		{
+			info.GetReturnValue().Set(v8::Integer::New(isolate, static_cast<int32_t>(matches.size())));
+			return;
+		}
+
+		v8::Local<v8::ArrayBuffer> buffer = v8::ArrayBuffer::New(isolate, matches.size() * sizeof(int32_t));
+		if (!matches.empty()) memcpy(buffer->Data(), matches.data(), matches.size() * sizeof(int32_t));
+		info.GetReturnValue().Set(v8::Int32Array::New(buffer, 0, matches.size()));
+	}
+}
@@ -0,0 +1,15 @@
+#pragma once
+#include "v8.h"
+
+// nodemod.query(criteria): one native pass over the edict table.
+//
+//   { classname, flagsMask, movetype, solid, owner, bbox: { mins, maxs }, count }
+//
+// Every given criterion must hold. bbox keeps entities whose absmin/absmax
+// overlap the box. owner takes an entity, a live entity index, or null / 0
+// for ownerless entities; anything else throws. Returns an Int32Array of entity indices, or the number of
+// matches when `count` is true.
+namespace query
+{
+	void run(const v8::FunctionCallbackInfo<v8::Value>& info);
+}
@@ -0,0 +1,18 @@
+#include "returns.hpp"
+#include "structures/structures.hpp"
+
+extern enginefuncs_t g_engfuncs;
+
+namespace returns
+{
+	edict_t* toEntity(v8::Isolate* isolate, v8::Local<v8::Value> value)
+	{
+		if (value->IsNumber())
+		{
+			int index = value->Int32Value(isolate->GetCurrentContext()).FromMaybe(-1);
+			return index < 0 ? nullptr : (*g_engfuncs.pfnPEntityOfEntIndex)(index);
+		}
+
+		return structures::unwrapEntity(isolate, value);
+	}
+}
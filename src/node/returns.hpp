@@ -0,0 +1,78 @@
+#pragma once
+#include <cstdint>
+#include <type_traits>
+#include "v8.h"
+#include "extdll.h"
+#include "arena.hpp"
+#include "utils.hpp"
+
+// Typed conversion of listener return values for hooks that return something.
+//
+// Generated hooks declare a local of their return type and pass
+// event::returnInto(local) to findAndCall; every non-undefined listener result
+// is converted to that type (the last one wins) and returned to metamod on
+// MRES_OVERRIDE / MRES_SUPERCEDE. Strings live in the per-frame arena and are
+// only valid until the next StartFrame; writable char* returns (info key
+// buffers) get room for arena::infoBufferSize bytes since the engine and game
+// write into them.
+namespace returns
+{
+	edict_t* toEntity(v8::Isolate* isolate, v8::Local<v8::Value> value);
+
+	template<typename T>
+	inline T convert(v8::Isolate* isolate, v8::Local<v8::Value> value)
+	{
+		v8::Local<v8::Context> context = isolate->GetCurrentContext();
+
+		if constexpr (std::is_floating_point_v<T>)
+		{
+			return static_cast<T>(value->NumberValue(context).FromMaybe(0));
+		}
+		else if constexpr (std::is_same_v<T, char>)
+		{
+			// Texture types and the like: "C" or the character code
+			if (value->IsString())
+			{
+				char first = 0;
+				value.As<v8::String>()->WriteOneByte(isolate, reinterpret_cast<uint8_t*>(&first), 0, 1, v8::String::NO_NULL_TERMINATION);
+				return first;
+			}
+			return static_cast<char>(value->Int32Value(context).FromMaybe(0));
+		}
+		else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>)
+		{
+			// Int32 wraps values past 2^31, which keeps the bits of unsigned returns
+			return static_cast<T>(value->Int32Value(context).FromMaybe(0));
+		}
+		else if constexpr (std::is_same_v<T, const char*>)
+		{
+			if (value->IsNull()) return nullptr;
+			return arena::frameString(isolate, value);
+		}
+		else if constexpr (std::is_same_v<T, char*>)
+		{
+			if (value->IsNull()) return nullptr;
+			return arena::frameBuffer(isolate, value, arena::infoBufferSize);
+		}
+		else if constexpr (std::is_same_v<T, edict_t*> || std::is_same_v<T, const edict_t*>)
+		{
+			return toEntity(isolate, value);
+		}
+		else
+		{
+			static_assert(std::is_pointer_v<T>, "unsupported hook return type");
+			return static_cast<T>(utils::jsToPointer(isolate, value));
+		}
+	}
+
+	template<typename T>
+	struct Slot
+	{
+		T& target;
+
+		void operator()(v8::Isolate* isolate, v8::Local<v8::Value> value) const
+		{
+			target = convert<T>(isolate, value);
+		}
+	};
+}
@@ -0,0 +1,106 @@
+#include <memory>
+#include "snapshot.hpp"
+#include "utils.hpp"
+#include "extdll.h"
+#include "util/convert.hpp"
+
+extern globalvars_t* gpGlobals;
+extern enginefuncs_t g_engfuncs;
+
+namespace snapshot
+{
+	bool active = false;
+
+	static Columns columns;
+	static v8::Global<v8::Object> object;
+
+	static void copyVector(float* column, int row, const vec3_t& vector)
+	{
+		column[row * 3] = vector[0];
+		column[row * 3 + 1] = vector[1];
+		column[row * 3 + 2] = vector[2];
+	}
+
+	void capture()
+	{
+		if (!active || !gpGlobals) return;
+
+		int maxClients = gpGlobals->maxClients < slots ? gpGlobals->maxClients : slots;
+		for (int row = 0; row < slots; row++)
+		{
+			edict_t* entity = row < maxClients ? (*g_engfuncs.pfnPEntityOfEntIndex)(row + 1) : nullptr;
+			if (!entity || entity->free || (*g_engfuncs.pfnGetPlayerUserId)(entity) <= 0)
+			{
+				columns.connected[row] = 0;
+				continue;
+			}
+
+			const entvars_t& vars = entity->v;
+			columns.connected[row] = 1;
+			columns.team[row] = vars.team;
+			columns.flags[row] = vars.flags;
+			columns.button[row] = vars.button;
+			columns.health[row] = vars.health;
+			columns.armor[row] = vars.armorvalue;
+			copyVector(columns.origin, row, vars.origin);
+			copyVector(columns.velocity, row, vars.velocity);
+			copyVector(columns.angles, row, vars.angles);
+		}
+	}
+
+	void clear()
+	{
+		object.Reset();
+	}
+
+	template<typename Array, typename Field>
+	static void addColumn(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Object> target,
+		v8::Local<v8::ArrayBuffer> buffer, const char* name, const Field& field)
+	{
+		size_t offset = reinterpret_cast<const char*>(&field) - reinterpret_cast<const char*>(&columns);
+		target->Set(context, convert::str2js(isolate, name), Array::New(buffer, offset, sizeof(field) / sizeof(field[0]))).Check();
+	}
+
+	static v8::Local<v8::Object> create(v8::Isolate* isolate, v8::Local<v8::Context> context)
+	{
+		std::unique_ptr<v8::BackingStore> backingStore = v8::ArrayBuffer::NewBackingStore(&columns, sizeof(columns),
+			[](void* data, size_t length, void* deleterData) {
+				// Static storage
+			}, nullptr);
+		v8::Local<v8::ArrayBuffer> buffer = v8::ArrayBuffer::New(isolate, std::move(backingStore));
+
+		v8::Local<v8::Object> result = v8::Object::New(isolate);
+		result->Set(context, convert::str2js(isolate, "slots"), v8::Integer::New(isolate, slots)).Check();
+		addColumn<v8::Int32Array>(isolate, context, result, buffer, "connected", columns.connected);
+		addColumn<v8::Int32Array>(isolate, context, result, buffer, "team", columns.team);
+		addColumn<v8::Int32Array>(isolate, context, result, buffer, "flags", columns.flags);
+		addColumn<v8::Int32Array>(isolate, context, result, buffer, "button", columns.button);
+		addColumn<v8::Float32Array>(isolate, context, result, buffer, "health", columns.health);
+		addColumn<v8::Float32Array>(isolate, context, result, buffer, "armor", columns.armor);
+		addColumn<v8::Float32Array>(isolate, context, result, buffer, "origin", columns.origin);
+		addColumn<v8::Float32Array>(isolate, context, result, buffer, "velocity", columns.velocity);
+		addColumn<v8::Float32Array>(isolate, context, result, buffer, "angles", columns.angles);
+		return result;
+	}
+
+	void get(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& info)
+	{
+		v8::Isolate* isolate = info.GetIsolate();
+		V8_ASSERT_LOCKED(isolate);
+		v8::HandleScope scope(isolate);
+
+		if (object.IsEmpty())
+		{
+			object.Reset(isolate, create(isolate, isolate->GetCurrentContext()));
+		}
+
+		// The first read gets current data instead of waiting for the next frame
+		if (!active)
+		{
+			active = true;
+			capture();
+		}
+
+		info.GetReturnValue().Set(object.Get(isolate));
+	}
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <cstdint>
+#include "v8.h"
+
+// Structure-of-arrays view of every player slot, refreshed on StartFrame.
+//
+// nodemod.snapshot returns one object whose typed arrays stay valid for the
+// whole process: row i is player slot i (entity index i + 1), vectors take
+// three floats per row. Capturing starts with the first read of the property
+// and costs nothing before that.
+//
+//   { slots, connected, origin, velocity, angles, health, armor, team, flags, button }
+namespace snapshot
+{
+	constexpr int slots = 32;
+
+	struct Columns
+	{
+		int32_t connected[slots];
+		int32_t team[slots];
+		int32_t flags[slots];
+		int32_t button[slots];
+		float health[slots];
+		float armor[slots];
+		float origin[slots * 3];
+		float velocity[slots * 3];
+		float angles[slots * 3];
+	};
+
+	extern bool active;
+
+	void capture();
+	void clear();
+
+	void get(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& info);
+}
@@ -0,0 +1,409 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <utility>
+#include <vector>
+#include "spatial.hpp"
+#include "utils.hpp"
+#include "util/convert.hpp"
+#include "structures/structures.hpp"
+#include "lib/hooks.hpp"
+
+extern globalvars_t* gpGlobals;
+extern enginefuncs_t g_engfuncs;
+
+namespace spatial
+{
+	bool active = false;
+
+	constexpr float gridOrigin = -cellSize * gridSize / 2;
+
+	struct Entry
+	{
+		bool linked = false;
+		bool large = false;
+		bool dirty = false;
+		int x0, y0, x1, y1;
+		float bounds[6];
+	};
+
+	static const edict_t* edicts = nullptr;
+	static int edictCount = 0;
+	static std::vector<Entry> entries;
+	static std::vector<std::vector<int>> cells;
+	static std::vector<int> large;
+	static std::vector<int> dirty;
+
+	// Entities found through several cells are reported once per query
+	static std::vector<uint32_t> stamps;
+	static uint32_t stamp = 0;
+
+	static std::vector<int32_t> results;
+	static std::vector<std::pair<float, int32_t>> ranked;
+
+	static inline int cellOf(float coordinate)
+	{
+		int cell = static_cast<int>(std::floor((coordinate - gridOrigin) / cellSize));
+		return cell < 0 ? 0 : (cell >= gridSize ? gridSize - 1 : cell);
+	}
+
+	static void erase(std::vector<int>& list, int index)
+	{
+		auto found = std::find(list.begin(), list.end(), index);
+		if (found == list.end()) return;
+		*found = list.back();
+		list.pop_back();
+	}
+
+	static void unlink(int index)
+	{
+		Entry& entry = entries[index];
+		if (!entry.linked) return;
+
+		if (entry.large)
+		{
+			erase(large, index);
+		}
+		else
+		{
+			for (int y = entry.y0; y <= entry.y1; y++)
+				for (int x = entry.x0; x <= entry.x1; x++)
+					erase(cells[y * gridSize + x], index);
+		}
+		entry.linked = false;
+	}
+
+	static void link(int index, const float* bounds)
+	{
+		Entry& entry = entries[index];
+		memcpy(entry.bounds, bounds, sizeof(entry.bounds));
+		entry.x0 = cellOf(bounds[0]);
+		entry.y0 = cellOf(bounds[1]);
+		entry.x1 = cellOf(bounds[3]);
+		entry.y1 = cellOf(bounds[4]);
+		entry.large = (entry.x1 - entry.x0 + 1) * (entry.y1 - entry.y0 + 1) > largeCells;
+		entry.linked = true;
+
+		if (entry.large)
+		{
+			large.push_back(index);
+			return;
+		}
+
+		for (int y = entry.y0; y <= entry.y1; y++)
+			for (int x = entry.x0; x <= entry.x1; x++)
+				cells[y * gridSize + x].push_back(index);
+	}
+
+	static void refresh(int index)
+	{
+		const edict_t* entity = edicts + index;
+		Entry& entry = entries[index];
+		entry.dirty = false;
+
+		// Slots past the last allocated edict are zeroed and have no private data
+		if (entity->free || !entity->pvPrivateData)
+		{
+			unlink(index);
+			return;
+		}
+
+		const entvars_t& vars = entity->v;
+		float bounds[6] = { vars.absmin[0], vars.absmin[1], vars.absmin[2], vars.absmax[0], vars.absmax[1], vars.absmax[2] };
+		if (entry.linked && memcmp(bounds, entry.bounds, sizeof(bounds)) == 0) return;
+
+		unlink(index);
+		link(index, bounds);
+	}
+
+	static bool mapTable()
+	{
+		if (edicts) return true;
+		if (!gpGlobals || gpGlobals->maxEntities <= 0) return false;
+
+		edicts = (*g_engfuncs.pfnPEntityOfEntIndex)(0);
+		if (!edicts) return false;
+
+		edictCount = gpGlobals->maxEntities;
+		entries.assign(edictCount, Entry());
+		stamps.assign(edictCount, 0);
+		cells.assign(gridSize * gridSize, std::vector<int>());
+		return true;
+	}
+
+	void touch(const edict_t* entity)
+	{
+		if (!active || !edicts || !entity) return;
+
+		ptrdiff_t index = entity - edicts;
+		if (index <= 0 || index >= edictCount || entries[index].dirty) return;
+
+		entries[index].dirty = true;
+		dirty.push_back(static_cast<int>(index));
+	}
+
+	void sweep()
+	{
+		if (!active || !mapTable()) return;
+
+		for (int i = 1; i < edictCount; i++)
+		{
+			refresh(i);
+		}
+		dirty.clear();
+	}
+
+	void clear()
+	{
+		edicts = nullptr;
+		edictCount = 0;
+		entries.clear();
+		cells.clear();
+		large.clear();
+		dirty.clear();
+		stamps.clear();
+	}
+
+	// Brings the index up to date for a query, false without an edict table
+	static bool prepare()
+	{
+		if (!active)
+		{
+			// Dirty marking and the per-map reset run in these hooks, they must
+			// stay active without JS listeners
+			hooks::acquire(EventId::postEngSetOrigin);
+			hooks::acquire(EventId::postEngSetSize);
+			hooks::acquire(EventId::dllServerDeactivate);
+			active = true;
+			sweep();
+		}
+		else if (!edicts)
+		{
+			// First query since the map changed, entities spawned so far were never marked
+			sweep();
+		}
+		else
+		{
+			for (int index : dirty)
+			{
+				refresh(index);
+			}
+			dirty.clear();
+		}
+
+		if (!edicts) return false;
+
+		if (++stamp == 0)
+		{
+			std::fill(stamps.begin(), stamps.end(), 0);
+			stamp = 1;
+		}
+		return true;
+	}
+
+	static inline float distanceSquared(const Entry& entry, const float* point)
+	{
+		float result = 0.0f;
+		for (int axis = 0; axis < 3; axis++)
+		{
+			float nearest = std::clamp(point[axis], entry.bounds[axis], entry.bounds[axis + 3]);
+			result += (point[axis] - nearest) * (point[axis] - nearest);
+		}
+		return result;
+	}
+
+	// Entities removed during the frame stay bucketed until the next sweep
+	static inline bool removed(int index)
+	{
+		return edicts[index].free || !edicts[index].pvPrivateData;
+	}
+
+	// Entities too big for the grid, every query checks them
+	template<typename Visit>
+	static void visitLarge(Visit&& visit)
+	{
+		for (int index : large)
+		{
+			stamps[index] = stamp;
+			if (!removed(index)) visit(index);
+		}
+	}
+
+	// Calls visit once for every entity bucketed in the x/y rectangle of cells
+	template<typename Visit>
+	static void visitCells(int x0, int y0, int x1, int y1, Visit&& visit)
+	{
+		for (int y = y0; y <= y1; y++)
+		{
+			for (int x = x0; x <= x1; x++)
+			{
+				for (int index : cells[y * gridSize + x])
+				{
+					if (stamps[index] == stamp) continue;
+					stamps[index] = stamp;
+					if (!removed(index)) visit(index);
+				}
+			}
+		}
+	}
+
+	static bool readVector(v8::Isolate* isolate, v8::Local<v8::Value> value, float* target)
+	{
+		if (!value->IsFloat32Array() && !value->IsArray()) return false;
+
+		vec3_t vector;
+		structures::writeVector(isolate, value, vector);
+		target[0] = vector[0];
+		target[1] = vector[1];
+		target[2] = vector[2];
+		return true;
+	}
+
+	static void fail(v8::Isolate* isolate, const char* message)
+	{
+		isolate->ThrowException(v8::Exception::TypeError(convert::str2js(isolate, message)));
+	}
+
+	static v8::Local<v8::Int32Array> toArray(v8::Isolate* isolate)
+	{
+		v8::Local<v8::ArrayBuffer> buffer = v8::ArrayBuffer::New(isolate, results.size() * sizeof(int32_t));
+		if (!results.empty()) memcpy(buffer->Data(), results.data(), results.size() * sizeof(int32_t));
+		return v8::Int32Array::New(buffer, 0, results.size());
+	}
+
+	static void inSphere(const v8::FunctionCallbackInfo<v8::Value>& info)
+	{
+		v8::Isolate* isolate = info.GetIsolate();
+		V8_ASSERT_LOCKED(isolate);
+		v8::HandleScope scope(isolate);
+
+		float origin[3];
+		if (!readVector(isolate, info[0], origin) || !info[1]->IsNumber())
+		{
+			return fail(isolate, "nodemod.spatial.inSphere expects (origin, radius)");
+		}
+		float radius = static_cast<float>(info[1].As<v8::Number>()->Value());
+
+		results.clear();
+		if (prepare())
+		{
+			float limit = radius * radius;
+			auto test = [&](int index) {
+				if (distanceSquared(entries[index], origin) <= limit) results.push_back(index);
+			};
+			visitLarge(test);
+			visitCells(cellOf(origin[0] - radius), cellOf(origin[1] - radius), cellOf(origin[0] + radius), cellOf(origin[1] + radius), test);
+		}
+
+		info.GetReturnValue().Set(toArray(isolate));
+	}
+
+	static void inBox(const v8::FunctionCallbackInfo<v8::Value>& info)
+	{
+		v8::Isolate* isolate = info.GetIsolate();
+		V8_ASSERT_LOCKED(isolate);
+		v8::HandleScope scope(isolate);
+
+		float mins[3], maxs[3];
+		if (!readVector(isolate, info[0], mins) || !readVector(isolate, info[1], maxs))
+		{
+			return fail(isolate, "nodemod.spatial.inBox expects (mins, maxs)");
+		}
+
+		results.clear();
+		if (prepare())
+		{
+			auto test = [&](int index) {
+				const float* bounds = entries[index].bounds;
+				if ((bounds[0] <= maxs[0]) & (bounds[3] >= mins[0]) & (bounds[1] <= maxs[1]) & (bounds[4] >= mins[1]) &
+					(bounds[2] <= maxs[2]) & (bounds[5] >= mins[2]))
+				{
+					results.push_back(index);
+				}
+			};
+			visitLarge(test);
+			visitCells(cellOf(mins[0]), cellOf(mins[1]), cellOf(maxs[0]), cellOf(maxs[1]), test);
+		}
+
+		info.GetReturnValue().Set(toArray(isolate));
+	}
+
+	static void nearest(const v8::FunctionCallbackInfo<v8::Value>& info)
+	{
+		v8::Isolate* isolate = info.GetIsolate();
+		V8_ASSERT_LOCKED(isolate);
+		v8::HandleScope scope(isolate);
+		v8::Local<v8::Context> context = isolate->GetCurrentContext();
+
+		float origin[3];
+		if (!readVector(isolate, info[0], origin))
+		{
+			return fail(isolate, "nodemod.spatial.nearest expects (origin, k, radius?)");
+		}
+		size_t k = info[1]->IsUndefined() ? 1 : info[1]->Uint32Value(context).FromMaybe(1);
+		float radius = info[2]->IsNumber() ? static_cast<float>(info[2].As<v8::Number>()->Value()) : INFINITY;
+		float limit = radius * radius;
+
+		results.clear();
+		ranked.clear();
+		if (k > 0 && prepare())
+		{
+			auto consider = [&](int index) {
+				float distance = distanceSquared(entries[index], origin);
+				if (distance <= limit) ranked.emplace_back(distance, index);
+			};
+
+			visitLarge(consider);
+
+			// Grow square rings of cells around the origin. An entity closer than
+			// ring * cellSize overlaps a cell that has been visited already, so the
+			// search stops once k candidates are at least that close. The bound only
+			// holds for an origin inside the grid, outside of it every cell is visited.
+			int cx = cellOf(origin[0]);
+			int cy = cellOf(origin[1]);
+			float extent = -gridOrigin;
+			bool inside = origin[0] >= gridOrigin && origin[0] < extent && origin[1] >= gridOrigin && origin[1] < extent;
+
+			for (int ring = 0; ; ring++)
+			{
+				int left = cx - ring, right = cx + ring, top = cy - ring, bottom = cy + ring;
+				if (left < 0 && top < 0 && right >= gridSize && bottom >= gridSize) break;
+
+				int x0 = std::max(left, 0), x1 = std::min(right, gridSize - 1);
+				int y0 = std::max(top, 0), y1 = std::min(bottom, gridSize - 1);
+				if (top >= 0) visitCells(x0, top, x1, top, consider);
+				if (bottom < gridSize && ring > 0) visitCells(x0, bottom, x1, bottom, consider);
+				if (left >= 0) visitCells(left, y0, left, y1, consider);
+				if (right < gridSize && ring > 0) visitCells(right, y0, right, y1, consider);
+
+				if (!inside) continue;
+
+				float reach = ring * cellSize;
+				if (reach * reach >= limit) break;
+				if (ranked.size() >= k)
+				{
+					std::nth_element(ranked.begin(), ranked.begin() + (k - 1), ranked.end());
+					if (ranked[k - 1].first <= reach * reach) break;
+				}
+			}
+
+			size_t count = std::min(k, ranked.size());
+			std::partial_sort(ranked.begin(), ranked.begin() + count, ranked.end());
+			for (size_t i = 0; i < count; i++)
+			{
+				results.push_back(ranked[i].second);
+			}
+		}
+
+		info.GetReturnValue().Set(toArray(isolate));
+	}
+
+	v8::Local<v8::ObjectTemplate> createBindings(v8::Isolate* isolate)
+	{
+		v8::Local<v8::ObjectTemplate> object = v8::ObjectTemplate::New(isolate);
+		object->Set(convert::str2js(isolate, "inSphere"), v8::FunctionTemplate::New(isolate, inSphere));
+		object->Set(convert::str2js(isolate, "inBox"), v8::FunctionTemplate::New(isolate, inBox));
+		object->Set(convert::str2js(isolate, "nearest"), v8::FunctionTemplate::New(isolate, nearest));
+		return object;
+	}
+}
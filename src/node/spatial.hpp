@@ -0,0 +1,33 @@
+#pragma once
+#include "v8.h"
+#include "extdll.h"
+
+// Uniform grid over the x/y extent of every entity's absmin/absmax.
+//
+// Starts with the first nodemod.spatial query. From then on StartFrame sweeps
+// the edict table and re-buckets entities whose bounds changed, and
+// SetOrigin/SetSize mark an entity dirty so that it is re-bucketed before the
+// next query of the same frame. Entities moved by physics are at most one
+// frame late.
+//
+//   nodemod.spatial.inSphere(origin, radius)    Int32Array of indices
+//   nodemod.spatial.inBox(mins, maxs)           Int32Array of indices
+//   nodemod.spatial.nearest(origin, k, radius?) Int32Array, closest first
+//
+// Distances are measured to the closest point of an entity's bounds.
+namespace spatial
+{
+	constexpr float cellSize = 256.0f;
+	// Cells per axis, the grid spans +-8192 units; entities outside land in the border cells
+	constexpr int gridSize = 64;
+	// Entities covering more cells than this are kept in one list that every query checks
+	constexpr int largeCells = 16;
+
+	extern bool active;
+
+	void touch(const edict_t* entity);
+	void sweep();
+	void clear();
+
+	v8::Local<v8::ObjectTemplate> createBindings(v8::Isolate* isolate);
+}
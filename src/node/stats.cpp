@@ -0,0 +1,233 @@
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "stats.hpp"
+#include "events.hpp"
+#include "nodeimpl.hpp"
+#include "ham/ham_manager.h"
+#include "util/convert.hpp"
+
+extern NodeImpl nodeImpl;
+
+namespace stats
+{
+	FunctionInfo describe(v8::Isolate* isolate, v8::Local<v8::Function> function)
+	{
+		FunctionInfo result;
+
+		v8::String::Utf8Value name(isolate, function->GetDebugName());
+		result.name = *name && **name ? *name : "(anonymous)";
+
+		v8::Local<v8::Value> resource = function->GetScriptOrigin().ResourceName();
+		if (!resource.IsEmpty() && resource->IsString())
+		{
+			v8::String::Utf8Value script(isolate, resource);
+			result.script = *script ? *script : "";
+		}
+
+		int line = function->GetScriptLineNumber();
+		result.line = line == v8::Function::kLineOffsetNotFound ? 0 : line + 1;
+		return result;
+	}
+
+	static std::vector<event*> sortedEvents()
+	{
+		std::vector<event*> list;
+		for (auto& pair : events)
+		{
+			if (pair.second->counter.calls > 0) list.push_back(pair.second);
+		}
+
+		std::sort(list.begin(), list.end(), [](const event* a, const event* b) { return a->counter.totalNs > b->counter.totalNs; });
+		return list;
+	}
+
+	static std::vector<Ham::Hook*> sortedHooks()
+	{
+		std::vector<Ham::Hook*> list;
+		for (auto& pair : Ham::HamManager::instance().getHooks())
+		{
+			Ham::Hook* hook = pair.second.get();
+			if (hook->getCounter(true).calls > 0 || hook->getCounter(false).calls > 0) list.push_back(hook);
+		}
+
+		std::sort(list.begin(), list.end(), [](Ham::Hook* a, Ham::Hook* b) {
+			return a->getCounter(true).totalNs + a->getCounter(false).totalNs > b->getCounter(true).totalNs + b->getCounter(false).totalNs;
+		});
+		return list;
+	}
+
+	static void set(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Object> object, const char* key, v8::Local<v8::Value> value)
+	{
+		object->Set(context, convert::str2js(isolate, key), value).Check();
+	}
+
+	static void setCounter(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Object> object, const Counter& counter)
+	{
+		v8::Local<v8::Array> histogram = v8::Array::New(isolate, bucketCount);
+		for (unsigned int i = 0; i < bucketCount; i++)
+		{
+			histogram->Set(context, i, v8::Integer::NewFromUnsigned(isolate, counter.histogram[i])).Check();
+		}
+
+		set(isolate, context, object, "calls", v8::Number::New(isolate, static_cast<double>(counter.calls)));
+		set(isolate, context, object, "totalNs", v8::Number::New(isolate, static_cast<double>(counter.totalNs)));
+		set(isolate, context, object, "maxNs", v8::Number::New(isolate, static_cast<double>(counter.maxNs)));
+		set(isolate, context, object, "histogram", histogram);
+	}
+
+	static v8::Local<v8::Object> listenerToJS(v8::Isolate* isolate, v8::Local<v8::Context> context,
+		v8::Local<v8::Function> function, const Counter& counter)
+	{
+		FunctionInfo info = describe(isolate, function);
+		v8::Local<v8::Object> object = v8::Object::New(isolate);
+		set(isolate, context, object, "name", convert::str2js(isolate, info.name.c_str()));
+		set(isolate, context, object, "script", convert::str2js(isolate, info.script.c_str()));
+		set(isolate, context, object, "line", v8::Integer::New(isolate, info.line));
+		setCounter(isolate, context, object, counter);
+		return object;
+	}
+
+	void get(const v8::FunctionCallbackInfo<v8::Value>& info)
+	{
+		v8::Isolate* isolate = info.GetIsolate();
+		v8::HandleScope scope(isolate);
+		v8::Local<v8::Context> context = isolate->GetCurrentContext();
+
+		v8::Local<v8::Array> eventList = v8::Array::New(isolate);
+		uint32_t eventIndex = 0;
+		for (event* _event : sortedEvents())
+		{
+			v8::Local<v8::Object> object = v8::Object::New(isolate);
+			set(isolate, context, object, "name", convert::str2js(isolate, _event->get_name().c_str()));
+			setCounter(isolate, context, object, _event->counter);
+
+			v8::Local<v8::Array> listeners = v8::Array::New(isolate);
+			uint32_t listenerIndex = 0;
+			for (auto& listener : _event->get_listeners())
+			{
+				if (listener.removed) continue;
+				listeners->Set(context, listenerIndex++, listenerToJS(isolate, context, listener.function.Get(isolate), listener.counter)).Check();
+			}
+			set(isolate, context, object, "listeners", listeners);
+
+			eventList->Set(context, eventIndex++, object).Check();
+		}
+
+		v8::Local<v8::Array> hamList = v8::Array::New(isolate);
+		uint32_t hamIndex = 0;
+		for (Ham::Hook* hook : sortedHooks())
+		{
+			for (bool isPre : { true, false })
+			{
+				const Counter& counter = hook->getCounter(isPre);
+				if (counter.calls == 0) continue;
+
+				v8::Local<v8::Object> object = v8::Object::New(isolate);
+				set(isolate, context, object, "name", convert::str2js(isolate, hook->getFunctionName()));
+				set(isolate, context, object, "entity", convert::str2js(isolate, hook->getEntityName().c_str()));
+				set(isolate, context, object, "post", v8::Boolean::New(isolate, !isPre));
+				setCounter(isolate, context, object, counter);
+
+				v8::Local<v8::Array> callbacks = v8::Array::New(isolate);
+				uint32_t callbackIndex = 0;
+				for (auto& cb : isPre ? hook->getPreCallbacks() : hook->getPostCallbacks())
+				{
+					if (cb.callback.IsEmpty()) continue;
+					callbacks->Set(context, callbackIndex++, listenerToJS(isolate, context, cb.callback.Get(isolate), cb.counter)).Check();
+				}
+				set(isolate, context, object, "listeners", callbacks);
+
+				hamList->Set(context, hamIndex++, object).Check();
+			}
+		}
+
+		v8::Local<v8::Object> result = v8::Object::New(isolate);
+		set(isolate, context, result, "events", eventList);
+		set(isolate, context, result, "ham", hamList);
+		info.GetReturnValue().Set(result);
+
+		if (info.Length() > 0 && info[0]->BooleanValue(isolate)) reset();
+	}
+
+	static void printLine(const char* label, const Counter& counter, int indent)
+	{
+		char line[256];
+		snprintf(line, sizeof(line), "%*s%-*.*s %10llu %10.2f %9.1f %9.1f\n",
+			indent, "", 48 - indent, 48 - indent, label,
+			static_cast<unsigned long long>(counter.calls),
+			counter.totalNs / 1e6,
+			counter.calls ? counter.totalNs / 1e3 / counter.calls : 0.0,
+			counter.maxNs / 1e3);
+		g_engfuncs.pfnServerPrint(line);
+	}
+
+	static void printListener(v8::Isolate* isolate, v8::Local<v8::Function> function, const Counter& counter)
+	{
+		FunctionInfo info = describe(isolate, function);
+		std::string label = info.name;
+		if (!info.script.empty())
+		{
+			size_t slash = info.script.find_last_of("/\\");
+			label += " " + info.script.substr(slash == std::string::npos ? 0 : slash + 1) + ":" + std::to_string(info.line);
+		}
+		printLine(label.c_str(), counter, 2);
+	}
+
+	void print()
+	{
+		v8::Isolate* isolate = nodeImpl.GetIsolate();
+		if (!isolate) return;
+
+		v8::Locker locker(isolate);
+		v8::Isolate::Scope isolateScope(isolate);
+		v8::HandleScope scope(isolate);
+
+		char header[256];
+		snprintf(header, sizeof(header), "%-48s %10s %10s %9s %9s\n", "event / listener", "calls", "total ms", "avg us", "max us");
+		g_engfuncs.pfnServerPrint(header);
+
+		for (event* _event : sortedEvents())
+		{
+			printLine(_event->get_name().c_str(), _event->counter, 0);
+			for (auto& listener : _event->get_listeners())
+			{
+				if (!listener.removed) printListener(isolate, listener.function.Get(isolate), listener.counter);
+			}
+		}
+
+		for (Ham::Hook* hook : sortedHooks())
+		{
+			for (bool isPre : { true, false })
+			{
+				const Counter& counter = hook->getCounter(isPre);
+				if (counter.calls == 0) continue;
+
+				std::string label = std::string("ham ") + hook->getEntityName() + " " + hook->getFunctionName() + (isPre ? "" : " post");
+				printLine(label.c_str(), counter, 0);
+				for (auto& cb : isPre ? hook->getPreCallbacks() : hook->getPostCallbacks())
+				{
+					if (!cb.callback.IsEmpty()) printListener(isolate, cb.callback.Get(isolate), cb.counter);
+				}
+			}
+		}
+	}
+
+	void reset()
+	{
+		for (auto& pair : events)
+		{
+			pair.second->reset_counters();
+		}
+
+		for (auto& pair : Ham::HamManager::instance().getHooks())
+		{
+			Ham::Hook* hook = pair.second.get();
+			hook->getCounter(true) = Counter();
+			hook->getCounter(false) = Counter();
+			for (auto& cb : hook->getPreCallbacks()) cb.counter = Counter();
+			for (auto& cb : hook->getPostCallbacks()) cb.counter = Counter();
+		}
+	}
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include "v8.h"
+
+// Dispatch profiling: call count, total and max time and a log2 histogram per
+// event, per listener and per Ham hook and callback. Always on; a counter
+// update is two monotonic clock reads next to a JS call.
+//
+// Read through nodemod.stats() or the `nodemod_stats [reset]` server command.
+namespace stats
+{
+	// Bucket 0 counts calls under 1us, bucket n calls under 2^n us, the last one the rest
+	constexpr unsigned int bucketCount = 16;
+
+	inline uint64_t now()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	struct Counter
+	{
+		uint64_t calls = 0;
+		uint64_t totalNs = 0;
+		uint64_t maxNs = 0;
+		uint32_t histogram[bucketCount] = {};
+
+		inline void add(uint64_t ns)
+		{
+			calls++;
+			totalNs += ns;
+			maxNs = std::max(maxNs, ns);
+			unsigned int bucket = static_cast<unsigned int>(std::bit_width(ns / 1000));
+			histogram[std::min(bucket, bucketCount - 1)]++;
+		}
+	};
+
+	// Adds the lifetime of the scope to a counter
+	struct Timer
+	{
+		Counter& counter;
+		uint64_t start;
+
+		Timer(Counter& _counter) : counter(_counter), start(now()) {}
+		~Timer() { counter.add(now() - start); }
+	};
+
+	struct FunctionInfo
+	{
+		std::string name;
+		std::string script;
+		int line;
+	};
+
+	// Debug name, script and 1-based line of a listener
+	FunctionInfo describe(v8::Isolate* isolate, v8::Local<v8::Function> function);
+
+	// nodemod.stats(reset?: boolean)
+	void get(const v8::FunctionCallbackInfo<v8::Value>& info);
+	// Server console report, sorted by total time
+	void print();
+	void reset();
+}
@@ -0,0 +1,40 @@
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include "stringtable.hpp"
+#include "arena.hpp"
+
+extern enginefuncs_t g_engfuncs;
+
+namespace stringtable
+{
+	// Lookups by string_view, a hit does not build a std::string
+	struct Hash
+	{
+		using is_transparent = void;
+		size_t operator()(std::string_view text) const { return std::hash<std::string_view>{}(text); }
+	};
+
+	static std::unordered_map<std::string, string_t, Hash, std::equal_to<>> allocated;
+
+	string_t alloc(const char* text)
+	{
+		auto found = allocated.find(std::string_view(text));
+		if (found != allocated.end()) return found->second;
+
+		string_t result = (*g_engfuncs.pfnAllocString)(text);
+		allocated.emplace(text, result);
+		return result;
+	}
+
+	string_t alloc(v8::Isolate* isolate, v8::Local<v8::Value> value)
+	{
+		// The frame copy is only used for the lookup
+		return alloc(arena::frameString(isolate, value));
+	}
+
+	void clear()
+	{
+		allocated.clear();
+	}
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include "v8.h"
+#include "extdll.h"
+
+// string_t values for strings written into entity fields.
+//
+// pfnAllocString copies into the engine's string pool and never frees, so
+// assigning the same classname or model every frame grows the pool for the
+// rest of the map. Strings allocated here are remembered by content and a
+// repeated value returns the string_t it got the first time.
+//
+// The pool is released on level change, so the table is cleared on
+// ServerDeactivate before any offset it holds goes stale.
+namespace stringtable
+{
+	string_t alloc(const char* text);
+	string_t alloc(v8::Isolate* isolate, v8::Local<v8::Value> value);
+	void clear();
+}
@@ -0,0 +1,136 @@
+#include <cstdio>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+#include "trace.hpp"
+#include "extdll.h"
+#include "enginecallback.h"
+
+namespace trace
+{
+	bool active = false;
+
+	struct Span
+	{
+		uint64_t start;
+		uint64_t end;
+		uint32_t nameId;
+		Category category;
+	};
+
+	static std::vector<std::string> names = { "", "StartFrame", "Tick", "uv_run", "microtasks" };
+	static std::unordered_map<std::string, uint32_t> nameIds;
+
+	static std::vector<Span> ring;
+	static size_t head = 0;
+	static size_t count = 0;
+	static uint64_t origin = 0;
+	static std::string outputFile = "nodemod-trace.json";
+
+	uint32_t name(const std::string& text)
+	{
+		if (nameIds.empty())
+		{
+			for (uint32_t i = 1; i < names.size(); i++) nameIds[names[i]] = i;
+		}
+
+		auto it = nameIds.find(text);
+		if (it != nameIds.end()) return it->second;
+
+		uint32_t id = static_cast<uint32_t>(names.size());
+		names.push_back(text);
+		nameIds[text] = id;
+		return id;
+	}
+
+	void record(uint32_t nameId, Category category, uint64_t start, uint64_t end)
+	{
+		ring[head] = { start, end, nameId, category };
+		head = (head + 1) % ringCapacity;
+		if (count < ringCapacity) count++;
+	}
+
+	bool start(const char* file)
+	{
+		// A running capture keeps the file it was started with
+		if (active) return false;
+		if (file && *file) outputFile = file;
+
+		ring.resize(ringCapacity);
+		head = 0;
+		count = 0;
+		origin = stats::now();
+		active = true;
+		return true;
+	}
+
+	static void writeString(FILE* out, const std::string& text)
+	{
+		fputc('"', out);
+		for (char c : text)
+		{
+			if (c == '"' || c == '\\') fputc('\\', out);
+			if (static_cast<unsigned char>(c) < 0x20) continue;
+			fputc(c, out);
+		}
+		fputc('"', out);
+	}
+
+	bool stop(const char* file)
+	{
+		if (!active) return false;
+		active = false;
+		if (file && *file) outputFile = file;
+
+		FILE* out = fopen(outputFile.c_str(), "w");
+		if (!out) return false;
+
+		static const char* categories[] = { "frame", "event", "listener", "ham" };
+
+		fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", out);
+		fputs("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"server\"}}", out);
+
+		size_t first = (head + ringCapacity - count) % ringCapacity;
+		for (size_t i = 0; i < count; i++)
+		{
+			const Span& span = ring[(first + i) % ringCapacity];
+			fputs(",\n{\"name\":", out);
+			writeString(out, names[span.nameId]);
+			fprintf(out, ",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}",
+				categories[static_cast<unsigned int>(span.category)],
+				(span.start - origin) / 1e3, (span.end - span.start) / 1e3);
+		}
+
+		fputs("\n]}\n", out);
+		fclose(out);
+
+		// The ring is 24 MB, give it back between traces
+		std::vector<Span>().swap(ring);
+		return true;
+	}
+
+	void command()
+	{
+		const char* action = CMD_ARGV(1);
+		const char* file = CMD_ARGC() > 2 ? CMD_ARGV(2) : nullptr;
+		char message[512];
+
+		if (!strcmp(action, "start"))
+		{
+			if (start(file)) snprintf(message, sizeof(message), "NodeMod: Tracing to %s\n", outputFile.c_str());
+			else snprintf(message, sizeof(message), "NodeMod: Trace already running, writing to %s\n", outputFile.c_str());
+		}
+		else if (!strcmp(action, "stop"))
+		{
+			size_t spans = count;
+			if (stop(file)) snprintf(message, sizeof(message), "NodeMod: Wrote %zu spans to %s\n", spans, outputFile.c_str());
+			else snprintf(message, sizeof(message), "NodeMod: No trace running or %s is not writable\n", outputFile.c_str());
+		}
+		else
+		{
+			snprintf(message, sizeof(message), "Usage: nodemod_trace start|stop [file]\n");
+		}
+
+		SERVER_PRINT(message);
+	}
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include "stats.hpp"
+
+// Chrome / Perfetto trace export: `nodemod_trace start [file]` and
+// `nodemod_trace stop [file]`.
+//
+// While started, spans for server frames, Tick, event dispatches, listeners
+// and Ham callbacks go into a preallocated ring buffer (the oldest spans are
+// overwritten). Stop writes the buffer as trace event JSON, loadable in
+// chrome://tracing or ui.perfetto.dev. Names are interned once; recording a
+// span is two clock reads and a store.
+namespace trace
+{
+	constexpr size_t ringCapacity = 1 << 20;
+
+	enum class Category : uint8_t
+	{
+		Frame,
+		Event,
+		Listener,
+		Ham
+	};
+
+	// Names known up front, the rest are interned on first use
+	enum Builtin : uint32_t
+	{
+		StartFrame = 1,
+		Tick,
+		UvRun,
+		Microtasks
+	};
+
+	extern bool active;
+
+	// 0 is never a valid name
+	uint32_t name(const std::string& text);
+	void record(uint32_t nameId, Category category, uint64_t start, uint64_t end);
+
+	struct Scope
+	{
+		uint32_t nameId;
+		Category category;
+		uint64_t start;
+
+		Scope(uint32_t _nameId, Category _category) : nameId(_nameId), category(_category), start(active ? stats::now() : 0) {}
+		~Scope()
+		{
+			if (start && active) record(nameId, category, start, stats::now());
+		}
+	};
+
+	bool start(const char* file);
+	bool stop(const char* file);
+	// nodemod_trace start|stop [file]
+	void command();
+}
@@ -0,0 +1,202 @@
+#include <memory>
+#include <string>
+#include "traces.hpp"
+#include "utils.hpp"
+#include "util/convert.hpp"
+#include "extdll.h"
+
+extern globalvars_t* gpGlobals;
+extern enginefuncs_t g_engfuncs;
+
+namespace traces
+{
+	// Elements of a typed array. The backing store is held so a trace hook that
+	// detaches the buffer cannot free it under the loop
+	template<typename T>
+	struct View
+	{
+		std::shared_ptr<v8::BackingStore> store;
+		T* data = nullptr;
+		size_t length = 0;
+	};
+
+	template<typename T>
+	static View<T> view(v8::Local<v8::TypedArray> array)
+	{
+		View<T> result;
+		result.store = array->Buffer()->GetBackingStore();
+		result.data = reinterpret_cast<T*>(static_cast<char*>(result.store->Data()) + array->ByteOffset());
+		result.length = array->Length();
+		return result;
+	}
+
+	struct Output
+	{
+		v8::Local<v8::Object> object;
+		View<float> fraction;
+		View<float> endpos;
+		View<float> normal;
+		View<int32_t> hit;
+	};
+
+	static bool fail(v8::Isolate* isolate, bool hull, const char* message)
+	{
+		std::string text = std::string(hull ? "nodemod.eng.traceHulls: " : "nodemod.eng.traceLines: ") + message;
+		isolate->ThrowException(v8::Exception::TypeError(convert::str2js(isolate, text.c_str())));
+		return false;
+	}
+
+	static v8::Local<v8::Value> field(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Object> object, const char* name)
+	{
+		return object->Get(context, convert::str2js(isolate, name)).ToLocalChecked();
+	}
+
+	static v8::Local<v8::Float32Array> newFloats(v8::Isolate* isolate, size_t length)
+	{
+		return v8::Float32Array::New(v8::ArrayBuffer::New(isolate, length * sizeof(float)), 0, length);
+	}
+
+	static bool prepare(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> out, size_t count, bool hull, Output& output)
+	{
+		v8::Local<v8::Value> fraction, endpos, normal, hit;
+
+		if (out->IsUndefined() || out->IsNull())
+		{
+			fraction = newFloats(isolate, count);
+			endpos = newFloats(isolate, count * 3);
+			normal = newFloats(isolate, count * 3);
+			hit = v8::Int32Array::New(v8::ArrayBuffer::New(isolate, count * sizeof(int32_t)), 0, count);
+
+			output.object = v8::Object::New(isolate);
+			output.object->Set(context, convert::str2js(isolate, "fraction"), fraction).Check();
+			output.object->Set(context, convert::str2js(isolate, "endpos"), endpos).Check();
+			output.object->Set(context, convert::str2js(isolate, "normal"), normal).Check();
+			output.object->Set(context, convert::str2js(isolate, "hit"), hit).Check();
+		}
+		else
+		{
+			if (!out->IsObject()) return fail(isolate, hull, "out must be a previous result");
+			output.object = out.As<v8::Object>();
+			fraction = field(isolate, context, output.object, "fraction");
+			endpos = field(isolate, context, output.object, "endpos");
+			normal = field(isolate, context, output.object, "normal");
+			hit = field(isolate, context, output.object, "hit");
+
+			if (!fraction->IsFloat32Array() || !endpos->IsFloat32Array() || !normal->IsFloat32Array() || !hit->IsInt32Array())
+			{
+				return fail(isolate, hull, "out needs fraction, endpos and normal Float32Arrays and a hit Int32Array");
+			}
+		}
+
+		output.fraction = view<float>(fraction.As<v8::TypedArray>());
+		output.endpos = view<float>(endpos.As<v8::TypedArray>());
+		output.normal = view<float>(normal.As<v8::TypedArray>());
+		output.hit = view<int32_t>(hit.As<v8::TypedArray>());
+
+		if (output.fraction.length < count || output.endpos.length < count * 3 || output.normal.length < count * 3 || output.hit.length < count)
+		{
+			return fail(isolate, hull, "out arrays are too short for this many traces");
+		}
+
+		return true;
+	}
+
+	static inline edict_t* toEntity(edict_t* edicts, int32_t index)
+	{
+		if (index < 0 || index >= gpGlobals->maxEntities || edicts[index].free) return nullptr;
+		return edicts + index;
+	}
+
+	static void run(const v8::FunctionCallbackInfo<v8::Value>& info, bool hull)
+	{
+		v8::Isolate* isolate = info.GetIsolate();
+		V8_ASSERT_LOCKED(isolate);
+		v8::HandleScope scope(isolate);
+		v8::Local<v8::Context> context = isolate->GetCurrentContext();
+
+		// traceHulls takes the hull number before the shared tail
+		int first = hull ? 4 : 3;
+
+		if (!info[0]->IsFloat32Array() || !info[1]->IsFloat32Array())
+		{
+			fail(isolate, hull, "starts and ends must be Float32Arrays");
+			return;
+		}
+
+		View<float> starts = view<float>(info[0].As<v8::TypedArray>());
+		View<float> ends = view<float>(info[1].As<v8::TypedArray>());
+		if (starts.length != ends.length || starts.length % 3)
+		{
+			fail(isolate, hull, "starts and ends must hold the same number of points");
+			return;
+		}
+
+		size_t count = starts.length / 3;
+		int flags = info[2]->Int32Value(context).FromMaybe(0);
+		int hullNumber = hull ? info[3]->Int32Value(context).FromMaybe(0) : 0;
+
+		// One entity to skip for all traces, or one per trace
+		v8::Local<v8::Value> ignore = info[first];
+		View<int32_t> ignores;
+		int32_t ignoreAll = -1;
+		if (ignore->IsInt32Array())
+		{
+			ignores = view<int32_t>(ignore.As<v8::TypedArray>());
+			if (ignores.length < count)
+			{
+				fail(isolate, hull, "ignore needs an entry per trace");
+				return;
+			}
+		}
+		else if (ignore->IsNumber())
+		{
+			ignoreAll = ignore->Int32Value(context).FromMaybe(-1);
+		}
+		else if (!ignore->IsUndefined() && !ignore->IsNull())
+		{
+			fail(isolate, hull, "ignore must be an entity index or an Int32Array");
+			return;
+		}
+
+		Output output;
+		if (!prepare(isolate, context, info[first + 1], count, hull, output)) return;
+
+		edict_t* edicts = (*g_engfuncs.pfnPEntityOfEntIndex)(0);
+		if (!edicts || !gpGlobals)
+		{
+			info.GetReturnValue().Set(output.object);
+			return;
+		}
+
+		for (size_t i = 0; i < count; i++)
+		{
+			edict_t* skip = toEntity(edicts, ignores.data ? ignores.data[i] : ignoreAll);
+			const float* start = starts.data + i * 3;
+			const float* end = ends.data + i * 3;
+
+			TraceResult trace;
+			if (hull) (*g_engfuncs.pfnTraceHull)(start, end, flags, hullNumber, skip, &trace);
+			else (*g_engfuncs.pfnTraceLine)(start, end, flags, skip, &trace);
+
+			output.fraction.data[i] = trace.flFraction;
+			for (int axis = 0; axis < 3; axis++)
+			{
+				output.endpos.data[i * 3 + axis] = trace.vecEndPos[axis];
+				output.normal.data[i * 3 + axis] = trace.vecPlaneNormal[axis];
+			}
+			output.hit.data[i] = trace.pHit ? static_cast<int32_t>(trace.pHit - edicts) : -1;
+		}
+
+		info.GetReturnValue().Set(output.object);
+	}
+
+	void lines(const v8::FunctionCallbackInfo<v8::Value>& info)
+	{
+		run(info, false);
+	}
+
+	void hulls(const v8::FunctionCallbackInfo<v8::Value>& info)
+	{
+		run(info, true);
+	}
+}
@@ -0,0 +1,18 @@
+#pragma once
+#include "v8.h"
+
+// Batched traces, one native loop over N pfnTraceLine / pfnTraceHull calls.
+//
+//   nodemod.eng.traceLines(starts, ends, flags, ignore?, out?)
+//   nodemod.eng.traceHulls(starts, ends, flags, hull, ignore?, out?)
+//
+// starts and ends are Float32Arrays of N points (3N floats). ignore is an
+// entity index for every trace, or an Int32Array with one index per trace
+// (-1 for none). Results go to { fraction, endpos, normal, hit }: Float32Arrays
+// of N, 3N and 3N floats and an Int32Array of N hit entity indices (-1 for
+// none). Passing a previous result as `out` reuses its arrays.
+namespace traces
+{
+	void lines(const v8::FunctionCallbackInfo<v8::Value>& info);
+	void hulls(const v8::FunctionCallbackInfo<v8::Value>& info);
+}
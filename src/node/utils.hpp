@@ -3,16 +3,30 @@
 #include <string>
 #include <sstream>
 #include <utility>
+#include <cassert>
 #include <cmath>
 #include <cstring>
 #include "node.h"
 #include "v8.h"
 #include "extdll.h"
 
+// Bindings, accessors and wrap/unwrap helpers only run inside V8, under the lock
+// taken where native code enters JS (event dispatch, Tick, Ham hooks, server
+// commands). They check that in debug builds instead of locking again.
+#define V8_ASSERT_LOCKED(isolate) assert(v8::Locker::IsLocked(isolate))
+
 namespace utils {
 
+// Entry of the generated nodemod.eng / nodemod.dll function tables. `fast` is
+// the v8::CFunction that optimized code calls directly, where the signature has one
+struct NativeFunction {
+  std::string name;
+  v8::FunctionCallback callback;
+  const v8::CFunction* fast = nullptr;
+};
+
 inline v8::Local<v8::Array> vect2js(v8::Isolate *isolate, const vec3_t &_array) {
-		v8::Locker locker(isolate);
+		V8_ASSERT_LOCKED(isolate);
   v8::Local<v8::Array> array = v8::Array::New(isolate, 3);
 
   array->Set(isolate->GetCurrentContext(), 0, v8::Number::New(isolate, _array.x)).Check();
@@ -23,7 +37,7 @@ inline v8::Local<v8::Array> vect2js(v8::Isolate *isolate, const vec3_t &_array)
 }
 
 inline void js2vect(v8::Isolate *isolate, v8::Local<v8::Array> array, vec3_t &vector) {
-		v8::Locker locker(isolate);
+		V8_ASSERT_LOCKED(isolate);
   vector.x = array->Get(isolate->GetCurrentContext(), 0).ToLocalChecked()->ToNumber(isolate->GetCurrentContext()).ToLocalChecked()->Value();
   vector.y = array->Get(isolate->GetCurrentContext(), 1).ToLocalChecked()->ToNumber(isolate->GetCurrentContext()).ToLocalChecked()->Value();
   vector.z = array->Get(isolate->GetCurrentContext(), 2).ToLocalChecked()->ToNumber(isolate->GetCurrentContext()).ToLocalChecked()->Value();
@@ -49,30 +63,6 @@ inline void js2vect(v8::Isolate *isolate, v8::Local<v8::Array> array, vec3_t &ve
 		return std::string(str);
 	}
 
-	// TODO fix terrible memory leaking
-	inline const char* js2string(v8::Isolate* isolate, const v8::Local<v8::Value>& value) {
-		if (value.IsEmpty() || value->IsNullOrUndefined()) {
-			char* empty = new char[1];
-			empty[0] = '\0';
-			return empty;
-		}
-		v8::String::Utf8Value _str(isolate, value);
-		const char* str(*_str);
-		if (!str) {
-			char* empty = new char[1];
-			empty[0] = '\0';
-			return empty;
-		}
-		size_t slen = strlen(str);
-		char* mystr = new char[slen + 1];
-		for (size_t x = 0; x < slen; x++)
-		{
-			mystr[x] = str[x];
-		}
-		mystr[slen] = '\0';
-		return mystr;
-	}
-
 	inline std::vector<std::string> split(const std::string& s, char delimiter)
 	{
 		std::vector<std::string> tokens;
@@ -245,7 +235,7 @@ inline void js2vect(v8::Isolate *isolate, v8::Local<v8::Array> array, vec3_t &ve
 
 	// Convert float array to JS array
 	inline v8::Local<v8::Array> floatArrayToJS(v8::Isolate *isolate, const float* array, size_t length) {
-		v8::Locker locker(isolate);
+		V8_ASSERT_LOCKED(isolate);
 		
 		if (!array) {
 			return v8::Array::New(isolate, 0);
@@ -262,7 +252,7 @@ inline void js2vect(v8::Isolate *isolate, v8::Local<v8::Array> array, vec3_t &ve
 
 	// Convert int array to JS array
 	inline v8::Local<v8::Array> intArrayToJS(v8::Isolate *isolate, const int* array, size_t length) {
-		v8::Locker locker(isolate);
+		V8_ASSERT_LOCKED(isolate);
 		v8::Local<v8::Array> jsArray = v8::Array::New(isolate, length);
 
 		for (size_t i = 0; i < length; i++) {
@@ -274,7 +264,7 @@ inline void js2vect(v8::Isolate *isolate, v8::Local<v8::Array> array, vec3_t &ve
 
 	// Convert char** (string array) to JS array
 	inline v8::Local<v8::Array> stringArrayToJS(v8::Isolate *isolate, char** strings, size_t length) {
-		v8::Locker locker(isolate);
+		V8_ASSERT_LOCKED(isolate);
 		v8::Local<v8::Array> jsArray = v8::Array::New(isolate, length);
 
 		for (size_t i = 0; i < length; i++) {
@@ -306,7 +296,7 @@ inline void js2vect(v8::Isolate *isolate, v8::Local<v8::Array> array, vec3_t &ve
 
 	// Convert unsigned char array to JS array (byte array)
 	inline v8::Local<v8::Array> byteArrayToJS(v8::Isolate *isolate, const unsigned char* bytes, size_t length) {
-		v8::Locker locker(isolate);
+		V8_ASSERT_LOCKED(isolate);
 		
 		if (!bytes) {
 			return v8::Array::New(isolate, 0);
@@ -0,0 +1,162 @@
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "watchdog.hpp"
+#include "stats.hpp"
+#include "extdll.h"
+#include "enginecallback.h"
+
+namespace watchdog
+{
+	static cvar_t cvarListenerBudget = { const_cast<char*>("nodemod_budget_listener"), const_cast<char*>("5000"), 0, 5000.0f, nullptr };
+	static cvar_t cvarFrameBudget = { const_cast<char*>("nodemod_budget_frame"), const_cast<char*>("0"), 0, 0.0f, nullptr };
+	static cvar_t cvarStrikes = { const_cast<char*>("nodemod_budget_strikes"), const_cast<char*>("3"), 0, 3.0f, nullptr };
+
+	constexpr auto pollInterval = std::chrono::milliseconds(5);
+
+	// Shared with the watchdog thread
+	static std::atomic<v8::Isolate*> isolate{ nullptr };
+	static std::atomic<uint64_t> callStart{ 0 };
+	static std::atomic<uint64_t> frameUsed{ 0 };
+	static std::atomic<uint64_t> listenerBudget{ 5000000000ull };
+	static std::atomic<uint64_t> frameBudget{ 0 };
+
+	// Engine thread only
+	static unsigned int depth = 0;
+	static bool terminated = false;
+	static unsigned int strikeLimit = 3;
+	static std::string lastStack;
+
+	// The registered cvars, read directly every frame instead of by name
+	static cvar_t* listenerCvar = &cvarListenerBudget;
+	static cvar_t* frameCvar = &cvarFrameBudget;
+	static cvar_t* strikesCvar = &cvarStrikes;
+
+	static std::thread thread;
+	static std::mutex mutex;
+	static std::condition_variable wakeup;
+	static bool running = false;
+
+	void registerCvars()
+	{
+		CVAR_REGISTER(&cvarListenerBudget);
+		CVAR_REGISTER(&cvarFrameBudget);
+		CVAR_REGISTER(&cvarStrikes);
+
+		// The engine may link a copy, use whatever it hands back
+		if (cvar_t* registered = CVAR_GET_POINTER(cvarListenerBudget.name)) listenerCvar = registered;
+		if (cvar_t* registered = CVAR_GET_POINTER(cvarFrameBudget.name)) frameCvar = registered;
+		if (cvar_t* registered = CVAR_GET_POINTER(cvarStrikes.name)) strikesCvar = registered;
+	}
+
+	// Runs on the engine thread, inside the overrunning JS
+	static void interrupt(v8::Isolate* _isolate, void* data)
+	{
+		// The call the watchdog saw may already have returned
+		if (callStart.load() != reinterpret_cast<uintptr_t>(data)) return;
+
+		v8::HandleScope scope(_isolate);
+		v8::Local<v8::StackTrace> trace = v8::StackTrace::CurrentStackTrace(_isolate, 16);
+
+		lastStack.clear();
+		for (int i = 0; i < trace->GetFrameCount(); i++)
+		{
+			v8::Local<v8::StackFrame> frame = trace->GetFrame(_isolate, i);
+			v8::String::Utf8Value function(_isolate, frame->GetFunctionName());
+			v8::String::Utf8Value script(_isolate, frame->GetScriptName());
+			lastStack += std::string("    at ") + (*function && **function ? *function : "(anonymous)") + " (" +
+				(*script ? *script : "") + ":" + std::to_string(frame->GetLineNumber()) + ":" + std::to_string(frame->GetColumn()) + ")\n";
+		}
+
+		terminated = true;
+		_isolate->TerminateExecution();
+	}
+
+	static void run()
+	{
+		uint64_t requested = 0;
+		std::unique_lock<std::mutex> lock(mutex);
+
+		while (running)
+		{
+			wakeup.wait_for(lock, pollInterval);
+
+			uint64_t start = callStart.load();
+			if (!start || start == requested) continue;
+
+			uint64_t elapsed = stats::now() - start;
+			uint64_t listenerLimit = listenerBudget.load();
+			uint64_t frameLimit = frameBudget.load();
+
+			if ((listenerLimit && elapsed > listenerLimit) || (frameLimit && frameUsed.load() + elapsed > frameLimit))
+			{
+				requested = start;
+				isolate.load()->RequestInterrupt(interrupt, reinterpret_cast<void*>(static_cast<uintptr_t>(start)));
+			}
+		}
+	}
+
+	void start()
+	{
+		if (running) return;
+		running = true;
+		thread = std::thread(run);
+	}
+
+	void stop()
+	{
+		if (!running) return;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			running = false;
+		}
+		wakeup.notify_one();
+		thread.join();
+	}
+
+	void frame()
+	{
+		frameUsed = 0;
+		listenerBudget = static_cast<uint64_t>(listenerCvar->value * 1e6);
+		frameBudget = static_cast<uint64_t>(frameCvar->value * 1e6);
+		strikeLimit = static_cast<unsigned int>(strikesCvar->value);
+	}
+
+	void enter(v8::Isolate* _isolate)
+	{
+		if (depth++ > 0) return;
+		isolate = _isolate;
+		callStart = stats::now();
+	}
+
+	bool leave()
+	{
+		// Nested calls are part of the outermost one: the termination keeps
+		// unwinding through them and the outermost listener takes the blame
+		if (--depth > 0) return false;
+
+		frameUsed += stats::now() - callStart.load();
+		callStart = 0;
+
+		bool result = terminated;
+		terminated = false;
+		return result;
+	}
+
+	bool terminating()
+	{
+		return terminated;
+	}
+
+	const std::string& stack()
+	{
+		return lastStack;
+	}
+
+	unsigned int strikes()
+	{
+		return strikeLimit;
+	}
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <string>
+#include "v8.h"
+
+// JS time budget enforcement for every JS entry point on the engine thread:
+// event listeners, Ham callbacks, batched listeners and the uv loop / microtask
+// run of each frame.
+//
+// A watchdog thread polls the call running on the engine thread. When it
+// runs past `nodemod_budget_listener` ms, or the frame's calls together
+// pass `nodemod_budget_frame` ms (0 disables either), it interrupts the
+// isolate, captures the JS stack and terminates execution. The caller then
+// cancels the termination, logs the function and, for listeners and
+// callbacks, removes it after `nodemod_budget_strikes` overruns (0 = never).
+namespace watchdog
+{
+	void registerCvars();
+	void start();
+	void stop();
+
+	// Once per server frame: resets the frame's JS time and reloads the budgets
+	void frame();
+
+	// Around each listener call on the engine thread; nested dispatches count
+	// toward the outermost listener
+	void enter(v8::Isolate* isolate);
+	// True when the watchdog terminated the outermost call that just
+	// returned; always false for nested calls
+	bool leave();
+	// True while a terminated call unwinds through nested dispatches
+	bool terminating();
+
+	// JS stack captured when the last call was terminated
+	const std::string& stack();
+	unsigned int strikes();
+}
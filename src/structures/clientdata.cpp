@@ -1,15 +1,15 @@
 #include "structures.hpp"
 #include "common_macros.hpp"
+#include "pool.hpp"
 #include <entity_state.h>
-#include <unordered_map>
 
 namespace structures {
 
 v8::Eternal<v8::ObjectTemplate> clientDataTemplate;
-std::unordered_map<void*, v8::Persistent<v8::Object>> wrappedClientData;
+static WrapperPool clientDataPool(clientDataTemplate);
 
 clientdata_s* unwrapClientData_internal(v8::Isolate* isolate, const v8::Local<v8::Value>& obj) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (obj.IsEmpty() || !obj->IsObject()) {
         return nullptr;
     }
@@ -24,7 +24,7 @@ clientdata_s* unwrapClientData_internal(v8::Isolate* isolate, const v8::Local<v8
 }
 
 void createClientDataTemplate(v8::Isolate* isolate) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     v8::HandleScope scope(isolate);
     
     v8::Local<v8::ObjectTemplate> templ = v8::ObjectTemplate::New(isolate);
@@ -84,27 +84,17 @@ void createClientDataTemplate(v8::Isolate* isolate) {
 }
 
 v8::Local<v8::Value> wrapClientData(v8::Isolate* isolate, void* clientdata) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (!clientdata) {
         return v8::Null(isolate);
     }
     
-    // Check if already wrapped
-    if (wrappedClientData.find(clientdata) != wrappedClientData.end()) {
-        return v8::Local<v8::Object>::New(isolate, wrappedClientData[clientdata]);
-    }
-    
     // Create template if not initialized
     if (clientDataTemplate.IsEmpty()) {
         createClientDataTemplate(isolate);
     }
     
-    // Create new instance
-    v8::Local<v8::Object> obj = clientDataTemplate.Get(isolate)->NewInstance(isolate->GetCurrentContext()).ToLocalChecked();
-    obj->SetAlignedPointerInInternalField(0, clientdata);
-    
-    wrappedClientData[clientdata].Reset(isolate, obj);
-    return obj;
+    return clientDataPool.wrap(isolate, clientdata);
 }
 
 void* unwrapClientData(v8::Isolate* isolate, const v8::Local<v8::Value>& obj) {
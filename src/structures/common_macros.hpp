@@ -2,6 +2,7 @@
 #include "v8.h"
 #include "../util/convert.hpp"
 #include "../node/utils.hpp"
+#include "../node/stringtable.hpp"
 
 extern enginefuncs_t g_engfuncs;
 
@@ -16,7 +17,7 @@ extern enginefuncs_t g_engfuncs;
 // Type conversion macros for setters
 #define SETFLOAT(v) v->NumberValue(info.GetIsolate()->GetCurrentContext()).ToChecked()
 #define SETINT(v) v->Int32Value(info.GetIsolate()->GetCurrentContext()).ToChecked()
-#define SETSTR(v) (*g_engfuncs.pfnAllocString)(utils::js2string(info.GetIsolate(), v))
+#define SETSTR(v) stringtable::alloc(info.GetIsolate(), v)
 #define SETVEC3(v, f) utils::js2vect(info.GetIsolate(), v8::Local<v8::Array>::Cast(v), f)
 #define SETBOOL(v) v->BooleanValue(info.GetIsolate())
 #define SETQBOOL(v) (v->BooleanValue(info.GetIsolate()) ? 1 : 0)
@@ -90,6 +91,35 @@ extern enginefuncs_t g_engfuncs;
             } \
         })
 
+// vec3_t entvars field as a live Float32Array (see structures::wrapVector); assignment
+// copies from a typed array or a plain array
+#define VECTOR_ACCESSOR_T(STRUCT_TYPE, UNWRAP_FN, TEMPLATE, FIELD) \
+    TEMPLATE->SetNativeDataProperty(v8::String::NewFromUtf8(isolate, #FIELD).ToLocalChecked(), \
+        [](v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value> &info) { \
+            STRUCT_TYPE *obj = UNWRAP_FN(info.GetIsolate(), info.Holder()); \
+            if (obj == NULL) return; \
+            info.GetReturnValue().Set(structures::wrapVector(info.GetIsolate(), &obj->FIELD, structures::EntvarsVector::FIELD)); \
+        }, \
+        [](v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void> &info) { \
+            STRUCT_TYPE *obj = UNWRAP_FN(info.GetIsolate(), info.Holder()); \
+            if (obj == NULL) return; \
+            structures::writeVector(info.GetIsolate(), value, obj->FIELD); \
+        })
+
+// Entity shortcut for the vector fields, skips the trip through the entvars wrapper
+#define VECTOR_DELEGATE_ACCESSOR(FIELD) \
+    _entity->SetNativeDataProperty(v8::String::NewFromUtf8(isolate, #FIELD).ToLocalChecked(), \
+        [](v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value> &info) { \
+            edict_t *edict = structures::unwrapEntity(info.GetIsolate(), info.Holder()); \
+            if (edict == nullptr) return; \
+            info.GetReturnValue().Set(structures::wrapVector(info.GetIsolate(), &edict->v.FIELD, structures::EntvarsVector::FIELD)); \
+        }, \
+        [](v8::Local<v8::Name> property, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void> &info) { \
+            edict_t *edict = structures::unwrapEntity(info.GetIsolate(), info.Holder()); \
+            if (edict == nullptr) return; \
+            structures::writeVector(info.GetIsolate(), value, edict->v.FIELD); \
+        })
+
 // Legacy macros for entity.cpp compatibility (these will be replaced)
 #define GETTER(FIELD, TYPE) GETTER_T(edict_t, structures::unwrapEntity, FIELD, TYPE)
 #define SETTER(FIELD, TYPE) SETTER_T(edict_t, structures::unwrapEntity, FIELD, TYPE)
@@ -1,15 +1,15 @@
 #include "structures.hpp"
 #include "common_macros.hpp"
+#include "pool.hpp"
 #include <custom.h>
-#include <unordered_map>
 
 namespace structures {
 
 v8::Eternal<v8::ObjectTemplate> customizationTemplate;
-std::unordered_map<void*, v8::Persistent<v8::Object>> wrappedCustomizations;
+static WrapperPool customizationPool(customizationTemplate);
 
 customization_t* unwrapCustomization_internal(v8::Isolate* isolate, const v8::Local<v8::Value>& obj) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (obj.IsEmpty() || !obj->IsObject()) {
         return nullptr;
     }
@@ -24,7 +24,7 @@ customization_t* unwrapCustomization_internal(v8::Isolate* isolate, const v8::Lo
 }
 
 void createCustomizationTemplate(v8::Isolate* isolate) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     v8::HandleScope scope(isolate);
     
     v8::Local<v8::ObjectTemplate> templ = v8::ObjectTemplate::New(isolate);
@@ -103,27 +103,17 @@ void createCustomizationTemplate(v8::Isolate* isolate) {
 }
 
 v8::Local<v8::Value> wrapCustomization(v8::Isolate* isolate, void* customization) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (!customization) {
         return v8::Null(isolate);
     }
     
-    // Check if already wrapped
-    if (wrappedCustomizations.find(customization) != wrappedCustomizations.end()) {
-        return v8::Local<v8::Object>::New(isolate, wrappedCustomizations[customization]);
-    }
-    
     // Create template if not initialized
     if (customizationTemplate.IsEmpty()) {
         createCustomizationTemplate(isolate);
     }
     
-    // Create new instance
-    v8::Local<v8::Object> obj = customizationTemplate.Get(isolate)->NewInstance(isolate->GetCurrentContext()).ToLocalChecked();
-    obj->SetAlignedPointerInInternalField(0, customization);
-    
-    wrappedCustomizations[customization].Reset(isolate, obj);
-    return obj;
+    return customizationPool.wrap(isolate, customization);
 }
 
 void* unwrapCustomization(v8::Isolate* isolate, const v8::Local<v8::Value>& obj) {
@@ -9,7 +9,7 @@ v8::Eternal<v8::ObjectTemplate> cvarTemplate;
 std::unordered_map<void*, v8::Persistent<v8::Object>> wrappedCvars;
 
 cvar_t* unwrapCvar_internal(v8::Isolate* isolate, const v8::Local<v8::Value>& obj) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (obj.IsEmpty() || !obj->IsObject()) {
         return nullptr;
     }
@@ -24,7 +24,7 @@ cvar_t* unwrapCvar_internal(v8::Isolate* isolate, const v8::Local<v8::Value>& ob
 }
 
 void createCvarTemplate(v8::Isolate* isolate) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     v8::HandleScope scope(isolate);
     
     v8::Local<v8::ObjectTemplate> templ = v8::ObjectTemplate::New(isolate);
@@ -97,7 +97,7 @@ void createCvarTemplate(v8::Isolate* isolate) {
 }
 
 v8::Local<v8::Value> wrapCvar(v8::Isolate* isolate, void* cvar) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (!cvar) {
         return v8::Null(isolate);
     }
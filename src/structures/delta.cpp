@@ -11,7 +11,7 @@ std::unordered_map<void*, v8::Persistent<v8::Object>> wrappedDeltas;
 // We only have access to it through engine functions
 // This provides a minimal wrapper for the pointer
 struct delta_s* unwrapDelta_internal(v8::Isolate* isolate, const v8::Local<v8::Value>& obj) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (obj.IsEmpty() || !obj->IsObject()) {
         return nullptr;
     }
@@ -26,7 +26,7 @@ struct delta_s* unwrapDelta_internal(v8::Isolate* isolate, const v8::Local<v8::V
 }
 
 void createDeltaTemplate(v8::Isolate* isolate) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     v8::HandleScope scope(isolate);
     
     v8::Local<v8::ObjectTemplate> templ = v8::ObjectTemplate::New(isolate);
@@ -70,7 +70,7 @@ void createDeltaTemplate(v8::Isolate* isolate) {
 }
 
 v8::Local<v8::Value> wrapDelta(v8::Isolate* isolate, void* delta) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (!delta) {
         return v8::Null(isolate);
     }
@@ -3,28 +3,108 @@
 #include "common_macros.hpp"
 #include "util/convert.hpp"
 #include "node/utils.hpp"
+#include "node/stringtable.hpp"
 #include <node_buffer.h>
-#include <unordered_map>
+#include <vector>
 
 extern globalvars_t *gpGlobals;
 
 namespace structures
 {
   v8::Eternal<v8::ObjectTemplate> entity;
-  std::unordered_map<int, v8::Persistent<v8::Object>> wrappedEntities;
 
-  void cacheEntity(const v8::FunctionCallbackInfo<v8::Value>& info) {
-    v8::Isolate* isolate = info.GetIsolate();
-    v8::Locker locker(isolate);
+  // One wrapper per edict slot. The serial number tells a recycled slot apart
+  // from the entity the wrapper was made for.
+  struct WrappedEntity
+  {
+    v8::Global<v8::Object> wrapper;
+    int serialnumber;
+  };
+
+  static std::vector<WrappedEntity> wrappedEntities;
+  static const edict_t *edictBase = nullptr;
+
+  static int entitySlot(const edict_t *entity)
+  {
+    // Edicts live in one array from ServerActivate on; the engine call is only
+    // needed before that and for pointers outside of it
+    if (edictBase != nullptr && entity >= edictBase && entity < edictBase + wrappedEntities.size())
+    {
+      return static_cast<int>(entity - edictBase);
+    }
+
+    return (*g_engfuncs.pfnIndexOfEdict)(entity);
+  }
+
+  static void releaseWrapper(v8::Isolate *isolate, WrappedEntity &slot)
+  {
+    if (slot.wrapper.IsEmpty()) return;
+
+    // Scripts holding on to the old wrapper must not reach the new entity
+    v8::HandleScope scope(isolate);
+    slot.wrapper.Get(isolate)->SetAlignedPointerInInternalField(0, nullptr);
+    slot.wrapper.Reset();
+  }
+
+  static void storeWrapper(v8::Isolate *isolate, int entityId, const edict_t *entity, v8::Local<v8::Object> obj)
+  {
+    if (static_cast<size_t>(entityId) >= wrappedEntities.size())
+    {
+      // Entities spawned before ServerActivate
+      wrappedEntities.resize(gpGlobals && gpGlobals->maxEntities > entityId ? gpGlobals->maxEntities : entityId + 1);
+    }
+
+    WrappedEntity &slot = wrappedEntities[entityId];
+    releaseWrapper(isolate, slot);
+    slot.wrapper.Reset(isolate, obj);
+    slot.serialnumber = entity->serialnumber;
+  }
+
+  static v8::Local<v8::Object> newWrapper(v8::Isolate *isolate, v8::Local<v8::Context> context, int entityId, const edict_t *entity)
+  {
+    v8::Local<v8::Object> obj = structures::entity.Get(isolate)->NewInstance(context).ToLocalChecked();
+    obj->SetAlignedPointerInInternalField(0, const_cast<edict_t*>(entity));
+    storeWrapper(isolate, entityId, entity, obj);
+    return obj;
+  }
+
+  // The cache itself is cleared at ServerDeactivate; wrappers made while the map
+  // spawned stay valid here
+  void activateEntityCache(v8::Isolate *isolate, edict_t *edictList, int edictCount, int clientMax)
+  {
     v8::HandleScope scope(isolate);
     v8::Local<v8::Context> context = isolate->GetCurrentContext();
 
-    // wrappedEntities[convert::js2int(isolate, info[0])].Reset(isolate, info[1]);
+    edictBase = edictList;
+    size_t size = gpGlobals && gpGlobals->maxEntities > edictCount ? gpGlobals->maxEntities : edictCount;
+    if (wrappedEntities.size() < size) wrappedEntities.resize(size);
+
+    // Player slots are wrapped on nearly every event, make them up front
+    for (int i = 1; i <= clientMax && edictList != nullptr && i < static_cast<int>(wrappedEntities.size()); i++)
+    {
+      const WrappedEntity &slot = wrappedEntities[i];
+      if (slot.wrapper.IsEmpty() || slot.serialnumber != edictList[i].serialnumber)
+      {
+        newWrapper(isolate, context, i, edictList + i);
+      }
+    }
+  }
+
+  void clearEntityCache(v8::Isolate *isolate)
+  {
+    for (WrappedEntity &slot : wrappedEntities)
+    {
+      releaseWrapper(isolate, slot);
+    }
+
+    wrappedEntities.clear();
+    edictBase = nullptr;
+    clearVectorViews(isolate);
   }
 
   edict_t *unwrapEntity(v8::Isolate *isolate, const v8::Local<v8::Value> &obj)
   {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (obj.IsEmpty() || !obj->IsObject())
     {
       return NULL;
@@ -50,7 +130,7 @@ namespace structures
 
   v8::Local<v8::Value> wrapEntity(v8::Isolate *isolate, const edict_t *entity)
   {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (entity == NULL)
     {
       return v8::Null(isolate);
@@ -63,7 +143,7 @@ namespace structures
       return v8::Null(isolate);
     }
 
-    int entityId = (*g_engfuncs.pfnIndexOfEdict)(entity);
+    int entityId = entitySlot(entity);
 
     // Validate entity index is in valid range
     if (entityId < 0 || (gpGlobals && entityId >= gpGlobals->maxEntities))
@@ -71,33 +151,34 @@ namespace structures
       return v8::Null(isolate);
     }
 
-    if (wrappedEntities.find(entityId) != wrappedEntities.end())
+    if (static_cast<size_t>(entityId) < wrappedEntities.size())
     {
-      v8::Local<v8::Object> existingObject = v8::Local<v8::Object>::New(isolate, wrappedEntities[entityId]);
-      return existingObject;
+      const WrappedEntity &slot = wrappedEntities[entityId];
+      if (!slot.wrapper.IsEmpty() && slot.serialnumber == entity->serialnumber)
+      {
+        return slot.wrapper.Get(isolate);
+      }
     }
 
-    // Create a new instance if an object doesn't exist for this ID
-    v8::Local<v8::Object> obj = structures::entity.Get(isolate)->NewInstance(isolate->GetCurrentContext()).ToLocalChecked();
-    obj->SetAlignedPointerInInternalField(0, const_cast<edict_t*>(entity));
-
-    wrappedEntities[entityId].Reset(isolate, obj);
-    return obj;
+    // Create a new instance if the slot is empty or was recycled
+    return newWrapper(isolate, isolate->GetCurrentContext(), entityId, entity);
   }
 
   void createEntityTemplate(v8::Isolate *isolate, v8::Local<v8::ObjectTemplate> &global)
   {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     v8::EscapableHandleScope scope(isolate);
     auto context = isolate->GetCurrentContext();
 
     v8::Local<v8::FunctionTemplate> entityConstructor = v8::FunctionTemplate::New(isolate, [](const v8::FunctionCallbackInfo<v8::Value>& args) {
-      edict_t* entity = (*g_engfuncs.pfnCreateNamedEntity)((*g_engfuncs.pfnAllocString)(utils::js2string(args.GetIsolate(), args[0])));
+      edict_t* entity = (*g_engfuncs.pfnCreateNamedEntity)(stringtable::alloc(args.GetIsolate(), args[0]));
 
       args.This()->SetAlignedPointerInInternalField(0, entity);
 
-      int entityId = (*g_engfuncs.pfnIndexOfEdict)(entity);
-      wrappedEntities[entityId].Reset(args.GetIsolate(), args.This());
+      if (entity != nullptr)
+      {
+        storeWrapper(args.GetIsolate(), entitySlot(entity), entity, args.This());
+      }
       args.GetReturnValue().Set(args.This());
     });
 
@@ -237,20 +318,20 @@ namespace structures
     DELEGATE_ACCESSOR("classname");
 	  DELEGATE_ACCESSOR("globalname");
 	
-	  DELEGATE_ACCESSOR("origin");
-	  DELEGATE_ACCESSOR("oldorigin");
-	  DELEGATE_ACCESSOR("velocity");
-	  DELEGATE_ACCESSOR("basevelocity");
-	  DELEGATE_ACCESSOR("clbasevelocity");
-	  DELEGATE_ACCESSOR("movedir");
-
-	  DELEGATE_ACCESSOR("angles");
-	  DELEGATE_ACCESSOR("avelocity");
-	  DELEGATE_ACCESSOR("punchangle");
-	  DELEGATE_ACCESSOR("v_angle");
-
-	  DELEGATE_ACCESSOR("endpos");
-	  DELEGATE_ACCESSOR("startpos");
+	  VECTOR_DELEGATE_ACCESSOR(origin);
+	  VECTOR_DELEGATE_ACCESSOR(oldorigin);
+	  VECTOR_DELEGATE_ACCESSOR(velocity);
+	  VECTOR_DELEGATE_ACCESSOR(basevelocity);
+	  VECTOR_DELEGATE_ACCESSOR(clbasevelocity);
+	  VECTOR_DELEGATE_ACCESSOR(movedir);
+
+	  VECTOR_DELEGATE_ACCESSOR(angles);
+	  VECTOR_DELEGATE_ACCESSOR(avelocity);
+	  VECTOR_DELEGATE_ACCESSOR(punchangle);
+	  VECTOR_DELEGATE_ACCESSOR(v_angle);
+
+	  VECTOR_DELEGATE_ACCESSOR(endpos);
+	  VECTOR_DELEGATE_ACCESSOR(startpos);
 	  DELEGATE_ACCESSOR("impacttime");
 	  DELEGATE_ACCESSOR("starttime");
 
@@ -266,11 +347,11 @@ namespace structures
 	  DELEGATE_ACCESSOR("viewmodel");	
 	  DELEGATE_ACCESSOR("weaponmodel");
 
-	  DELEGATE_ACCESSOR("absmin");
-	  DELEGATE_ACCESSOR("absmax");
-	  DELEGATE_ACCESSOR("mins");
-	  DELEGATE_ACCESSOR("maxs");
-	  DELEGATE_ACCESSOR("size");
+	  VECTOR_DELEGATE_ACCESSOR(absmin);
+	  VECTOR_DELEGATE_ACCESSOR(absmax);
+	  VECTOR_DELEGATE_ACCESSOR(mins);
+	  VECTOR_DELEGATE_ACCESSOR(maxs);
+	  VECTOR_DELEGATE_ACCESSOR(size);
 
 	  DELEGATE_ACCESSOR("ltime");
 	  DELEGATE_ACCESSOR("nextthink");
@@ -297,7 +378,7 @@ namespace structures
 	  DELEGATE_ACCESSOR("scale");
 	  DELEGATE_ACCESSOR("rendermode");
 	  DELEGATE_ACCESSOR("renderamt");
-	  DELEGATE_ACCESSOR("rendercolor");
+	  VECTOR_DELEGATE_ACCESSOR(rendercolor);
 	  DELEGATE_ACCESSOR("renderfx");
 
 	  DELEGATE_ACCESSOR("health");
@@ -306,7 +387,7 @@ namespace structures
 	  DELEGATE_ACCESSOR("takedamage");
 
 	  DELEGATE_ACCESSOR("deadflag");
-	  DELEGATE_ACCESSOR("view_ofs");
+	  VECTOR_DELEGATE_ACCESSOR(view_ofs);
 
 	  DELEGATE_ACCESSOR("button");
 	  DELEGATE_ACCESSOR("impulse");
@@ -383,10 +464,10 @@ namespace structures
 	  DELEGATE_ACCESSOR("fuser2");
 	  DELEGATE_ACCESSOR("fuser3");
 	  DELEGATE_ACCESSOR("fuser4");
-	  DELEGATE_ACCESSOR("vuser1");
-	  DELEGATE_ACCESSOR("vuser2");
-	  DELEGATE_ACCESSOR("vuser3");
-	  DELEGATE_ACCESSOR("vuser4");
+	  VECTOR_DELEGATE_ACCESSOR(vuser1);
+	  VECTOR_DELEGATE_ACCESSOR(vuser2);
+	  VECTOR_DELEGATE_ACCESSOR(vuser3);
+	  VECTOR_DELEGATE_ACCESSOR(vuser4);
 	  DELEGATE_ACCESSOR("euser1");
 	  DELEGATE_ACCESSOR("euser2");
 	  DELEGATE_ACCESSOR("euser3");
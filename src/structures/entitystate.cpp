@@ -1,15 +1,15 @@
 #include "structures.hpp"
 #include "common_macros.hpp"
+#include "pool.hpp"
 #include <entity_state.h>
-#include <unordered_map>
 
 namespace structures {
 
 v8::Eternal<v8::ObjectTemplate> entityStateTemplate;
-std::unordered_map<void*, v8::Persistent<v8::Object>> wrappedEntityStates;
+static WrapperPool entityStatePool(entityStateTemplate);
 
 entity_state_s* unwrapEntityState_internal(v8::Isolate* isolate, const v8::Local<v8::Value>& obj) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (obj.IsEmpty() || !obj->IsObject()) {
         return nullptr;
     }
@@ -24,7 +24,7 @@ entity_state_s* unwrapEntityState_internal(v8::Isolate* isolate, const v8::Local
 }
 
 void createEntityStateTemplate(v8::Isolate* isolate) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     v8::HandleScope scope(isolate);
     
     v8::Local<v8::ObjectTemplate> templ = v8::ObjectTemplate::New(isolate);
@@ -210,27 +210,17 @@ void createEntityStateTemplate(v8::Isolate* isolate) {
 }
 
 v8::Local<v8::Value> wrapEntityState(v8::Isolate* isolate, void* entitystate) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (!entitystate) {
         return v8::Null(isolate);
     }
     
-    // Check if already wrapped
-    if (wrappedEntityStates.find(entitystate) != wrappedEntityStates.end()) {
-        return v8::Local<v8::Object>::New(isolate, wrappedEntityStates[entitystate]);
-    }
-    
     // Create template if not initialized
     if (entityStateTemplate.IsEmpty()) {
         createEntityStateTemplate(isolate);
     }
     
-    // Create new instance
-    v8::Local<v8::Object> obj = entityStateTemplate.Get(isolate)->NewInstance(isolate->GetCurrentContext()).ToLocalChecked();
-    obj->SetAlignedPointerInInternalField(0, entitystate);
-    
-    wrappedEntityStates[entitystate].Reset(isolate, obj);
-    return obj;
+    return entityStatePool.wrap(isolate, entitystate);
 }
 
 void* unwrapEntityState(v8::Isolate* isolate, const v8::Local<v8::Value>& obj) {
@@ -8,7 +8,7 @@ v8::Eternal<v8::ObjectTemplate> entvarsTemplate;
 std::unordered_map<void*, v8::Persistent<v8::Object>> wrappedEntvars;
 
 entvars_t* unwrapEntvars_internal(v8::Isolate* isolate, const v8::Local<v8::Value>& obj) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (obj.IsEmpty() || !obj->IsObject()) {
         return nullptr;
     }
@@ -23,7 +23,7 @@ entvars_t* unwrapEntvars_internal(v8::Isolate* isolate, const v8::Local<v8::Valu
 }
 
 void createEntvarsTemplate(v8::Isolate* isolate) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     v8::HandleScope scope(isolate);
     
     v8::Local<v8::ObjectTemplate> templ = v8::ObjectTemplate::New(isolate);
@@ -34,21 +34,21 @@ void createEntvarsTemplate(v8::Isolate* isolate) {
     ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, "classname", classname, GETSTR, SETSTR);
     ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, "globalname", globalname, GETSTR, SETSTR);
 
-    ACCESSORL_T(entvars_t, unwrapEntvars_internal, templ, "origin", origin, GETVEC3, SETVEC3);
-    ACCESSORL_T(entvars_t, unwrapEntvars_internal, templ, "oldorigin", oldorigin, GETVEC3, SETVEC3);
-    ACCESSORL_T(entvars_t, unwrapEntvars_internal, templ, "velocity", velocity, GETVEC3, SETVEC3);
-    ACCESSORL_T(entvars_t, unwrapEntvars_internal, templ, "basevelocity", basevelocity, GETVEC3, SETVEC3);
-    ACCESSORL_T(entvars_t, unwrapEntvars_internal, templ, "clbasevelocity", clbasevelocity, GETVEC3, SETVEC3);
-    ACCESSORL_T(entvars_t, unwrapEntvars_internal, templ, "movedir", movedir, GETVEC3, SETVEC3);
+    VECTOR_ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, origin);
+    VECTOR_ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, oldorigin);
+    VECTOR_ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, velocity);
+    VECTOR_ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, basevelocity);
+    VECTOR_ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, clbasevelocity);
+    VECTOR_ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, movedir);
 
-    ACCESSORL_T(entvars_t, unwrapEntvars_internal, templ, "angles", angles, GETVEC3, SETVEC3);
-    ACCESSORL_T(entvars_t, unwrapEntvars_internal, templ, "avelocity", avelocity, GETVEC3, SETVEC3);
-    ACCESSORL_T(entvars_t, unwrapEntvars_internal, templ, "punchangle", punchangle, GETVEC3, SETVEC3);
-    ACCESSORL_T(entvars_t, unwrapEntvars_internal, templ, "v_angle", v_angle, GETVEC3, SETVEC3);
+    VECTOR_ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, angles);
+    VECTOR_ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, avelocity);
+    VECTOR_ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, punchangle);
+    VECTOR_ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, v_angle);
 
     // For parametric entities
-    ACCESSORL_T(entvars_t, unwrapEntvars_internal, templ, "endpos", endpos, GETVEC3, SETVEC3);
-    ACCESSORL_T(entvars_t, unwrapEntvars_internal, templ, "startpos", startpos, GETVEC3, SETVEC3);
+    VECTOR_ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, endpos);
+    VECTOR_ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, startpos);
     ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, "impacttime", impacttime, GETN, SETFLOAT);
     ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, "starttime", starttime, GETN, SETFLOAT);
 
@@ -79,8 +79,8 @@ void createEntvarsTemplate(v8::Isolate* isolate) {
             entvars_t *entvars = unwrapEntvars_internal(info.GetIsolate(), info.Holder());
             if (entvars == nullptr) return;
             
-            // Convert JS string to string_t using engine's AllocString
-            entvars->viewmodel = (*g_engfuncs.pfnAllocString)(convert::js2str(info.GetIsolate(), value));
+            // Convert JS string to string_t through the engine string table
+            entvars->viewmodel = stringtable::alloc(info.GetIsolate(), value);
         });
     // Handle weaponmodel as string_t (like model field)
     templ->SetNativeDataProperty(v8::String::NewFromUtf8(isolate, "weaponmodel").ToLocalChecked(),
@@ -89,15 +89,15 @@ void createEntvarsTemplate(v8::Isolate* isolate) {
             entvars_t *entvars = unwrapEntvars_internal(info.GetIsolate(), info.Holder());
             if (entvars == nullptr) return;
             
-            // Convert JS string to string_t using engine's AllocString
-            entvars->weaponmodel = (*g_engfuncs.pfnAllocString)(convert::js2str(info.GetIsolate(), value));
+            // Convert JS string to string_t through the engine string table
+            entvars->weaponmodel = stringtable::alloc(info.GetIsolate(), value);
         });
 
-    ACCESSORL_T(entvars_t, unwrapEntvars_internal, templ, "absmin", absmin, GETVEC3, SETVEC3);
-    ACCESSORL_T(entvars_t, unwrapEntvars_internal, templ, "absmax", absmax, GETVEC3, SETVEC3);
-    ACCESSORL_T(entvars_t, unwrapEntvars_internal, templ, "mins", mins, GETVEC3, SETVEC3);
-    ACCESSORL_T(entvars_t, unwrapEntvars_internal, templ, "maxs", maxs, GETVEC3, SETVEC3);
-    ACCESSORL_T(entvars_t, unwrapEntvars_internal, templ, "size", size, GETVEC3, SETVEC3);
+    VECTOR_ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, absmin);
+    VECTOR_ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, absmax);
+    VECTOR_ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, mins);
+    VECTOR_ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, maxs);
+    VECTOR_ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, size);
 
     ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, "ltime", ltime, GETN, SETFLOAT);
     ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, "nextthink", nextthink, GETN, SETFLOAT);
@@ -185,7 +185,7 @@ void createEntvarsTemplate(v8::Isolate* isolate) {
     ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, "scale", scale, GETN, SETFLOAT);
     ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, "rendermode", rendermode, GETN, SETINT);
     ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, "renderamt", renderamt, GETN, SETFLOAT);
-    ACCESSORL_T(entvars_t, unwrapEntvars_internal, templ, "rendercolor", rendercolor, GETVEC3, SETVEC3);
+    VECTOR_ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, rendercolor);
     ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, "renderfx", renderfx, GETN, SETINT);
 
     ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, "health", health, GETN, SETFLOAT);
@@ -194,7 +194,7 @@ void createEntvarsTemplate(v8::Isolate* isolate) {
     ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, "takedamage", takedamage, GETN, SETFLOAT);
 
     ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, "deadflag", deadflag, GETN, SETINT);
-    ACCESSORL_T(entvars_t, unwrapEntvars_internal, templ, "view_ofs", view_ofs, GETVEC3, SETVEC3);
+    VECTOR_ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, view_ofs);
 
     ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, "button", button, GETN, SETINT);
     ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, "impulse", impulse, GETN, SETINT);
@@ -393,10 +393,10 @@ void createEntvarsTemplate(v8::Isolate* isolate) {
     ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, "fuser2", fuser2, GETN, SETFLOAT);
     ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, "fuser3", fuser3, GETN, SETFLOAT);
     ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, "fuser4", fuser4, GETN, SETFLOAT);
-    ACCESSORL_T(entvars_t, unwrapEntvars_internal, templ, "vuser1", vuser1, GETVEC3, SETVEC3);
-    ACCESSORL_T(entvars_t, unwrapEntvars_internal, templ, "vuser2", vuser2, GETVEC3, SETVEC3);
-    ACCESSORL_T(entvars_t, unwrapEntvars_internal, templ, "vuser3", vuser3, GETVEC3, SETVEC3);
-    ACCESSORL_T(entvars_t, unwrapEntvars_internal, templ, "vuser4", vuser4, GETVEC3, SETVEC3);
+    VECTOR_ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, vuser1);
+    VECTOR_ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, vuser2);
+    VECTOR_ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, vuser3);
+    VECTOR_ACCESSOR_T(entvars_t, unwrapEntvars_internal, templ, vuser4);
     
     templ->SetNativeDataProperty(v8::String::NewFromUtf8(isolate, "euser1").ToLocalChecked(),
         [](v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value> &info) {
@@ -482,7 +482,7 @@ void createEntvarsTemplate(v8::Isolate* isolate) {
 }
 
 v8::Local<v8::Value> wrapEntvars(v8::Isolate* isolate, entvars_t* entvars) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (!entvars) {
         return v8::Null(isolate);
     }
@@ -1,16 +1,16 @@
 #include "structures.hpp"
 #include "common_macros.hpp"
+#include "pool.hpp"
 #include <eiface.h>
-#include <unordered_map>
 #include <cstring>
 
 namespace structures {
 
 v8::Eternal<v8::ObjectTemplate> keyValueDataTemplate;
-std::unordered_map<void*, v8::Persistent<v8::Object>> wrappedKeyValueData;
+static WrapperPool keyValueDataPool(keyValueDataTemplate);
 
 KeyValueData* createKeyValueDataFromJS(v8::Isolate* isolate, const v8::Local<v8::Object>& jsObj) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     v8::HandleScope scope(isolate);
     
     KeyValueData* kvd = new KeyValueData();
@@ -63,7 +63,7 @@ KeyValueData* createKeyValueDataFromJS(v8::Isolate* isolate, const v8::Local<v8:
 }
 
 KeyValueData* unwrapKeyValueData_internal(v8::Isolate* isolate, const v8::Local<v8::Value>& obj) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (obj.IsEmpty() || !obj->IsObject()) {
         return nullptr;
     }
@@ -86,7 +86,7 @@ KeyValueData* unwrapKeyValueData_internal(v8::Isolate* isolate, const v8::Local<
 }
 
 void createKeyValueDataTemplate(v8::Isolate* isolate) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     v8::HandleScope scope(isolate);
     
     v8::Local<v8::ObjectTemplate> templ = v8::ObjectTemplate::New(isolate);
@@ -133,27 +133,17 @@ void createKeyValueDataTemplate(v8::Isolate* isolate) {
 }
 
 v8::Local<v8::Value> wrapKeyValueData(v8::Isolate* isolate, void* keyvalue) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (!keyvalue) {
         return v8::Null(isolate);
     }
     
-    // Check if already wrapped
-    if (wrappedKeyValueData.find(keyvalue) != wrappedKeyValueData.end()) {
-        return v8::Local<v8::Object>::New(isolate, wrappedKeyValueData[keyvalue]);
-    }
-    
     // Create template if not initialized
     if (keyValueDataTemplate.IsEmpty()) {
         createKeyValueDataTemplate(isolate);
     }
     
-    // Create new instance
-    v8::Local<v8::Object> obj = keyValueDataTemplate.Get(isolate)->NewInstance(isolate->GetCurrentContext()).ToLocalChecked();
-    obj->SetAlignedPointerInInternalField(0, keyvalue);
-    
-    wrappedKeyValueData[keyvalue].Reset(isolate, obj);
-    return obj;
+    return keyValueDataPool.wrap(isolate, keyvalue);
 }
 
 void* unwrapKeyValueData(v8::Isolate* isolate, const v8::Local<v8::Value>& obj) {
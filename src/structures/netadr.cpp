@@ -1,15 +1,15 @@
 #include "structures.hpp"
 #include "common_macros.hpp"
+#include "pool.hpp"
 #include <netadr.h>
-#include <unordered_map>
 
 namespace structures {
 
 v8::Eternal<v8::ObjectTemplate> netadrTemplate;
-std::unordered_map<void*, v8::Persistent<v8::Object>> wrappedNetAdrs;
+static WrapperPool netAdrPool(netadrTemplate);
 
 netadr_s* unwrapNetAdr_internal(v8::Isolate* isolate, const v8::Local<v8::Value>& obj) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (obj.IsEmpty() || !obj->IsObject()) {
         return nullptr;
     }
@@ -24,7 +24,7 @@ netadr_s* unwrapNetAdr_internal(v8::Isolate* isolate, const v8::Local<v8::Value>
 }
 
 void createNetAdrTemplate(v8::Isolate* isolate) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     v8::HandleScope scope(isolate);
     
     v8::Local<v8::ObjectTemplate> templ = v8::ObjectTemplate::New(isolate);
@@ -134,27 +134,17 @@ void createNetAdrTemplate(v8::Isolate* isolate) {
 }
 
 v8::Local<v8::Value> wrapNetAdr(v8::Isolate* isolate, void* netadr) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (!netadr) {
         return v8::Null(isolate);
     }
     
-    // Check if already wrapped
-    if (wrappedNetAdrs.find(netadr) != wrappedNetAdrs.end()) {
-        return v8::Local<v8::Object>::New(isolate, wrappedNetAdrs[netadr]);
-    }
-    
     // Create template if not initialized
     if (netadrTemplate.IsEmpty()) {
         createNetAdrTemplate(isolate);
     }
     
-    // Create new instance
-    v8::Local<v8::Object> obj = netadrTemplate.Get(isolate)->NewInstance(isolate->GetCurrentContext()).ToLocalChecked();
-    obj->SetAlignedPointerInInternalField(0, netadr);
-    
-    wrappedNetAdrs[netadr].Reset(isolate, obj);
-    return obj;
+    return netAdrPool.wrap(isolate, netadr);
 }
 
 void* unwrapNetAdr(v8::Isolate* isolate, const v8::Local<v8::Value>& obj) {
@@ -1,16 +1,16 @@
 #include "structures.hpp"
 #include "common_macros.hpp"
+#include "pool.hpp"
 #include <pm_defs.h>
 #include <pm_movevars.h>
-#include <unordered_map>
 
 namespace structures {
 
 v8::Eternal<v8::ObjectTemplate> playerMoveTemplate;
-std::unordered_map<void*, v8::Persistent<v8::Object>> wrappedPlayerMoves;
+static WrapperPool playerMovePool(playerMoveTemplate);
 
 playermove_s* unwrapPlayerMove_internal(v8::Isolate* isolate, const v8::Local<v8::Value>& obj) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (obj.IsEmpty() || !obj->IsObject()) {
         return nullptr;
     }
@@ -25,7 +25,7 @@ playermove_s* unwrapPlayerMove_internal(v8::Isolate* isolate, const v8::Local<v8
 }
 
 void createPlayerMoveTemplate(v8::Isolate* isolate) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     v8::HandleScope scope(isolate);
     
     v8::Local<v8::ObjectTemplate> templ = v8::ObjectTemplate::New(isolate);
@@ -224,27 +224,17 @@ void createPlayerMoveTemplate(v8::Isolate* isolate) {
 }
 
 v8::Local<v8::Value> wrapPlayerMove(v8::Isolate* isolate, void* playermove) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (!playermove) {
         return v8::Null(isolate);
     }
     
-    // Check if already wrapped
-    if (wrappedPlayerMoves.find(playermove) != wrappedPlayerMoves.end()) {
-        return v8::Local<v8::Object>::New(isolate, wrappedPlayerMoves[playermove]);
-    }
-    
     // Create template if not initialized
     if (playerMoveTemplate.IsEmpty()) {
         createPlayerMoveTemplate(isolate);
     }
     
-    // Create new instance
-    v8::Local<v8::Object> obj = playerMoveTemplate.Get(isolate)->NewInstance(isolate->GetCurrentContext()).ToLocalChecked();
-    obj->SetAlignedPointerInInternalField(0, playermove);
-    
-    wrappedPlayerMoves[playermove].Reset(isolate, obj);
-    return obj;
+    return playerMovePool.wrap(isolate, playermove);
 }
 
 void* unwrapPlayerMove(v8::Isolate* isolate, const v8::Local<v8::Value>& obj) {
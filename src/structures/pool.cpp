@@ -0,0 +1,58 @@
+#include "pool.hpp"
+
+namespace structures {
+
+static std::vector<WrapperPool*>& pools() {
+    static std::vector<WrapperPool*> list;
+    return list;
+}
+
+WrapperPool::WrapperPool(v8::Eternal<v8::ObjectTemplate>& objectTemplate) : objectTemplate(objectTemplate) {
+    pools().push_back(this);
+}
+
+v8::Local<v8::Object> WrapperPool::wrap(v8::Isolate* isolate, void* pointer) {
+    auto found = bound.find(pointer);
+    if (found != bound.end() && !wrappers[found->second].IsEmpty()) {
+        return wrappers[found->second].Get(isolate);
+    }
+
+    v8::Local<v8::Object> obj = objectTemplate.Get(isolate)->NewInstance(isolate->GetCurrentContext()).ToLocalChecked();
+    obj->SetAlignedPointerInInternalField(0, pointer);
+
+    // Weak: a wrapper nobody kept is collected and its handle emptied
+    bound[pointer] = wrappers.size();
+    wrappers.emplace_back(isolate, obj);
+    wrappers.back().SetWeak();
+    return obj;
+}
+
+void WrapperPool::reset(v8::Isolate* isolate) {
+    for (auto& wrapper : wrappers) {
+        if (!wrapper.IsEmpty()) {
+            wrapper.Get(isolate)->SetAlignedPointerInInternalField(0, nullptr);
+        }
+    }
+    wrappers.clear();
+    bound.clear();
+}
+
+void WrapperPool::clear() {
+    wrappers.clear();
+    bound.clear();
+}
+
+void resetWrapperPools(v8::Isolate* isolate) {
+    v8::HandleScope scope(isolate);
+    for (WrapperPool* pool : pools()) {
+        pool->reset(isolate);
+    }
+}
+
+void clearWrapperPools() {
+    for (WrapperPool* pool : pools()) {
+        pool->clear();
+    }
+}
+
+}
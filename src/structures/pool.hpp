@@ -0,0 +1,32 @@
+#pragma once
+#include <unordered_map>
+#include <vector>
+#include "v8.h"
+
+namespace structures {
+
+// Wrappers for structs the engine only lends for the duration of a call
+// (usercmd, entity_state, clientdata, ...). Within a frame a pointer always
+// gets the same wrapper. resetWrapperPools() on each frame unbinds every
+// wrapper handed out so far, and later frames get new objects: a wrapper a
+// script kept reads as empty rather than aliasing whatever struct comes next.
+// Handed out wrappers are held weakly, the GC frees the ones nobody kept.
+class WrapperPool {
+public:
+    explicit WrapperPool(v8::Eternal<v8::ObjectTemplate>& objectTemplate);
+
+    v8::Local<v8::Object> wrap(v8::Isolate* isolate, void* pointer);
+    void reset(v8::Isolate* isolate);
+    void clear();
+
+private:
+    v8::Eternal<v8::ObjectTemplate>& objectTemplate;
+    // This frame's wrappers, by the pointer they were bound to
+    std::unordered_map<void*, size_t> bound;
+    std::vector<v8::Global<v8::Object>> wrappers;
+};
+
+void resetWrapperPools(v8::Isolate* isolate);
+void clearWrapperPools();
+
+}
@@ -1,14 +1,14 @@
 #include "structures.hpp"
 #include "common_macros.hpp"
-#include <unordered_map>
+#include "pool.hpp"
 
 namespace structures {
 
 v8::Eternal<v8::ObjectTemplate> saveRestoreDataTemplate;
-std::unordered_map<void*, v8::Persistent<v8::Object>> wrappedSaveRestoreDatas;
+static WrapperPool saveRestoreDataPool(saveRestoreDataTemplate);
 
 SAVERESTOREDATA* unwrapSaveRestoreData_internal(v8::Isolate* isolate, const v8::Local<v8::Value>& obj) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (obj.IsEmpty() || !obj->IsObject()) {
         return nullptr;
     }
@@ -23,7 +23,7 @@ SAVERESTOREDATA* unwrapSaveRestoreData_internal(v8::Isolate* isolate, const v8::
 }
 
 void createSaveRestoreDataTemplate(v8::Isolate* isolate) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     v8::HandleScope scope(isolate);
     
     v8::Local<v8::ObjectTemplate> templ = v8::ObjectTemplate::New(isolate);
@@ -60,27 +60,17 @@ void createSaveRestoreDataTemplate(v8::Isolate* isolate) {
 }
 
 v8::Local<v8::Value> wrapSaveRestoreData(v8::Isolate* isolate, void* savedata) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (!savedata) {
         return v8::Null(isolate);
     }
     
-    // Check if already wrapped
-    if (wrappedSaveRestoreDatas.find(savedata) != wrappedSaveRestoreDatas.end()) {
-        return v8::Local<v8::Object>::New(isolate, wrappedSaveRestoreDatas[savedata]);
-    }
-    
     // Create template if not initialized
     if (saveRestoreDataTemplate.IsEmpty()) {
         createSaveRestoreDataTemplate(isolate);
     }
     
-    // Create new instance
-    v8::Local<v8::Object> obj = saveRestoreDataTemplate.Get(isolate)->NewInstance(isolate->GetCurrentContext()).ToLocalChecked();
-    obj->SetAlignedPointerInInternalField(0, savedata);
-    
-    wrappedSaveRestoreDatas[savedata].Reset(isolate, obj);
-    return obj;
+    return saveRestoreDataPool.wrap(isolate, savedata);
 }
 
 void* unwrapSaveRestoreData(v8::Isolate* isolate, const v8::Local<v8::Value>& obj) {
@@ -9,6 +9,30 @@ namespace structures {
   extern  v8::Local<v8::Value> wrapEntity(v8::Isolate* isolate, const edict_t* entity);
   extern edict_t* unwrapEntity(v8::Isolate* isolate, const v8::Local<v8::Value> &obj);
 
+  // Entity wrapper cache, cleared on ServerDeactivate, sized and pre-warmed for the map on ServerActivate
+  extern void activateEntityCache(v8::Isolate* isolate, edict_t* edictList, int edictCount, int clientMax);
+  extern void clearEntityCache(v8::Isolate* isolate);
+
+  // vec3_t fields of entvars_t that are exposed as live Float32Array views
+  #define ENTVARS_VECTORS(X) \
+    X(origin) X(oldorigin) X(velocity) X(basevelocity) X(clbasevelocity) X(movedir) \
+    X(angles) X(avelocity) X(punchangle) X(v_angle) X(endpos) X(startpos) \
+    X(absmin) X(absmax) X(mins) X(maxs) X(size) X(rendercolor) X(view_ofs) \
+    X(vuser1) X(vuser2) X(vuser3) X(vuser4)
+
+  enum class EntvarsVector {
+    #define ENTVARS_VECTOR_ENUM(name) name,
+    ENTVARS_VECTORS(ENTVARS_VECTOR_ENUM)
+    #undef ENTVARS_VECTOR_ENUM
+    count
+  };
+
+  extern v8::Local<v8::Value> wrapVector(v8::Isolate* isolate, vec3_t* vector, EntvarsVector field);
+  extern void writeVector(v8::Isolate* isolate, const v8::Local<v8::Value> &value, vec3_t &vector);
+  // Once per frame: drops the views of slots whose entity was removed
+  extern void sweepVectorViews(v8::Isolate* isolate);
+  extern void clearVectorViews(v8::Isolate* isolate);
+
   // TraceResult wrapper functions
   extern v8::Local<v8::Value> wrapTraceResult(v8::Isolate* isolate, TraceResult* trace);
   extern TraceResult* unwrapTraceResult(v8::Isolate* isolate, const v8::Local<v8::Value> &obj);
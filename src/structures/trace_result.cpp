@@ -1,17 +1,15 @@
 #include "structures.hpp"
 #include "common_macros.hpp"
 #include "extdll.h"
-#include <unordered_map>
 
 extern globalvars_t *gpGlobals;
 
 namespace structures {
 
 v8::Eternal<v8::ObjectTemplate> traceResultTemplate;
-std::unordered_map<void*, v8::Persistent<v8::Object>> wrappedTraceResults;
 
 TraceResult* unwrapTraceResult_internal(v8::Isolate* isolate, const v8::Local<v8::Value>& obj) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (obj.IsEmpty() || !obj->IsObject()) {
         return nullptr;
     }
@@ -26,7 +24,7 @@ TraceResult* unwrapTraceResult_internal(v8::Isolate* isolate, const v8::Local<v8
 }
 
 void createTraceResultTemplate(v8::Isolate* isolate) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     v8::HandleScope scope(isolate);
     
     v8::Local<v8::ObjectTemplate> templ = v8::ObjectTemplate::New(isolate);
@@ -128,7 +126,7 @@ void createTraceResultTemplate(v8::Isolate* isolate) {
 }
 
 v8::Local<v8::Value> wrapTraceResult(v8::Isolate* isolate, TraceResult* trace) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     v8::Local<v8::Context> context = isolate->GetCurrentContext();
     
     if (!trace) {
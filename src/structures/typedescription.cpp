@@ -9,7 +9,7 @@ v8::Eternal<v8::ObjectTemplate> typeDescriptionTemplate;
 std::unordered_map<void*, v8::Persistent<v8::Object>> wrappedTypeDescriptions;
 
 TYPEDESCRIPTION* unwrapTypeDescription_internal(v8::Isolate* isolate, const v8::Local<v8::Value>& obj) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (obj.IsEmpty() || !obj->IsObject()) {
         return nullptr;
     }
@@ -24,7 +24,7 @@ TYPEDESCRIPTION* unwrapTypeDescription_internal(v8::Isolate* isolate, const v8::
 }
 
 void createTypeDescriptionTemplate(v8::Isolate* isolate) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     v8::HandleScope scope(isolate);
     
     v8::Local<v8::ObjectTemplate> templ = v8::ObjectTemplate::New(isolate);
@@ -113,7 +113,7 @@ void createTypeDescriptionTemplate(v8::Isolate* isolate) {
 }
 
 v8::Local<v8::Value> wrapTypeDescription(v8::Isolate* isolate, void* typedesc) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (!typedesc) {
         return v8::Null(isolate);
     }
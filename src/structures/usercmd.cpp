@@ -1,15 +1,15 @@
 #include "structures.hpp"
 #include "common_macros.hpp"
+#include "pool.hpp"
 #include <usercmd.h>
-#include <unordered_map>
 
 namespace structures {
 
 v8::Eternal<v8::ObjectTemplate> userCmdTemplate;
-std::unordered_map<void*, v8::Persistent<v8::Object>> wrappedUserCmds;
+static WrapperPool userCmdPool(userCmdTemplate);
 
 usercmd_t* unwrapUserCmd_internal(v8::Isolate* isolate, const v8::Local<v8::Value>& obj) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (obj.IsEmpty() || !obj->IsObject()) {
         return nullptr;
     }
@@ -24,7 +24,7 @@ usercmd_t* unwrapUserCmd_internal(v8::Isolate* isolate, const v8::Local<v8::Valu
 }
 
 void createUserCmdTemplate(v8::Isolate* isolate) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     v8::HandleScope scope(isolate);
     
     v8::Local<v8::ObjectTemplate> templ = v8::ObjectTemplate::New(isolate);
@@ -52,27 +52,17 @@ void createUserCmdTemplate(v8::Isolate* isolate) {
 }
 
 v8::Local<v8::Value> wrapUserCmd(v8::Isolate* isolate, void* usercmd) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (!usercmd) {
         return v8::Null(isolate);
     }
     
-    // Check if already wrapped
-    if (wrappedUserCmds.find(usercmd) != wrappedUserCmds.end()) {
-        return v8::Local<v8::Object>::New(isolate, wrappedUserCmds[usercmd]);
-    }
-    
     // Create template if not initialized
     if (userCmdTemplate.IsEmpty()) {
         createUserCmdTemplate(isolate);
     }
     
-    // Create new instance
-    v8::Local<v8::Object> obj = userCmdTemplate.Get(isolate)->NewInstance(isolate->GetCurrentContext()).ToLocalChecked();
-    obj->SetAlignedPointerInInternalField(0, usercmd);
-    
-    wrappedUserCmds[usercmd].Reset(isolate, obj);
-    return obj;
+    return userCmdPool.wrap(isolate, usercmd);
 }
 
 void* unwrapUserCmd(v8::Isolate* isolate, const v8::Local<v8::Value>& obj) {
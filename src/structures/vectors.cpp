@@ -0,0 +1,153 @@
+#include "extdll.h"
+#include "structures.hpp"
+#include "node/utils.hpp"
+#include <array>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+extern globalvars_t *gpGlobals;
+extern enginefuncs_t g_engfuncs;
+
+namespace structures
+{
+  // Every vector field of an edict slot is a Float32Array over a non-owning
+  // ArrayBuffer that covers just that vec3_t, so `view.buffer` cannot reach the
+  // rest of the edict. Views are made on first access and kept per slot. The
+  // serial number tells a recycled slot apart: its buffers are then detached,
+  // so views a script kept go empty instead of writing into the new entity.
+  struct SlotViews
+  {
+    int serialnumber;
+    std::array<v8::Global<v8::ArrayBuffer>, static_cast<size_t>(EntvarsVector::count)> buffers;
+    std::array<v8::Global<v8::Float32Array>, static_cast<size_t>(EntvarsVector::count)> views;
+  };
+
+  static const edict_t *tableBase = nullptr;
+  static int tableSize = 0;
+  static std::vector<std::unique_ptr<SlotViews>> slotViews;
+
+  static bool mapTable()
+  {
+    if (tableBase != nullptr) return true;
+    if (gpGlobals == nullptr || gpGlobals->maxEntities <= 0) return false;
+
+    tableBase = (*g_engfuncs.pfnPEntityOfEntIndex)(0);
+    if (tableBase == nullptr) return false;
+    tableSize = gpGlobals->maxEntities;
+
+    slotViews.resize(tableSize);
+    return true;
+  }
+
+  static void detach(v8::Isolate *isolate, SlotViews &slot)
+  {
+    for (v8::Global<v8::ArrayBuffer> &buffer : slot.buffers)
+    {
+      if (!buffer.IsEmpty()) buffer.Get(isolate)->Detach(v8::Local<v8::Value>()).Check();
+    }
+  }
+
+  static SlotViews &slotFor(v8::Isolate *isolate, size_t index)
+  {
+    const edict_t *edict = tableBase + index;
+    std::unique_ptr<SlotViews> &slot = slotViews[index];
+
+    if (slot && slot->serialnumber != edict->serialnumber)
+    {
+      detach(isolate, *slot);
+      slot.reset();
+    }
+
+    if (!slot)
+    {
+      slot = std::make_unique<SlotViews>();
+      slot->serialnumber = edict->serialnumber;
+    }
+
+    return *slot;
+  }
+
+  v8::Local<v8::Value> wrapVector(v8::Isolate *isolate, vec3_t *vector, EntvarsVector field)
+  {
+    if (vector == nullptr) return v8::Null(isolate);
+
+    if (!mapTable())
+    {
+      return utils::vect2js(isolate, *vector);
+    }
+
+    ptrdiff_t offset = reinterpret_cast<const char *>(vector) - reinterpret_cast<const char *>(tableBase);
+    if (offset < 0 || static_cast<size_t>(offset) + sizeof(vec3_t) > tableSize * sizeof(edict_t))
+    {
+      // Not an edict's entvars: hand out a copy as before
+      return utils::vect2js(isolate, *vector);
+    }
+
+    SlotViews &slot = slotFor(isolate, offset / sizeof(edict_t));
+
+    v8::Global<v8::Float32Array> &view = slot.views[static_cast<size_t>(field)];
+    if (view.IsEmpty())
+    {
+      std::unique_ptr<v8::BackingStore> backingStore = v8::ArrayBuffer::NewBackingStore(
+        vector, sizeof(vec3_t),
+        [](void *data, size_t length, void *deleterData) {
+          // The engine owns the edict table
+        }, nullptr);
+
+      v8::Local<v8::ArrayBuffer> buffer = v8::ArrayBuffer::New(isolate, std::move(backingStore));
+      slot.buffers[static_cast<size_t>(field)].Reset(isolate, buffer);
+      view.Reset(isolate, v8::Float32Array::New(buffer, 0, 3));
+    }
+
+    return view.Get(isolate);
+  }
+
+  void writeVector(v8::Isolate *isolate, const v8::Local<v8::Value> &value, vec3_t &vector)
+  {
+    if (value->IsFloat32Array())
+    {
+      v8::Local<v8::Float32Array> array = value.As<v8::Float32Array>();
+      if (array->Length() < 3) return;
+
+      float source[3];
+      array->CopyContents(source, sizeof(source));
+      memcpy(&vector, source, sizeof(source));
+      return;
+    }
+
+    if (value->IsArray())
+    {
+      utils::js2vect(isolate, value.As<v8::Array>(), vector);
+    }
+  }
+
+  void sweepVectorViews(v8::Isolate *isolate)
+  {
+    v8::HandleScope scope(isolate);
+    for (size_t index = 0; index < slotViews.size(); index++)
+    {
+      std::unique_ptr<SlotViews> &slot = slotViews[index];
+      const edict_t *edict = tableBase + index;
+      if (slot && (edict->free || slot->serialnumber != edict->serialnumber))
+      {
+        detach(isolate, *slot);
+        slot.reset();
+      }
+    }
+  }
+
+  void clearVectorViews(v8::Isolate *isolate)
+  {
+    // Views kept by scripts go empty instead of reading the old table
+    v8::HandleScope scope(isolate);
+    for (std::unique_ptr<SlotViews> &slot : slotViews)
+    {
+      if (slot) detach(isolate, *slot);
+    }
+
+    slotViews.clear();
+    tableBase = nullptr;
+    tableSize = 0;
+  }
+}
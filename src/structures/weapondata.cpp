@@ -1,15 +1,15 @@
 #include "structures.hpp"
 #include "common_macros.hpp"
+#include "pool.hpp"
 #include <weaponinfo.h>
-#include <unordered_map>
 
 namespace structures {
 
 v8::Eternal<v8::ObjectTemplate> weaponDataTemplate;
-std::unordered_map<void*, v8::Persistent<v8::Object>> wrappedWeaponData;
+static WrapperPool weaponDataPool(weaponDataTemplate);
 
 weapon_data_t* unwrapWeaponData_internal(v8::Isolate* isolate, const v8::Local<v8::Value>& obj) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (obj.IsEmpty() || !obj->IsObject()) {
         return nullptr;
     }
@@ -24,7 +24,7 @@ weapon_data_t* unwrapWeaponData_internal(v8::Isolate* isolate, const v8::Local<v
 }
 
 void createWeaponDataTemplate(v8::Isolate* isolate) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     v8::HandleScope scope(isolate);
     
     v8::Local<v8::ObjectTemplate> templ = v8::ObjectTemplate::New(isolate);
@@ -62,27 +62,17 @@ void createWeaponDataTemplate(v8::Isolate* isolate) {
 }
 
 v8::Local<v8::Value> wrapWeaponData(v8::Isolate* isolate, void* weapondata) {
-    v8::Locker locker(isolate);
+    V8_ASSERT_LOCKED(isolate);
     if (!weapondata) {
         return v8::Null(isolate);
     }
     
-    // Check if already wrapped
-    if (wrappedWeaponData.find(weapondata) != wrappedWeaponData.end()) {
-        return v8::Local<v8::Object>::New(isolate, wrappedWeaponData[weapondata]);
-    }
-    
     // Create template if not initialized
     if (weaponDataTemplate.IsEmpty()) {
         createWeaponDataTemplate(isolate);
     }
     
-    // Create new instance
-    v8::Local<v8::Object> obj = weaponDataTemplate.Get(isolate)->NewInstance(isolate->GetCurrentContext()).ToLocalChecked();
-    obj->SetAlignedPointerInInternalField(0, weapondata);
-    
-    wrappedWeaponData[weapondata].Reset(isolate, obj);
-    return obj;
+    return weaponDataPool.wrap(isolate, weapondata);
 }
 
 void* unwrapWeaponData(v8::Isolate* isolate, const v8::Local<v8::Value>& obj) {